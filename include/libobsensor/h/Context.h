@@ -192,6 +192,51 @@ OB_EXPORT void ob_enable_device_clock_sync(ob_context *context, uint64_t repeat_
  */
 OB_EXPORT void ob_free_idle_memory(ob_context *context, ob_error **error);
 
+/**
+ * @brief Query the runtime metrics of the SDK, in the Prometheus text exposition format
+ * @brief The metrics are counters, gauges and summaries (the latencies, in microseconds) of the frame memory pool (bytes in use, buffers per
+ * manager, allocation misses), the frame queues (depth, high-water mark, dropped frames), the filters (process time) and the transports (packets,
+ * reordered and lost packets or frames). The metrics of an object are removed when it is destroyed.
+ *
+ * @attention The memory of the text is owned by the context, and reused on the next call; copy the text if it needs to be preserved.
+ *
+ * @param[in] context Pointer to the context object
+ * @param[out] error Pointer to an error object that will be populated if an error occurs
+ * @return const char* The metrics text, null-terminated
+ */
+OB_EXPORT const char *ob_query_metrics(ob_context *context, ob_error **error);
+
+/**
+ * @brief Query the value of a runtime metric, summed over all its label sets (e.g. the dropped frames of all the frame queues)
+ *
+ * @param[in] context Pointer to the context object
+ * @param[in] name The name of the metric, as in @ref ob_query_metrics (e.g. "ob_frame_queue_dropped_frames_total")
+ * @param[out] error Pointer to an error object that will be populated if an error occurs
+ * @return double The value of the metric, the sample count for a summary, 0 if no metric has the name
+ */
+OB_EXPORT double ob_query_metric_value(ob_context *context, const char *name, ob_error **error);
+
+/**
+ * @brief Start writing the runtime metrics to a local file periodically, in the Prometheus text exposition format (see @ref ob_query_metrics)
+ * @brief The file is replaced at once on every write, it can be read by the textfile collector of the Prometheus node exporter.
+ *
+ * @attention If the metrics are already being written, the previous file is no longer updated. The dump stops when the context is deleted.
+ *
+ * @param[in] context Pointer to the context object
+ * @param[in] file_path Path of the metrics file to write
+ * @param[in] interval_ms The interval between two writes, in milliseconds
+ * @param[out] error Pointer to an error object that will be populated if the file can not be written
+ */
+OB_EXPORT void ob_start_metrics_dump(ob_context *context, const char *file_path, uint32_t interval_ms, ob_error **error);
+
+/**
+ * @brief Stop writing the runtime metrics to the file, see @ref ob_start_metrics_dump
+ *
+ * @param[in] context Pointer to the context object
+ * @param[out] error Pointer to an error object that will be populated if an error occurs
+ */
+OB_EXPORT void ob_stop_metrics_dump(ob_context *context, ob_error **error);
+
 /**
  * @brief For linux, there are two ways to enable the UVC backend: libuvc and v4l2. This function is used to set the backend type.
  * @brief It is effective when the new device is created.
@@ -281,6 +326,41 @@ OB_EXPORT void ob_log_external_message(ob_log_severity severity, const char *mod
  */
 OB_EXPORT void ob_set_extensions_directory(const char *directory, ob_error **error);
 
+/**
+ * @brief Enable or disable the frame trace
+ * @brief While enabled, every frame records the time it reaches each stage of the frame path (see @ref ob_frame_trace_stage): backend receive,
+ * sensor output, the queue and the processing of each filter, aggregation and delivery. The events of a frame are read with
+ * @ref ob_frame_get_trace_event_count and @ref ob_frame_get_trace_event, to find out which stage a latency spike comes from.
+ *
+ * @attention Disabled by default. Only the frames received from the backend after the trace is enabled are traced.
+ *
+ * @param[in] enable Whether to enable the frame trace
+ * @param[out] error Pointer to an error object that will be populated if an error occurs
+ */
+OB_EXPORT void ob_enable_frame_trace(bool enable, ob_error **error);
+
+/**
+ * @brief Start writing the trace of the frames to a local file, in the JSON format of Chrome trace events, which can be opened with
+ * chrome://tracing or https://ui.perfetto.dev
+ * @brief The frame trace is enabled, and the trace of every frame of the framesets delivered by the pipelines is written when the pipeline is done
+ * with them: when the pipeline callback returns, or when the frameset is returned by @ref ob_pipeline_wait_for_frameset. Every frame is shown as a
+ * track holding one slice per stage, that ends when the frame reaches the stage.
+ *
+ * @attention If a file is already being written, it is closed first. The file is replaced if it exists.
+ *
+ * @param[in] file_path Path of the trace file to write
+ * @param[out] error Pointer to an error object that will be populated if the file can not be opened
+ */
+OB_EXPORT void ob_start_frame_trace_export(const char *file_path, ob_error **error);
+
+/**
+ * @brief Stop writing the trace of the frames and close the file, see @ref ob_start_frame_trace_export
+ * @brief The frame trace stays enabled, call @ref ob_enable_frame_trace to disable it.
+ *
+ * @param[out] error Pointer to an error object that will be populated if an error occurs
+ */
+OB_EXPORT void ob_stop_frame_trace_export(ob_error **error);
+
 // The following interfaces are deprecated and are retained here for compatibility purposes.
 #define ob_enable_multi_device_sync ob_enable_device_clock_sync
 #define ob_set_logger_callback ob_set_logger_to_callback
@@ -227,6 +227,42 @@ OB_EXPORT ob_property_item ob_device_get_supported_property_item(const ob_device
  */
 OB_EXPORT bool ob_device_is_property_supported(const ob_device *device, ob_property_id property_id, ob_permission_type permission, ob_error **error);
 
+/**
+ * @brief Set the cache policy of a device property.
+ * @brief Reads of a cached property are served from the last value read from the device, until the value expires or is invalidated. Writing the property
+ * invalidates its cached value; writing structured data, updating firmware or presets, rebooting the device and a change of the device state reported by the
+ * heartbeat invalidate all cached values.
+ *
+ * @attention Only integer, float, boolean and structured data reads are cached. Properties changed by the device itself (e.g. exposure with auto exposure
+ * enabled) should stay volatile or use a short ttl.
+ *
+ * @param[in] device The device object.
+ * @param[in] property_id The property id.
+ * @param[in] policy The cache policy, properties are volatile by default.
+ * @param[in] ttl_ms The time to live of the cached value in milliseconds, only used by OB_PROPERTY_CACHE_TTL.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ */
+OB_EXPORT void ob_device_set_property_cache_policy(ob_device *device, ob_property_id property_id, ob_property_cache_policy policy, uint32_t ttl_ms,
+                                                   ob_error **error);
+
+/**
+ * @brief Invalidate all cached property values of the device, the next reads go to the device.
+ *
+ * @param[in] device The device object.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ */
+OB_EXPORT void ob_device_invalidate_property_cache(ob_device *device, ob_error **error);
+
+/**
+ * @brief Get the hit and miss counters of the property cache of the device.
+ *
+ * @param[in] device The device object.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ *
+ * @return ob_property_cache_statistics The cache statistics.
+ */
+OB_EXPORT ob_property_cache_statistics ob_device_get_property_cache_statistics(ob_device *device, ob_error **error);
+
 /**
  * @brief Check if the device supports global timestamp.
  *
@@ -162,6 +162,17 @@ OB_EXPORT void ob_delete_frame(const ob_frame *frame, ob_error **error);
  */
 OB_EXPORT void ob_frame_copy_info(const ob_frame *src_frame, ob_frame *dst_frame, ob_error **error);
 
+/**
+ * @brief Get the basic information of the frame in one call
+ * @details Fills type, format, index, data, metadata, timestamps and, for video and point cloud frames, the dimensions. It is cheaper than
+ * calling the individual getters one by one, and it does not allocate or copy the frame data.
+ *
+ * @param[in] frame Frame object
+ * @param[out] info The frame information, refer to @ref ob_frame_info
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ */
+OB_EXPORT void ob_frame_get_info(const ob_frame *frame, ob_frame_info *info, ob_error **error);
+
 /**
  * @brief Get the frame index
  *
@@ -353,6 +364,41 @@ OB_EXPORT bool ob_frame_has_metadata(const ob_frame *frame, ob_frame_metadata_ty
  */
 OB_EXPORT int64_t ob_frame_get_metadata_value(const ob_frame *frame, ob_frame_metadata_type type, ob_error **error);
 
+/**
+ * @brief Get the values of all metadata types of the frame at once
+ * @details The metadata is decoded at most once per frame, this is faster than calling @ref ob_frame_get_metadata_value for every type.
+ *
+ * @param[in] frame frame object
+ * @param[out] values array of count items, values[n] is the value of metadata type n, or 0 if the frame does not contain it
+ * @param[out] valid array of count items, valid[n] is 1 if the frame contains metadata type n, else 0. Can be NULL.
+ * @param[in] count The capacity of values and valid, usually OB_FRAME_METADATA_TYPE_COUNT
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ *
+ * @return uint32_t The number of items written: count, or the number of metadata types of the library if it is smaller
+ */
+OB_EXPORT uint32_t ob_frame_get_all_metadata(const ob_frame *frame, int64_t *values, uint8_t *valid, uint32_t count, ob_error **error);
+
+/**
+ * @brief Get the number of trace events recorded on the frame
+ * @brief The events are only recorded while the frame trace is enabled, see @ref ob_enable_frame_trace. The events of a frameset are recorded on
+ * its frames, get them from each frame of the frameset.
+ *
+ * @param[in] frame The frame object
+ * @param[out] error Pointer to an error object that will be set if an error occurs
+ * @return uint32_t The number of trace events, 0 if the frame has not been traced
+ */
+OB_EXPORT uint32_t ob_frame_get_trace_event_count(const ob_frame *frame, ob_error **error);
+
+/**
+ * @brief Get a trace event recorded on the frame, the events are in the order they were recorded
+ *
+ * @param[in] frame The frame object
+ * @param[in] index The index of the event, less than the value returned by @ref ob_frame_get_trace_event_count
+ * @param[out] event The trace event
+ * @param[out] error Pointer to an error object that will be set if an error occurs
+ */
+OB_EXPORT void ob_frame_get_trace_event(const ob_frame *frame, uint32_t index, ob_frame_trace_event *event, ob_error **error);
+
 /**
  * @brief Get the stream profile of the frame
  *
@@ -597,6 +643,7 @@ OB_EXPORT ob_frame *ob_frameset_get_points_frame(const ob_frame *frameset, ob_er
  * @brief Get a frame of a specific type from the frameset.
  *
  * @attention The frame returned by this function should call @ref ob_delete_frame() to decrease the reference count when it is no longer needed.
+ * @note The frameset keeps the handles of its frames, repeated calls return the same handle with its reference count increased.
  *
  * @param[in] frameset Frameset object.
  * @param[in] frame_type Frame type.
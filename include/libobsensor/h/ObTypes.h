@@ -25,6 +25,7 @@ typedef struct ob_device_info_t                   ob_device_info;
 typedef struct ob_device_list_t                   ob_device_list;
 typedef struct ob_record_device_t                 ob_record_device;
 typedef struct ob_playback_device_t               ob_playback_device;
+typedef struct ob_offline_processor_t             ob_offline_processor;
 typedef struct ob_camera_param_list_t             ob_camera_param_list;
 typedef struct ob_sensor_t                        ob_sensor;
 typedef struct ob_sensor_list_t                   ob_sensor_list;
@@ -1951,6 +1952,51 @@ typedef enum {
 } ob_frame_metadata_type,
     OBFrameMetadataType;
 
+/**
+ * @brief Structure for the basic information of a frame, returned by @ref ob_frame_get_info in one call
+ */
+typedef struct {
+    ob_frame_type type;               ///< Frame type
+    ob_format     format;             ///< Frame format, OB_FORMAT_UNKNOWN if the frame has no stream profile
+    uint64_t      index;              ///< Frame index
+    uint8_t      *data;               ///< Pointer to the frame data, not to be modified, see @ref ob_frame_get_data
+    uint32_t      dataSize;           ///< Size of the frame data
+    uint8_t      *metadata;           ///< Pointer to the frame metadata
+    uint32_t      metadataSize;       ///< Size of the frame metadata
+    uint64_t      timestampUs;        ///< Hardware timestamp in microseconds
+    uint64_t      systemTimestampUs;  ///< System timestamp in microseconds
+    uint64_t      globalTimestampUs;  ///< Global timestamp in microseconds
+    uint32_t      width;              ///< Width of video and point cloud frames, 0 for other frames
+    uint32_t      height;             ///< Height of video and point cloud frames, 0 for other frames
+    uint32_t      strideBytes;        ///< Row stride in bytes of video frames, 0 for other frames
+} OBFrameInfo, ob_frame_info;
+
+/**
+ * @brief The points of the frame path where a trace event is recorded on the frames, see @ref ob_enable_frame_trace
+ */
+typedef enum {
+    OB_FRAME_TRACE_STAGE_BACKEND_RECEIVE    = 0,  ///< The frame is received from the backend (USB, network or playback)
+    OB_FRAME_TRACE_STAGE_SENSOR_OUTPUT      = 1,  ///< The sensor outputs the frame, after the format conversion and the timestamp calculation
+    OB_FRAME_TRACE_STAGE_FILTER_ENQUEUE     = 2,  ///< The frame is pushed to the frame queue of a filter
+    OB_FRAME_TRACE_STAGE_FILTER_DEQUEUE     = 3,  ///< The thread of the filter takes the frame from the queue
+    OB_FRAME_TRACE_STAGE_FILTER_PROCESS_END = 4,  ///< The filter has processed the frame, recorded on the output frame
+    OB_FRAME_TRACE_STAGE_PIPELINE_INPUT     = 5,  ///< The frame reaches the pipeline, after the frame processor of the sensor
+    OB_FRAME_TRACE_STAGE_AGGREGATION        = 6,  ///< The frame aggregator outputs the frameset holding the frame
+    OB_FRAME_TRACE_STAGE_DELIVERY           = 7,  ///< The frameset is passed to the pipeline callback, or returned by @ref ob_pipeline_wait_for_frameset
+    OB_FRAME_TRACE_STAGE_CALLBACK_RETURN    = 8,  ///< The pipeline callback has returned
+    OB_FRAME_TRACE_STAGE_COUNT,                   ///< The number of trace stages, not a valid stage
+} ob_frame_trace_stage,
+    OBFrameTraceStage;
+
+/**
+ * @brief A trace event recorded on a frame, see @ref ob_frame_get_trace_event
+ */
+typedef struct {
+    ob_frame_trace_stage stage;        ///< The point of the frame path
+    uint64_t             timestampUs;  ///< Time of the event in microseconds, on the monotonic clock of the host (not the system time)
+    char                 name[32];     ///< Name of the filter for the filter stages, empty for the other stages
+} OBFrameTraceEvent, ob_frame_trace_event;
+
 /**
  * @brief For Linux, there are two ways to access the UVC device, libuvc and v4l2. The backend type is used to select the backend to access the device.
  *
@@ -1993,6 +2039,15 @@ typedef enum {
 } ob_playback_status,
     OBPlaybackStatus;
 
+/**
+ * @brief The codec of the depth frames in a recording
+ */
+typedef enum {
+    OB_RECORD_DEPTH_CODEC_NONE  = 0, /**< The depth frames are recorded as they are */
+    OB_RECORD_DEPTH_CODEC_DELTA = 1, /**< Lossless coding of the Y16/Z16 depth frames against the previous frame, with periodic key frames */
+} ob_record_depth_codec,
+    OBRecordDepthCodec;
+
 /**
  * @brief Intra-camera Sync Reference based on the exposure start time, the exposure middle time, or the exposure end time.
  */
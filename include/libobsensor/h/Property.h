@@ -1121,6 +1121,24 @@ typedef struct OBPropertyItem {
     OBPermissionType permission; /**< Property read and write permission */
 } OBPropertyItem, ob_property_item;
 
+/**
+ * @brief The cache policy of a property, used to avoid a device transaction on every read of a frequently polled property
+ */
+typedef enum OBPropertyCachePolicy {
+    OB_PROPERTY_CACHE_VOLATILE = 0, /**< Not cached, every read goes to the device (default) */
+    OB_PROPERTY_CACHE_STATIC   = 1, /**< Cached until invalidated by a write of the property or a device event */
+    OB_PROPERTY_CACHE_TTL      = 2, /**< Cached for a limited time, or until invalidated like OB_PROPERTY_CACHE_STATIC */
+} OBPropertyCachePolicy,
+    ob_property_cache_policy;
+
+/**
+ * @brief The statistics of the property value cache
+ */
+typedef struct OBPropertyCacheStatistics {
+    uint64_t hitCount;   /**< Number of reads served from the cache */
+    uint64_t missCount;  /**< Number of reads of cached properties that went to the device */
+} OBPropertyCacheStatistics, ob_property_cache_statistics;
+
 #ifdef __cplusplus
 }
 #endif
@@ -27,6 +27,22 @@ extern "C" {
  */
 OB_EXPORT ob_record_device *ob_create_record_device(ob_device *device, const char *file_path, bool compression_enabled, ob_error **error);
 
+/**
+ * @brief Create a recording device for the specified device with a specified file path, compression and codec of the depth frames.
+ *
+ * @attention The delta coded depth frames are decoded by the playback devices of this SDK version or later only.
+ *
+ * @param[in] device The device to record.
+ * @param[in] file_path The file path to record to.
+ * @param[in] compression_enabled Whether to enable compression for the recording.
+ * @param[in] depth_codec The codec of the Y16/Z16 depth frames, see @ref ob_record_depth_codec. The other frames are recorded as they are.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ *
+ * @return A pointer to the newly created recording device, or NULL if an error occurred.
+ */
+OB_EXPORT ob_record_device *ob_create_record_device_ex(ob_device *device, const char *file_path, bool compression_enabled, ob_record_depth_codec depth_codec,
+                                                       ob_error **error);
+
 /**
  * @brief Delete a recording device.
  *
@@ -95,6 +111,26 @@ OB_EXPORT void ob_playback_device_seek(ob_device *player, const uint64_t timesta
  */
 OB_EXPORT void ob_playback_device_set_playback_rate(ob_device *player, const float rate, ob_error **error);
 
+/**
+ * @brief Enable or disable the max throughput mode of the playback device.
+ * @brief In max throughput mode the frame timestamps and playback rate are ignored, frames are output as fast as they can be decoded, and the playback
+ * blocks instead of dropping frames when the consumer can not keep up. This is intended for offline reprocessing of recordings.
+ *
+ * @param[in] player The playback device to set the mode for.
+ * @param[in] enable Whether to enable the max throughput mode.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ */
+OB_EXPORT void ob_playback_device_set_max_throughput_mode(ob_device *player, bool enable, ob_error **error);
+
+/**
+ * @brief Check whether the max throughput mode of the playback device is enabled.
+ *
+ * @param[in] player The playback device to check.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ * @return True if the max throughput mode is enabled, otherwise false.
+ */
+OB_EXPORT bool ob_playback_device_is_max_throughput_mode(ob_device *player, ob_error **error);
+
 /**
  * @brief Get the current playback status of the played data.
  *
@@ -136,6 +172,92 @@ OB_EXPORT uint64_t ob_playback_device_get_position(ob_device *player, ob_error *
  */
 OB_EXPORT uint64_t ob_playback_device_get_duration(ob_device *player, ob_error **error);
 
+/**
+ * @brief Create an offline processor for the specified recording file.
+ * @brief The offline processor reads the recording as fast as possible, splits its timeline into segments and processes the segments on a pool of
+ * worker threads with a chain of filters. The results are delivered in recording order for each stream.
+ *
+ * @param[in] file_path The file path of the recording to process.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ * @return A pointer to the newly created offline processor, or NULL if an error occurred.
+ */
+OB_EXPORT ob_offline_processor *ob_create_offline_processor(const char *file_path, ob_error **error);
+
+/**
+ * @brief Delete the offline processor.
+ *
+ * @param[in] processor The offline processor to delete.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ */
+OB_EXPORT void ob_delete_offline_processor(ob_offline_processor *processor, ob_error **error);
+
+/**
+ * @brief Append a filter to the processing chain of the offline processor.
+ * @brief Each worker thread creates its own filter instance with the same name, config values and enable state as the specified filter.
+ *
+ * @param[in] processor The offline processor to add the filter to.
+ * @param[in] filter The filter to add.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ */
+OB_EXPORT void ob_offline_processor_add_filter(ob_offline_processor *processor, ob_filter *filter, ob_error **error);
+
+/**
+ * @brief Set the number of worker threads of the offline processor, the default is the number of CPU cores.
+ *
+ * @param[in] processor The offline processor to set the worker count for.
+ * @param[in] count The number of worker threads.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ */
+OB_EXPORT void ob_offline_processor_set_worker_count(ob_offline_processor *processor, uint32_t count, ob_error **error);
+
+/**
+ * @brief Set the duration of the timeline segments processed by each worker, the default is 1000 milliseconds.
+ *
+ * @param[in] processor The offline processor to set the segment duration for.
+ * @param[in] duration_ms The segment duration, in milliseconds.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ */
+OB_EXPORT void ob_offline_processor_set_segment_duration(ob_offline_processor *processor, uint64_t duration_ms, ob_error **error);
+
+/**
+ * @brief Enable or disable aggregating the frames into framesets before processing, enabled by default.
+ * @brief Filters that need frames of several streams (e.g. Align) require the frame sync to be enabled.
+ *
+ * @param[in] processor The offline processor to set the frame sync for.
+ * @param[in] enable Whether to enable the frame sync.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ */
+OB_EXPORT void ob_offline_processor_enable_frame_sync(ob_offline_processor *processor, bool enable, ob_error **error);
+
+/**
+ * @brief Get the duration of the recording processed by the offline processor.
+ *
+ * @param[in] processor The offline processor to get the duration for.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ * @return The duration of the recording, in milliseconds.
+ */
+OB_EXPORT uint64_t ob_offline_processor_get_duration(ob_offline_processor *processor, ob_error **error);
+
+/**
+ * @brief Process the whole recording, blocks until all the results are delivered or @ref ob_offline_processor_stop is called.
+ *
+ * @attention The callback is called on the calling thread, the frame should be deleted by calling @ref ob_delete_frame() when it is no longer needed.
+ *
+ * @param[in] processor The offline processor to run.
+ * @param[in] callback The callback function to receive the processed frames (or framesets if the frame sync is enabled).
+ * @param[in] user_data User data to pass to the callback function.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ */
+OB_EXPORT void ob_offline_processor_process(ob_offline_processor *processor, ob_frame_callback callback, void *user_data, ob_error **error);
+
+/**
+ * @brief Stop the processing started by @ref ob_offline_processor_process, can be called from the callback or another thread.
+ *
+ * @param[in] processor The offline processor to stop.
+ * @param[out] error Pointer to an error object that will be set if an error occurs.
+ */
+OB_EXPORT void ob_offline_processor_stop(ob_offline_processor *processor, ob_error **error);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
\ No newline at end of file
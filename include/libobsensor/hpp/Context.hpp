@@ -242,6 +242,53 @@ public:
         Error::handle(&error);
     }
 
+    /**
+     * @brief Query the runtime metrics of the SDK (frame memory pool, frame queues, filters and transports), in the Prometheus text exposition
+     * format.
+     *
+     * @return std::string The metrics text.
+     */
+    std::string queryMetrics() const {
+        ob_error *error = nullptr;
+        auto      text  = ob_query_metrics(impl_, &error);
+        Error::handle(&error);
+        return text;
+    }
+
+    /**
+     * @brief Query the value of a runtime metric, summed over all its label sets.
+     *
+     * @param[in] name The name of the metric, as in the text of @ref queryMetrics (e.g. "ob_frame_queue_dropped_frames_total").
+     * @return double The value of the metric, the sample count for a summary, 0 if no metric has the name.
+     */
+    double queryMetricValue(const char *name) const {
+        ob_error *error = nullptr;
+        auto      value = ob_query_metric_value(impl_, name, &error);
+        Error::handle(&error);
+        return value;
+    }
+
+    /**
+     * @brief Start writing the runtime metrics to a local file periodically, in the Prometheus text exposition format.
+     *
+     * @param[in] filePath Path of the metrics file to write, replaced at once on every write.
+     * @param[in] intervalMs The interval between two writes, in milliseconds.
+     */
+    void startMetricsDump(const char *filePath, uint32_t intervalMs) const {
+        ob_error *error = nullptr;
+        ob_start_metrics_dump(impl_, filePath, intervalMs, &error);
+        Error::handle(&error);
+    }
+
+    /**
+     * @brief Stop writing the runtime metrics to the file.
+     */
+    void stopMetricsDump() const {
+        ob_error *error = nullptr;
+        ob_stop_metrics_dump(impl_, &error);
+        Error::handle(&error);
+    }
+
     /**
      * @brief For linux, there are two ways to enable the UVC backend: libuvc and v4l2. This function is used to set the backend type.
      * @brief It is effective when the new device is created.
@@ -349,6 +396,39 @@ public:
         Error::handle(&error);
     }
 
+    /**
+     * @brief Enable or disable the frame trace
+     * @brief While enabled, every frame records the time it reaches each stage of the frame path (see @ref OBFrameTraceStage), read with
+     * @ref Frame::getTraceEvents.
+     *
+     * @param[in] enable Whether to enable the frame trace, disabled by default.
+     */
+    static void enableFrameTrace(bool enable) {
+        ob_error *error = nullptr;
+        ob_enable_frame_trace(enable, &error);
+        Error::handle(&error);
+    }
+
+    /**
+     * @brief Start writing the trace of the frames delivered by the pipelines to a Chrome trace / Perfetto JSON file, enables the frame trace
+     *
+     * @param[in] filePath Path of the trace file to write, replaced if it exists.
+     */
+    static void startFrameTraceExport(const char *filePath) {
+        ob_error *error = nullptr;
+        ob_start_frame_trace_export(filePath, &error);
+        Error::handle(&error);
+    }
+
+    /**
+     * @brief Stop writing the trace of the frames and close the file
+     */
+    static void stopFrameTraceExport() {
+        ob_error *error = nullptr;
+        ob_stop_frame_trace_export(&error);
+        Error::handle(&error);
+    }
+
 private:
     static void deviceChangedCallback(ob_device_list *removedList, ob_device_list *addedList, void *userData) {
         auto cbCtx = static_cast<DeviceChangedCallbackContext *>(userData);
@@ -366,6 +366,42 @@ public:
         return result;
     }
 
+    /**
+     * @brief Set the cache policy of a property
+     * @brief Reads of a cached property are served from the last value read from the device until it expires or is invalidated, see
+     * ob_device_set_property_cache_policy for details.
+     *
+     * @param[in] propertyId The ID of the property
+     * @param[in] policy The cache policy, properties are volatile by default
+     * @param[in] ttlMs The time to live of the cached value in milliseconds, only used by OB_PROPERTY_CACHE_TTL
+     */
+    void setPropertyCachePolicy(OBPropertyID propertyId, OBPropertyCachePolicy policy, uint32_t ttlMs = 0) {
+        ob_error *error = nullptr;
+        ob_device_set_property_cache_policy(impl_, propertyId, policy, ttlMs, &error);
+        Error::handle(&error);
+    }
+
+    /**
+     * @brief Invalidate all cached property values, the next reads go to the device
+     */
+    void invalidatePropertyCache() {
+        ob_error *error = nullptr;
+        ob_device_invalidate_property_cache(impl_, &error);
+        Error::handle(&error);
+    }
+
+    /**
+     * @brief Get the hit and miss counters of the property cache
+     *
+     * @return OBPropertyCacheStatistics The cache statistics
+     */
+    OBPropertyCacheStatistics getPropertyCacheStatistics() const {
+        ob_error *error      = nullptr;
+        auto      statistics = ob_device_get_property_cache_statistics(impl_, &error);
+        Error::handle(&error);
+        return statistics;
+    }
+
     /**
      * @brief Check if the global timestamp is supported for the device
      *
@@ -406,6 +406,20 @@ public:
         setConfigValue("decimate", value);
     }
 
+    /**
+     * @brief Set whether to create the RGBD point cloud from the depth frame not aligned to the color frame.
+     * @brief If enabled, each depth pixel is projected to the color camera and takes the color where it lands, in a single pass without the
+     * aligned depth frame of the Align filter. The points are in the color camera coordinate system, the same as those of the depth aligned to color, but
+     * at the depth resolution and without the occlusion handling of the Align filter.
+     *
+     * @attention This function only works for when create point format is set to OB_FORMAT_RGB_POINT.
+     *
+     * @param[in] state Whether to project the depth to the color camera.
+     */
+    void setAlignToColor(bool state) {
+        setConfigValue("alignToColor", state);
+    }
+
     /**
      * @brief Get the property range of the decimation factor range.
      */
@@ -695,6 +709,114 @@ public:
     }
 };
 
+/**
+ * @brief The depth transform filter applies the threshold, value scale, value offset, mirror, flip and rotation to the depth frames in a single
+ * pass, with the same results as ThresholdFilter, PixelValueScaler, PixelValueOffset, FrameMirror, FrameFlip and FrameRotate applied in this
+ * order. With only the value range set, it behaves as the ThresholdFilter. The scaled values are truncated and wrapped to the pixel size as
+ * in the PixelValueScaler. One difference: the Y8 depth frames are scaled too, while the PixelValueScaler only processes the Y16 frames.
+ */
+class DepthTransformFilter : public Filter {
+public:
+    DepthTransformFilter() {
+        ob_error *error = nullptr;
+        auto      impl  = ob_create_filter("DepthTransformFilter", &error);
+        Error::handle(&error);
+        init(impl);
+    }
+
+    virtual ~DepthTransformFilter() noexcept override = default;
+
+    /**
+     * @brief Set the depth value range in millimeters, the values out of the range are set to 0.
+     */
+    bool setValueRange(uint16_t min, uint16_t max) {
+        if(min >= max) {
+            return false;
+        }
+        setConfigValue("min", min);
+        setConfigValue("max", max);
+        return true;
+    }
+
+    /**
+     * @brief Set the scale factor of the depth values, the value scale of the output frames is updated accordingly.
+     */
+    void setScale(float scale) {
+        setConfigValue("scale", scale);
+    }
+
+    /**
+     * @brief Set the offset of the depth values in bits, a positive offset shifts the values right and a negative one shifts them left.
+     */
+    void setOffset(int offset) {
+        setConfigValue("offset", offset);
+    }
+
+    /**
+     * @brief Mirror the depth frames horizontally.
+     */
+    void setMirror(bool enable) {
+        setConfigValue("mirror", enable);
+    }
+
+    /**
+     * @brief Flip the depth frames vertically.
+     */
+    void setFlip(bool enable) {
+        setConfigValue("flip", enable);
+    }
+
+    /**
+     * @brief Rotate the depth frames clockwise after the mirror and the flip.
+     *
+     * @param[in] degree The rotation angle: 0, 90, 180 or 270.
+     */
+    void setRotation(int degree) {
+        setConfigValue("rotate", degree);
+    }
+};
+
+/**
+ * @brief The frame crop filter crops the frames to a region of interest. The intrinsic of the output frames follows the region, so the filters
+ * applied after it (Align, PointCloudFilter, DecimationFilter, FormatConvertFilter, ...) only process the region.
+ */
+class FrameCropFilter : public Filter {
+public:
+    FrameCropFilter() {
+        ob_error *error = nullptr;
+        auto      impl  = ob_create_filter("FrameCrop", &error);
+        Error::handle(&error);
+        init(impl);
+    }
+
+    virtual ~FrameCropFilter() noexcept override = default;
+
+    /**
+     * @brief Set the region of interest, a zero width or height extends the region to the right or bottom of the frame.
+     * @brief The region is clamped to the frame, and moved to even coordinates for the YUV formats.
+     *
+     * @param[in] region The region in pixels of the input frames.
+     */
+    void setRegion(const OBRect &region) {
+        setConfigValue("x", region.x);
+        setConfigValue("y", region.y);
+        setConfigValue("width", region.width);
+        setConfigValue("height", region.height);
+    }
+
+    /**
+     * @brief Get the region of interest.
+     */
+    OBRect getRegion() {
+        OBRect region;
+        region.x      = static_cast<uint32_t>(getConfigValue("x"));
+        region.y      = static_cast<uint32_t>(getConfigValue("y"));
+        region.width  = static_cast<uint32_t>(getConfigValue("width"));
+        region.height = static_cast<uint32_t>(getConfigValue("height"));
+        return region;
+    }
+};
+
 /**
  * @brief Spatial advanced filte smooths the image by calculating frame with alpha and delta settings
  * alpha defines the weight of the current pixel for smoothing,
@@ -2001,6 +2123,8 @@ inline const std::unordered_map<std::string, std::type_index> &getFilterTypeMap(
         { "FalsePositiveFilter", typeid(FalsePositiveFilter) },
         { "MgcNoiseRemovalFilter", typeid(MgcNoiseRemovalFilter) },
         { "LutNoiseRemovalFilter", typeid(LutNoiseRemovalFilter) },
+        { "DepthTransformFilter", typeid(DepthTransformFilter) },
+        { "FrameCrop", typeid(FrameCropFilter) },
     };
     return filterTypeMap;
 }
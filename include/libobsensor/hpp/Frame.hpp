@@ -16,6 +16,7 @@
 #include <iostream>
 #include <typeinfo>
 #include <functional>
+#include <vector>
 
 /**
  *  Frame classis inheritance hierarchy:
@@ -95,6 +96,20 @@ public:
         return type;
     }
 
+    /**
+     * @brief Get the basic information of the frame in one call, refer to @ref OBFrameInfo
+     *
+     * @return OBFrameInfo The frame information.
+     */
+    OBFrameInfo getInfo() const {
+        ob_error   *error = nullptr;
+        OBFrameInfo info  = {};
+        ob_frame_get_info(impl_, &info, &error);
+        Error::handle(&error);
+
+        return info;
+    }
+
     /**
      * @brief Get the format of the frame.
      *
@@ -254,6 +269,43 @@ public:
         return value;
     }
 
+    /**
+     * @brief Get the values of all metadata types at once, the metadata is decoded at most once per frame
+     *
+     * @param[out] values The array of count items to receive the values, values[n] is 0 if the frame does not contain type n.
+     * @param[out] valid The array of count items, valid[n] is 1 if the frame contains metadata type n, else 0. Can be nullptr.
+     * @param[in] count The capacity of values and valid, OB_FRAME_METADATA_TYPE_COUNT by default.
+     *
+     * @return uint32_t The number of items written, at most count.
+     */
+    uint32_t getAllMetadata(int64_t *values, uint8_t *valid, uint32_t count = OB_FRAME_METADATA_TYPE_COUNT) const {
+        ob_error *error   = nullptr;
+        auto      written = ob_frame_get_all_metadata(impl_, values, valid, count, &error);
+        Error::handle(&error);
+
+        return written;
+    }
+
+    /**
+     * @brief Get the trace events recorded on the frame, in the order they were recorded
+     * @brief The events are only recorded while the frame trace is enabled, see @ref Context::enableFrameTrace. The events of a frameset are recorded
+     * on its frames.
+     *
+     * @return std::vector<OBFrameTraceEvent> The trace events, empty if the frame has not been traced.
+     */
+    std::vector<OBFrameTraceEvent> getTraceEvents() const {
+        ob_error *error = nullptr;
+        auto      count = ob_frame_get_trace_event_count(impl_, &error);
+        Error::handle(&error);
+
+        std::vector<OBFrameTraceEvent> events(count);
+        for(uint32_t i = 0; i < count; i++) {
+            ob_frame_get_trace_event(impl_, i, &events[i], &error);
+            Error::handle(&error);
+        }
+        return events;
+    }
+
     /**
      * @brief get StreamProfile of the frame
      *
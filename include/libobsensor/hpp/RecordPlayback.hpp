@@ -13,6 +13,7 @@
 #include "Error.hpp"
 #include "libobsensor/h/RecordPlayback.h"
 #include "libobsensor/hpp/Device.hpp"
+#include "libobsensor/hpp/Filter.hpp"
 
 namespace ob {
 
@@ -29,6 +30,15 @@ public:
         Error::handle(&error);
     }
 
+    /**
+     * @brief Record with a codec of the depth frames, see @ref OBRecordDepthCodec
+     */
+    RecordDevice(std::shared_ptr<Device> device, const std::string &file, bool compressionEnabled, OBRecordDepthCodec depthCodec) {
+        ob_error *error = nullptr;
+        impl_           = ob_create_record_device_ex(device->getImpl(), file.c_str(), compressionEnabled, depthCodec, &error);
+        Error::handle(&error);
+    }
+
     virtual ~RecordDevice() noexcept {
         ob_error *error = nullptr;
         ob_delete_record_device(impl_, &error);
@@ -127,6 +137,28 @@ public:
         Error::handle(&error);
     }
 
+    /**
+     * @brief Enable or disable the max throughput mode of the playback device.
+     * @brief In max throughput mode the frame timestamps are ignored and frames are output as fast as the consumer can accept them.
+     * @param[in] enable Whether to enable the max throughput mode.
+     */
+    void setMaxThroughputMode(bool enable) {
+        ob_error *error = nullptr;
+        ob_playback_device_set_max_throughput_mode(impl_, enable, &error);
+        Error::handle(&error);
+    }
+
+    /**
+     * @brief Check whether the max throughput mode of the playback device is enabled.
+     * @return True if the max throughput mode is enabled, otherwise false.
+     */
+    bool isMaxThroughputMode() const {
+        ob_error *error  = nullptr;
+        bool      enable = ob_playback_device_is_max_throughput_mode(impl_, &error);
+        Error::handle(&error);
+        return enable;
+    }
+
     /**
      * @brief Set a callback function to be called when the playback status changes.
      * @param[in] callback The callback function to set.
@@ -185,4 +217,118 @@ private:
 private:
     PlaybackStatusChangeCallback callback_;
 };
+
+/**
+ * @brief Process a recording file offline with a chain of filters, using all CPU cores.
+ * @brief The timeline of the recording is split into segments which are processed in parallel, the results are delivered in recording order for each
+ * stream.
+ */
+class OfflineProcessor {
+public:
+    typedef std::function<void(std::shared_ptr<Frame> frame)> FrameCallback;
+
+private:
+    ob_offline_processor *impl_ = nullptr;
+    FrameCallback         callback_;
+
+public:
+    explicit OfflineProcessor(const std::string &filePath) {
+        ob_error *error = nullptr;
+        impl_           = ob_create_offline_processor(filePath.c_str(), &error);
+        Error::handle(&error);
+    }
+
+    virtual ~OfflineProcessor() noexcept {
+        ob_error *error = nullptr;
+        ob_delete_offline_processor(impl_, &error);
+        Error::handle(&error, false);
+    }
+
+    OfflineProcessor(const OfflineProcessor &)            = delete;
+    OfflineProcessor &operator=(const OfflineProcessor &) = delete;
+
+    /**
+     * @brief Append a filter to the processing chain, each worker uses its own copy of the filter.
+     * @param[in] filter The filter to add.
+     */
+    void addFilter(std::shared_ptr<Filter> filter) {
+        ob_error *error = nullptr;
+        ob_offline_processor_add_filter(impl_, filter->getImpl(), &error);
+        Error::handle(&error);
+    }
+
+    /**
+     * @brief Set the number of worker threads, the default is the number of CPU cores.
+     * @param[in] count The number of worker threads.
+     */
+    void setWorkerCount(uint32_t count) {
+        ob_error *error = nullptr;
+        ob_offline_processor_set_worker_count(impl_, count, &error);
+        Error::handle(&error);
+    }
+
+    /**
+     * @brief Set the duration of the timeline segments processed by each worker.
+     * @param[in] durationMs The segment duration, in milliseconds.
+     */
+    void setSegmentDuration(uint64_t durationMs) {
+        ob_error *error = nullptr;
+        ob_offline_processor_set_segment_duration(impl_, durationMs, &error);
+        Error::handle(&error);
+    }
+
+    /**
+     * @brief Enable or disable aggregating the frames into framesets before processing.
+     * @param[in] enable Whether to enable the frame sync.
+     */
+    void enableFrameSync(bool enable) {
+        ob_error *error = nullptr;
+        ob_offline_processor_enable_frame_sync(impl_, enable, &error);
+        Error::handle(&error);
+    }
+
+    /**
+     * @brief Get the duration of the recording.
+     * @return The duration of the recording, in milliseconds.
+     */
+    uint64_t getDuration() const {
+        ob_error *error    = nullptr;
+        uint64_t  duration = ob_offline_processor_get_duration(impl_, &error);
+        Error::handle(&error);
+        return duration;
+    }
+
+    /**
+     * @brief Process the whole recording, blocks until all the results are delivered or stop() is called.
+     * @param[in] callback The callback to receive the processed frames, called on the calling thread.
+     */
+    void process(FrameCallback callback) {
+        callback_       = callback;
+        ob_error *error = nullptr;
+        ob_offline_processor_process(impl_, &OfflineProcessor::frameCallback, this, &error);
+        Error::handle(&error);
+    }
+
+    /**
+     * @brief Stop the processing, can be called from the callback or another thread.
+     */
+    void stop() {
+        ob_error *error = nullptr;
+        ob_offline_processor_stop(impl_, &error);
+        Error::handle(&error);
+    }
+
+private:
+    static void frameCallback(ob_frame *frame, void *userData) {
+        auto *processor = static_cast<OfflineProcessor *>(userData);
+        if(processor && processor->callback_) {
+            processor->callback_(std::make_shared<Frame>(frame));
+        }
+        else {
+            ob_error *error = nullptr;
+            ob_delete_frame(frame, &error);
+            Error::handle(&error, false);
+        }
+    }
+};
 }  // namespace ob
\ No newline at end of file
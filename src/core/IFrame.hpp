@@ -4,6 +4,8 @@
 #pragma once
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include <functional>
 
 #include "libobsensor/h/ObTypes.h"
@@ -31,6 +33,10 @@ public:
     virtual void                                  registerParser(OBFrameMetadataType type, std::shared_ptr<IFrameMetadataParser> phaser) = 0;
     virtual bool                                  isContained(OBFrameMetadataType type)                                                  = 0;
     virtual std::shared_ptr<IFrameMetadataParser> get(OBFrameMetadataType type)                                                          = 0;
+
+    // Parse all registered types not in skipMask in one pass over the parsers; values[type] is written and bit (1 << type) of the returned mask is
+    // set for every type contained in the metadata
+    virtual uint64_t parseAll(const uint8_t *metadata, size_t dataSize, int64_t *values, uint64_t skipMask) = 0;
 };
 
 }  // namespace libobsensor
@@ -41,6 +47,19 @@ extern "C" {
 struct ob_frame_t {
     std::shared_ptr<libobsensor::Frame> frame;
     std::atomic<int>                    refCnt = { 1 };
+
+    // Handles of the frameset members returned to the user. Each one holds a reference of its own, so the same handle is returned again
+    // while the member is unchanged instead of allocating a new one per access.
+    std::mutex                childHandlesMutex;
+    std::vector<ob_frame_t *> childHandles;
+
+    ~ob_frame_t() noexcept {
+        for(auto handle: childHandles) {
+            if(handle->refCnt.fetch_sub(1) <= 1) {
+                delete handle;
+            }
+        }
+    }
 };
 #ifdef __cplusplus
 }
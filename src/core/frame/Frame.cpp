@@ -7,6 +7,9 @@
 #include "stream/StreamProfile.hpp"
 #include "frame/FrameMemoryPool.hpp"
 #include "frame/FrameBufferManager.hpp"
+#include "frame/FrameLatencyTracer.hpp"
+
+#include <algorithm>
 
 namespace libobsensor {
 
@@ -25,14 +28,24 @@ Frame::Frame(uint8_t *data, size_t dataBufSize, OBFrameType type, FrameBufferRec
       timeStampUsec_(0),
       systemTimeStampUsec_(0),
       globalTimeStampUsec_(0),
+      arrivalTimeUsec_(0),
       metadataSize_(0),
       metadata_{},
       metadataPhasers_(nullptr),
       streamProfile_(nullptr),
+      metadataValidMask_(0),
+      metadataDecodedMask_(0),
       type_(type),
+      dataBuf_(data),
       frameData_(data),
       dataBufSize_(dataBufSize),
-      bufferReclaimFunc_(bufferReclaimFunc) {}
+      bufferReclaimFunc_(bufferReclaimFunc),
+      dataShared_(false) {
+    static_assert(OB_FRAME_METADATA_TYPE_COUNT <= 64, "metadata type masks are 64 bit");
+    for(auto &value: metadataValues_) {
+        value.store(0, std::memory_order_relaxed);
+    }
+}
 
 Frame::Frame(uint8_t *data, size_t dataBufSize, FrameBufferReclaimFunc bufferReclaimFunc) : Frame(data, dataBufSize, OB_FRAME_UNKNOWN, bufferReclaimFunc) {}
 
@@ -41,7 +54,7 @@ Frame::~Frame() noexcept {
         bufferReclaimFunc_();
     }
     else {
-        delete[] frameData_;
+        delete[] dataBuf_;
     }
 }
 
@@ -56,6 +69,22 @@ OBFormat Frame::getFormat() const {
     return streamProfile_->getFormat();
 }
 
+void Frame::getInfo(OBFrameInfo &info) const {
+    info.type              = type_;
+    info.format            = getFormat();
+    info.index             = number_;
+    info.data              = const_cast<uint8_t *>(getData());  // read-only, a shared data buffer is not copied
+    info.dataSize          = static_cast<uint32_t>(dataSize_);
+    info.metadata          = const_cast<uint8_t *>(metadata_);
+    info.metadataSize      = static_cast<uint32_t>(metadataSize_);
+    info.timestampUs       = getTimeStampUsec();
+    info.systemTimestampUs = getSystemTimeStampUsec();
+    info.globalTimestampUs = getGlobalTimeStampUsec();
+    info.width             = 0;
+    info.height            = 0;
+    info.strideBytes       = 0;
+}
+
 uint64_t Frame::getNumber() const {
     return number_;
 }
@@ -73,19 +102,52 @@ void Frame::setDataSize(size_t dataSize) {
 }
 
 const uint8_t *Frame::getData() const {
-    return frameData_;
+    return frameData_.load(std::memory_order_acquire);
 }
 
 uint8_t *Frame::getDataMutable() const {
-    return const_cast<uint8_t *>(frameData_);
+    if(dataShared_) {
+        detachSharedData(0, true);
+    }
+    return const_cast<uint8_t *>(frameData_.load(std::memory_order_acquire));
 }
 
 void Frame::updateData(const uint8_t *data, size_t dataSize) {
-    if(dataSize > dataBufSize_) {
-        THROW_MEMORY_EXCEPTION(utils::string::to_string() << "Update data size(" << dataSize << ") > data buffer size! (" << dataBufSize_ << ")");
+    if(dataShared_) {
+        // the old data is replaced, a buffer of the new size is enough
+        detachSharedData(dataSize, false);
+    }
+    size_t bufSize = dataBufSize_;
+    if(dataSize > bufSize) {
+        THROW_MEMORY_EXCEPTION(utils::string::to_string() << "Update data size(" << dataSize << ") > data buffer size! (" << bufSize << ")");
     }
     dataSize_ = dataSize;
-    memcpy(const_cast<uint8_t *>(frameData_), data, dataSize);
+    memcpy(const_cast<uint8_t *>(frameData_.load(std::memory_order_acquire)), data, dataSize);
+}
+
+void Frame::markDataShared() const {
+    dataShared_ = true;
+}
+
+bool Frame::isDataShared() const {
+    return dataShared_;
+}
+
+void Frame::detachSharedData(size_t minBufSize, bool copyData) const {
+    std::lock_guard<std::mutex> lock(dataDetachMutex_);
+    if(!dataShared_) {
+        return;
+    }
+    // The shared buffer stays owned by this frame (dataBuf_) until it is destroyed, readers may still use it.
+    auto                       bufSize = std::max(minBufSize, dataBufSize_.load());
+    std::unique_ptr<uint8_t[]> data(new uint8_t[bufSize]);
+    if(copyData) {
+        memcpy(data.get(), frameData_.load(), std::min(dataSize_, bufSize));
+    }
+    detachedData_ = std::move(data);
+    dataBufSize_  = bufSize;
+    frameData_.store(detachedData_.get(), std::memory_order_release);
+    dataShared_ = false;
 }
 
 uint64_t Frame::getTimeStampUsec() const {
@@ -112,6 +174,22 @@ void Frame::setGlobalTimeStampUsec(uint64_t ts) {
     globalTimeStampUsec_ = ts;
 }
 
+uint64_t Frame::getArrivalTimeUsec() const {
+    return arrivalTimeUsec_;
+}
+
+void Frame::setArrivalTimeUsec(uint64_t ts) {
+    arrivalTimeUsec_ = ts;
+}
+
+std::shared_ptr<FrameTrace> Frame::getTrace() const {
+    return trace_;
+}
+
+void Frame::setTrace(std::shared_ptr<FrameTrace> trace) {
+    trace_ = trace;
+}
+
 uint32_t VideoFrame::getFps() const {
     if(!streamProfile_) {
         THROW_INVALID_DATA_EXCEPTION("Error: this frame dose not have a stream profile!");
@@ -161,6 +239,7 @@ size_t Frame::getMetadataSize() const {
 
 void Frame::setMetadataSize(size_t metadataSize) {
     metadataSize_ = metadataSize;
+    resetMetadataValueCache();
 }
 
 void Frame::updateMetadata(const uint8_t *metadata, size_t metadataSize) {
@@ -173,6 +252,7 @@ void Frame::updateMetadata(const uint8_t *metadata, size_t metadataSize) {
     }
     memcpy(metadata_, metadata, metadataSize);
     metadataSize_ = metadataSize;
+    resetMetadataValueCache();
 }
 
 void Frame::appendMetadata(const uint8_t *metadata, size_t metadataSize) {
@@ -185,6 +265,7 @@ void Frame::appendMetadata(const uint8_t *metadata, size_t metadataSize) {
     }
     memcpy(metadata_ + metadataSize_, metadata, metadataSize);
     metadataSize_ += metadataSize;
+    resetMetadataValueCache();
 }
 
 const uint8_t *Frame::getMetadata() const {
@@ -192,17 +273,24 @@ const uint8_t *Frame::getMetadata() const {
 }
 
 uint8_t *Frame::getMetadataMutable() const {
+    // the caller may change the metadata
+    resetMetadataValueCache();
     return const_cast<uint8_t *>(metadata_);
 }
 
 void Frame::registerMetadataParsers(std::shared_ptr<IFrameMetadataParserContainer> parsers) {
     metadataPhasers_ = parsers;
+    resetMetadataValueCache();
 }
 
 bool Frame::hasMetadata(OBFrameMetadataType type) const {
     if(!metadataPhasers_) {
         return false;
     }
+    uint64_t bit = type < OB_FRAME_METADATA_TYPE_COUNT ? 1ULL << type : 0;
+    if(metadataDecodedMask_.load(std::memory_order_acquire) & bit) {
+        return (metadataValidMask_.load(std::memory_order_relaxed) & bit) != 0;
+    }
     if(!metadataPhasers_->isContained(type)) {
         return false;
     }
@@ -215,11 +303,58 @@ int64_t Frame::getMetadataValue(OBFrameMetadataType type) const {
         THROW_UNSUPPORTED_OPERATION_EXCEPTION(utils::string::to_string()
                                               << "Metadata phasers are not registered! Unsupported to get metadata for type: " << type);
     }
+    uint64_t bit = type < OB_FRAME_METADATA_TYPE_COUNT ? 1ULL << type : 0;
+    if((metadataDecodedMask_.load(std::memory_order_acquire) & bit) && (metadataValidMask_.load(std::memory_order_relaxed) & bit)) {
+        return metadataValues_[type].load(std::memory_order_relaxed);
+    }
+
     auto parser = metadataPhasers_->get(type);
     if(!parser->isSupported(metadata_, metadataSize_)) {
+        metadataDecodedMask_.fetch_or(bit, std::memory_order_release);
         THROW_UNSUPPORTED_OPERATION_EXCEPTION(utils::string::to_string() << "Current metadata does not contain metadata for type: " << type);
     }
-    return parser->getValue(metadata_, metadataSize_);
+    auto value = parser->getValue(metadata_, metadataSize_);
+    if(bit) {
+        metadataValues_[type].store(value, std::memory_order_relaxed);
+        metadataValidMask_.fetch_or(bit, std::memory_order_relaxed);
+        metadataDecodedMask_.fetch_or(bit, std::memory_order_release);
+    }
+    return value;
+}
+
+uint32_t Frame::getAllMetadataValues(int64_t *values, uint8_t *valid, uint32_t count) const {
+    const uint64_t allTypesMask = (OB_FRAME_METADATA_TYPE_COUNT == 64) ? ~0ULL : (1ULL << OB_FRAME_METADATA_TYPE_COUNT) - 1;
+
+    auto decodedMask = metadataDecodedMask_.load(std::memory_order_acquire);
+    if(metadataPhasers_ && decodedMask != allTypesMask) {
+        // decode the types that have not been queried yet in one pass over the parsers
+        int64_t parsedValues[OB_FRAME_METADATA_TYPE_COUNT] = {};
+        auto    parsedMask                                 = metadataPhasers_->parseAll(metadata_, metadataSize_, parsedValues, decodedMask);
+        for(uint32_t type = 0; type < OB_FRAME_METADATA_TYPE_COUNT; type++) {
+            if(parsedMask & (1ULL << type)) {
+                metadataValues_[type].store(parsedValues[type], std::memory_order_relaxed);
+            }
+        }
+        metadataValidMask_.fetch_or(parsedMask, std::memory_order_relaxed);
+        metadataDecodedMask_.fetch_or(allTypesMask, std::memory_order_release);
+    }
+
+    // an application built against another version may pass a different count
+    auto     written   = std::min<uint32_t>(count, OB_FRAME_METADATA_TYPE_COUNT);
+    uint64_t validMask = metadataPhasers_ ? metadataValidMask_.load(std::memory_order_relaxed) : 0;
+    for(uint32_t type = 0; type < written; type++) {
+        bool isValid = (validMask & (1ULL << type)) != 0;
+        values[type] = isValid ? metadataValues_[type].load(std::memory_order_relaxed) : 0;
+        if(valid) {
+            valid[type] = isValid ? 1 : 0;
+        }
+    }
+    return written;
+}
+
+void Frame::resetMetadataValueCache() const {
+    metadataDecodedMask_.store(0, std::memory_order_release);
+    metadataValidMask_.store(0, std::memory_order_relaxed);
 }
 
 std::shared_ptr<const StreamProfile> Frame::getStreamProfile() const {
@@ -235,10 +370,13 @@ void Frame::copyInfoFromOther(const std::shared_ptr<const Frame> otherFrame) {
     timeStampUsec_       = otherFrame->timeStampUsec_;
     systemTimeStampUsec_ = otherFrame->systemTimeStampUsec_;
     globalTimeStampUsec_ = otherFrame->globalTimeStampUsec_;
+    arrivalTimeUsec_     = otherFrame->arrivalTimeUsec_;
+    trace_               = otherFrame->trace_ ? std::make_shared<FrameTrace>(*otherFrame->trace_) : nullptr;  // the frames may go separate ways
 
     metadataSize_ = otherFrame->metadataSize_;
     memcpy(metadata_, otherFrame->metadata_, metadataSize_);
     metadataPhasers_ = otherFrame->metadataPhasers_;
+    resetMetadataValueCache();
 }
 
 size_t Frame::getDataBufSize() const {
@@ -271,6 +409,16 @@ void VideoFrame::setPixelAvailableBitSize(uint8_t bitSize) {
     availablePixelBitSize_ = bitSize;
 }
 
+void VideoFrame::getInfo(OBFrameInfo &info) const {
+    Frame::getInfo(info);
+    auto videoProfile = dynamic_cast<const VideoStreamProfile *>(streamProfile_.get());
+    if(videoProfile) {
+        info.width  = videoProfile->getWidth();
+        info.height = videoProfile->getHeight();
+    }
+    info.strideBytes = stride_ > 0 ? stride_ : utils::calcDefaultStrideBytes(info.format, info.width);
+}
+
 void VideoFrame::copyInfoFromOther(std::shared_ptr<const Frame> sourceFrame) {
     Frame::copyInfoFromOther(sourceFrame);
     if(sourceFrame->is<VideoFrame>()) {
@@ -357,6 +505,22 @@ uint32_t PointsFrame::getHeight() const {
     return height_;
 }
 
+void PointsFrame::getInfo(OBFrameInfo &info) const {
+    Frame::getInfo(info);
+    info.width  = width_;
+    info.height = height_;
+}
+
+void PointsFrame::copyInfoFromOther(std::shared_ptr<const Frame> sourceFrame) {
+    Frame::copyInfoFromOther(sourceFrame);
+    if(sourceFrame->is<PointsFrame>()) {
+        auto pf          = sourceFrame->as<PointsFrame>();
+        coordValueScale_ = pf->coordValueScale_;
+        width_           = pf->width_;
+        height_          = pf->height_;
+    }
+}
+
 AccelFrame::AccelFrame(uint8_t *data, size_t dataBufSize, FrameBufferReclaimFunc bufferReclaimFunc)
     : Frame(data, dataBufSize, OB_FRAME_ACCEL, bufferReclaimFunc) {}
 
@@ -38,6 +38,7 @@ class DepthFrame;
 class IRFrame;
 class AccelFrame;
 class GyroFrame;
+class FrameTrace;
 
 using FrameBufferReclaimFunc = std::function<void(void)>;
 
@@ -54,7 +55,7 @@ public:
     size_t         getDataSize() const;
     void           setDataSize(size_t dataSize);
     const uint8_t *getData() const;
-    uint8_t       *getDataMutable() const;
+    uint8_t       *getDataMutable() const;  // a shared data buffer is copied first, see markDataShared
     void           updateData(const uint8_t *data, size_t dataSize);
     uint64_t       getTimeStampUsec() const;
     void           setTimeStampUsec(uint64_t ts);
@@ -62,6 +63,12 @@ public:
     void           setSystemTimeStampUsec(uint64_t ts);
     uint64_t       getGlobalTimeStampUsec() const;
     void           setGlobalTimeStampUsec(uint64_t ts);
+    // host steady clock time the frame entered the SDK, only set while the FrameLatencyTracer is enabled
+    uint64_t       getArrivalTimeUsec() const;
+    void           setArrivalTimeUsec(uint64_t ts);
+    // the stages the frame went through, only set while the frame trace of the FrameLatencyTracer is enabled
+    std::shared_ptr<FrameTrace> getTrace() const;
+    void                        setTrace(std::shared_ptr<FrameTrace> trace);
 
     size_t         getMetadataSize() const;
     void           updateMetadata(const uint8_t *metadata, size_t metadataSize);
@@ -74,15 +81,27 @@ public:
     void    registerMetadataParsers(std::shared_ptr<IFrameMetadataParserContainer> parsers);
     bool    hasMetadata(OBFrameMetadataType type) const;
     int64_t getMetadataValue(OBFrameMetadataType type) const;
+    // writes at most count items to values and valid (if not null, 1 for the types the frame contains), returns the number written
+    uint32_t getAllMetadataValues(int64_t *values, uint8_t *valid, uint32_t count) const;
 
     std::shared_ptr<const StreamProfile> getStreamProfile() const;
     void                                 setStreamProfile(std::shared_ptr<const StreamProfile> streamProfile);
     OBFormat                             getFormat() const;  // get from stream profile
 
+    // The data buffer is shared with other frames (see FrameFactory::createFrameView), the view and its source are both marked.
+    // The data is copied to a buffer of this frame before the first write through getDataMutable or updateData. Reads never copy: getData,
+    // ob_frame_get_data and getInfo return the current buffer, read-only by contract. The shared buffer is kept until the frame is destroyed,
+    // so the pointers returned before the copy stay valid.
+    void markDataShared() const;
+    bool isDataShared() const;
+
+    // fill the basic information of the frame at once, without throwing for frames that have no stream profile
+    virtual void getInfo(OBFrameInfo &info) const;
+
     virtual void copyInfoFromOther(std::shared_ptr<const Frame> otherFrame);
 
     template <typename T> bool is() const {
-        return std::dynamic_pointer_cast<const T>(shared_from_this()) != nullptr;
+        return dynamic_cast<const T *>(this) != nullptr;
     }
 
     // template <typename T> bool               is(){
@@ -90,22 +109,25 @@ public:
     // }
 
     template <typename T> std::shared_ptr<T> as() {
-        if(!is<T>()) {
+        auto ptr = std::dynamic_pointer_cast<T>(shared_from_this());
+        if(!ptr) {
             THROW_UNSUPPORTED_OPERATION_EXCEPTION("unsupported operation, object's type is not require type");
         }
-
-        return std::dynamic_pointer_cast<T>(shared_from_this());
+        return ptr;
     }
 
     template <typename T> std::shared_ptr<const T> as() const {
-        if(!is<const T>())
+        auto ptr = std::dynamic_pointer_cast<const T>(shared_from_this());
+        if(!ptr) {
             THROW_UNSUPPORTED_OPERATION_EXCEPTION("unsupported operation, object's type is not require type");
-
-        return std::dynamic_pointer_cast<const T>(shared_from_this());
+        }
+        return ptr;
     }
 
 protected:
     size_t getDataBufSize() const;
+    void   resetMetadataValueCache() const;
+    void   detachSharedData(size_t minBufSize, bool copyData) const;
 
 protected:
     size_t                                         dataSize_;
@@ -113,17 +135,29 @@ protected:
     uint64_t                                       timeStampUsec_;
     uint64_t                                       systemTimeStampUsec_;
     uint64_t                                       globalTimeStampUsec_;
+    uint64_t                                       arrivalTimeUsec_;
+    std::shared_ptr<FrameTrace>                    trace_;
     size_t                                         metadataSize_;
     uint8_t                                        metadata_[12 + 255];  // standard uvc payload size is 12bytes, add some extra space for metadata
     std::shared_ptr<IFrameMetadataParserContainer> metadataPhasers_;
     std::shared_ptr<const StreamProfile>           streamProfile_;
 
+    // Metadata values decoded so far, so that every type is parsed at most once per frame. A value is written before its bit is set in
+    // metadataDecodedMask_ (release), so readers that see the bit (acquire) also see the value.
+    mutable std::atomic<int64_t>  metadataValues_[OB_FRAME_METADATA_TYPE_COUNT];
+    mutable std::atomic<uint64_t> metadataValidMask_;
+    mutable std::atomic<uint64_t> metadataDecodedMask_;
+
     const OBFrameType type_;  // Determined during construction, it is an inherent property of the object and cannot be changed.
 
 private:
-    uint8_t const         *frameData_;
-    const size_t           dataBufSize_;
-    FrameBufferReclaimFunc bufferReclaimFunc_;
+    uint8_t *const                       dataBuf_;  // buffer given at construction, released by bufferReclaimFunc_ or deleted
+    mutable std::atomic<const uint8_t *> frameData_;  // dataBuf_, or detachedData_ once the shared data was copied
+    mutable std::atomic<size_t>          dataBufSize_;
+    mutable std::unique_ptr<uint8_t[]>   detachedData_;
+    FrameBufferReclaimFunc               bufferReclaimFunc_;
+    mutable std::atomic<bool>            dataShared_;
+    mutable std::mutex                   dataDetachMutex_;
 };
 
 class VideoFrame : public Frame {
@@ -143,6 +177,8 @@ public:
     uint8_t     getPixelAvailableBitSize() const;
     void        setPixelAvailableBitSize(uint8_t bitSize);
 
+    void getInfo(OBFrameInfo &info) const override;
+
     virtual void copyInfoFromOther(std::shared_ptr<const Frame> sourceFrame) override;
 
 protected:
@@ -216,6 +252,10 @@ public:
     void     setHeight(uint32_t height);
     uint32_t getHeight() const;
 
+    void getInfo(OBFrameInfo &info) const override;
+
+    virtual void copyInfoFromOther(std::shared_ptr<const Frame> sourceFrame) override;
+
 private:
     float    coordValueScale_;  // coordinate value scale, multiply by this value to get actual coordinate value in mm
     uint32_t width_;
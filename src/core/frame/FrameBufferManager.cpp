@@ -12,7 +12,14 @@ namespace libobsensor {
 
 #define DEFAULT_MAX_FRAME_MEMORY_SIZE ((uint64_t)2 * 1024 * 1024 * 1024)  // 2GB
 
-FrameMemoryAllocator::FrameMemoryAllocator() : maxSizeInByte_(DEFAULT_MAX_FRAME_MEMORY_SIZE), usedSize_(0), logger_(Logger::getInstance()) {
+FrameMemoryAllocator::FrameMemoryAllocator()
+    : maxSizeInByte_(DEFAULT_MAX_FRAME_MEMORY_SIZE), usedSize_(0), logger_(Logger::getInstance()), metricsRegistry_(MetricsRegistry::getInstance()) {
+    usedSizeGauge_            = metricsRegistry_->getGauge("ob_frame_memory_used_bytes", "Memory allocated for the frame buffers, in bytes.");
+    maxSizeGauge_             = metricsRegistry_->getGauge("ob_frame_memory_max_bytes", "Limit of the memory allocated for the frame buffers, in bytes.");
+    allocationCounter_        = metricsRegistry_->getCounter("ob_frame_memory_allocations_total", "Frame buffers allocated.");
+    allocationFailureCounter_ = metricsRegistry_->getCounter("ob_frame_memory_allocation_failures_total",
+                                                             "Frame buffers not allocated because the memory limit was reached or malloc failed.");
+
     auto envConfig = EnvConfig::getInstance();
 
     if(envConfig->isNodeContained("Memory.MaxFrameBufferSize")) {
@@ -24,6 +31,7 @@ FrameMemoryAllocator::FrameMemoryAllocator() : maxSizeInByte_(DEFAULT_MAX_FRAME_
         }
         maxSizeInByte_ = static_cast<uint64_t>(frameBufferSize) * 1024 * 1024;  // MB to Byte
     }
+    maxSizeGauge_->set(static_cast<int64_t>(maxSizeInByte_));
     LOG_DEBUG("FrameMemoryAllocator created! The max frame memory size has been set to {:.3f}MB", byteToMB(maxSizeInByte_));
 }
 
@@ -56,6 +64,7 @@ void FrameMemoryAllocator::setMaxFrameMemorySize(uint64_t sizeInMb) {
         LOG_WARN("The size you is less than 100MB, size={:.3f}MB, will set to 100MB instead", (double)sizeInMb);
         maxSizeInByte_ = 100 * 1024 * 1024;
     }
+    maxSizeGauge_->set(static_cast<int64_t>(maxSizeInByte_));
     LOG_DEBUG("FrameMemoryAllocator max frame memory size has been set to {:.3f}MB", byteToMB(maxSizeInByte_));
 }
 
@@ -64,17 +73,21 @@ uint8_t *FrameMemoryAllocator::allocate(size_t size) {
     if(usedSize_ + size > maxSizeInByte_) {
         LOG_WARN("FrameMemoryAllocator out of memory! require={0:.3f}MB, total usage: allocated={1:.3f}MB, max limit={2:.3f}MB", byteToMB(size),
                  byteToMB(usedSize_), byteToMB(maxSizeInByte_));
+        allocationFailureCounter_->add();
         return nullptr;
     }
 
     void *ptr = malloc(size);
     if(ptr == nullptr || reinterpret_cast<uintptr_t>(ptr) == 0xdddddddd) {
         LOG_ERROR("FrameMemoryAllocator malloc failed! ptr={0:x}", (uintptr_t)ptr);
+        allocationFailureCounter_->add();
         return nullptr;
     }
 
     memset(ptr, 0, size);
     usedSize_ += size;
+    usedSizeGauge_->set(static_cast<int64_t>(usedSize_));
+    allocationCounter_->add();
     LOG_DEBUG("New frame buffer allocated={0:.3f}MB, total usage: allocated={1:.3f}MB, max limit={2:.3f}MB", byteToMB(size), byteToMB(usedSize_),
               byteToMB(maxSizeInByte_));
     return (uint8_t *)ptr;
@@ -83,15 +96,26 @@ uint8_t *FrameMemoryAllocator::allocate(size_t size) {
 void FrameMemoryAllocator::deallocate(uint8_t *ptr, size_t size) {
     std::unique_lock<std::mutex> lock(mutex_);
     usedSize_ -= size;
+    usedSizeGauge_->set(static_cast<int64_t>(usedSize_));
     free(ptr);
     LOG_DEBUG("Frame buffer released={0:.3f}MB, total usage: allocated={1:.3f}MB, max limit={2:.3f}MB", byteToMB(size), byteToMB(usedSize_),
               byteToMB(maxSizeInByte_));
 }
 
 FrameBufferManagerBase::FrameBufferManagerBase(size_t frameDataBufferSize, size_t frameObjSize)
-    : frameDataBufferSize_(frameDataBufferSize), frameObjSize_(frameObjSize), frameMemoryAllocator_(FrameMemoryAllocator::getInstance()) {
+    : frameDataBufferSize_(frameDataBufferSize),
+      frameObjSize_(frameObjSize),
+      frameMemoryAllocator_(FrameMemoryAllocator::getInstance()),
+      metricsRegistry_(MetricsRegistry::getInstance()) {
     frameTotalSize_ = frameDataBufferSize_ + frameObjSize_ + FRAME_DATA_ALIGN_IN_BYTE
                       - 1;  // Apply for more FRAME_DATA_ALIGN_IN_BYTE-1 to facilitate offset part of the data address and achieve alignment
+
+    MetricLabels labels    = { { "buffer_size", std::to_string(frameTotalSize_) }, { "id", MetricsRegistry::newInstanceId() } };
+    allocatedBuffersGauge_ = metricsRegistry_->getGauge("ob_frame_buffer_manager_allocated_buffers", "Frame buffers allocated by the manager.", labels);
+    idleBuffersGauge_      = metricsRegistry_->getGauge("ob_frame_buffer_manager_idle_buffers", "Frame buffers of the manager ready for reuse.", labels);
+    acquireCounter_        = metricsRegistry_->getCounter("ob_frame_buffer_acquires_total", "Frame buffers acquired from the frame memory pool.");
+    acquireMissCounter_    = metricsRegistry_->getCounter("ob_frame_buffer_acquire_misses_total",
+                                                          "Frame buffers acquired from the frame memory pool without an idle buffer to reuse.");
 }
 
 FrameBufferManagerBase::~FrameBufferManagerBase() noexcept {
@@ -106,11 +130,14 @@ FrameBufferManagerBase::~FrameBufferManagerBase() noexcept {
 uint8_t *FrameBufferManagerBase::acquireBuffer() {
     std::unique_lock<std::recursive_mutex> lock_(mutex_);
     uint8_t                               *bufferPtr = nullptr;
+    acquireCounter_->add();
     if(!availableFrameBuffers_.empty()) {
         bufferPtr = *availableFrameBuffers_.begin();
         availableFrameBuffers_.erase(availableFrameBuffers_.begin());
+        idleBuffersGauge_->add(-1);
     }
     else {
+        acquireMissCounter_->add();
         bufferPtr = frameMemoryAllocator_->allocate(frameTotalSize_);
         if(bufferPtr == nullptr) {
             LOG_WARN("allocBuffer failed! Will retry after release idle memory on FrameMemoryPool");
@@ -123,6 +150,7 @@ uint8_t *FrameBufferManagerBase::acquireBuffer() {
                 THROW_MEMORY_EXCEPTION(msg);
             }
         }
+        allocatedBuffersGauge_->add(1);
     }
     return bufferPtr;
 }
@@ -141,7 +169,9 @@ void FrameBufferManagerBase::reclaimBuffer(void *buffer) {
         // The current buffer cannot be deleted directly, which will cause frame destruction and crash.
         frameMemoryAllocator_->deallocate(availableFrameBuffers_.front(), frameTotalSize_);
         availableFrameBuffers_.erase(availableFrameBuffers_.begin());
+        allocatedBuffersGauge_->add(-1);
     }
+    idleBuffersGauge_->set(static_cast<int64_t>(availableFrameBuffers_.size()));
 }
 
 void FrameBufferManagerBase::releaseIdleBuffer() {
@@ -151,7 +181,9 @@ void FrameBufferManagerBase::releaseIdleBuffer() {
         // The current buffer cannot be deleted directly, which will cause frame destruction and crash.
         frameMemoryAllocator_->deallocate(availableFrameBuffers_.front(), frameTotalSize_);
         availableFrameBuffers_.erase(availableFrameBuffers_.begin());
+        allocatedBuffersGauge_->add(-1);
     }
+    idleBuffersGauge_->set(0);
 }
 
 }  // namespace libobsensor
@@ -8,6 +8,7 @@
 #include <vector>
 #include "frame/Frame.hpp"
 #include "logger/Logger.hpp"
+#include "metrics/MetricsRegistry.hpp"
 
 #define FRAME_DATA_ALIGN_IN_BYTE 16  // 16-byte alignment
 
@@ -34,6 +35,12 @@ private:
     std::mutex mutex_;
 
     std::shared_ptr<Logger> logger_;  // Manages the lifecycle of the logger object.
+
+    std::shared_ptr<MetricsRegistry> metricsRegistry_;
+    std::shared_ptr<MetricGauge>     usedSizeGauge_;
+    std::shared_ptr<MetricGauge>     maxSizeGauge_;
+    std::shared_ptr<MetricCounter>   allocationCounter_;
+    std::shared_ptr<MetricCounter>   allocationFailureCounter_;
 };
 
 class IFrameBufferManager {
@@ -77,6 +84,12 @@ protected:
 private:
     std::vector<uint8_t *>                availableFrameBuffers_;
     std::shared_ptr<FrameMemoryAllocator> frameMemoryAllocator_;
+
+    std::shared_ptr<MetricsRegistry> metricsRegistry_;
+    std::shared_ptr<MetricGauge>     allocatedBuffersGauge_;
+    std::shared_ptr<MetricGauge>     idleBuffersGauge_;
+    std::shared_ptr<MetricCounter>   acquireCounter_;
+    std::shared_ptr<MetricCounter>   acquireMissCounter_;
 };
 
 class FrameMemoryPool;
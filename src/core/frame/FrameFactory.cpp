@@ -55,6 +55,74 @@ std::shared_ptr<Frame> FrameFactory::createFrameFromOtherFrame(std::shared_ptr<c
     }
 }
 
+std::shared_ptr<Frame> FrameFactory::createFrameView(std::shared_ptr<const Frame> frame) {
+    if(frame->is<FrameSet>()) {
+        auto newFrameSet = createFrameSet();
+        auto frameSet    = frame->as<FrameSet>();
+        auto frameCount  = frameSet->getCount();
+        for(uint32_t i = 0; i < frameCount; i++) {
+            newFrameSet->pushFrame(createFrameView(frameSet->getFrame(i)));
+        }
+        newFrameSet->copyInfoFromOther(frame);
+        return newFrameSet;
+    }
+
+    auto                   data       = const_cast<uint8_t *>(frame->getData());
+    auto                   dataSize   = frame->getDataSize();
+    FrameBufferReclaimFunc keepSource = [frame]() {};  // the source frame owns the buffer, it is released with the view
+    std::shared_ptr<Frame> view;
+    switch(frame->getType()) {
+    case OB_FRAME_VIDEO:
+        view = std::make_shared<VideoFrame>(data, dataSize, OB_FRAME_VIDEO, keepSource);
+        break;
+    case OB_FRAME_DEPTH:
+        view = std::make_shared<DepthFrame>(data, dataSize, keepSource);
+        break;
+    case OB_FRAME_IR_LEFT:
+        view = std::make_shared<IRLeftFrame>(data, dataSize, keepSource);
+        break;
+    case OB_FRAME_IR_RIGHT:
+        view = std::make_shared<IRRightFrame>(data, dataSize, keepSource);
+        break;
+    case OB_FRAME_IR:
+        view = std::make_shared<IRFrame>(data, dataSize, keepSource);
+        break;
+    case OB_FRAME_COLOR:
+        view = std::make_shared<ColorFrame>(data, dataSize, keepSource);
+        break;
+    case OB_FRAME_COLOR_LEFT:
+        view = std::make_shared<ColorLeftFrame>(data, dataSize, keepSource);
+        break;
+    case OB_FRAME_COLOR_RIGHT:
+        view = std::make_shared<ColorRightFrame>(data, dataSize, keepSource);
+        break;
+    case OB_FRAME_CONFIDENCE:
+        view = std::make_shared<ConfidenceFrame>(data, dataSize, keepSource);
+        break;
+    case OB_FRAME_ACCEL:
+        view = std::make_shared<AccelFrame>(data, dataSize, keepSource);
+        break;
+    case OB_FRAME_GYRO:
+        view = std::make_shared<GyroFrame>(data, dataSize, keepSource);
+        break;
+    case OB_FRAME_POINTS:
+        view = std::make_shared<PointsFrame>(data, dataSize, keepSource);
+        break;
+    case OB_FRAME_LIDAR_POINTS:
+        view = std::make_shared<LiDARPointsFrame>(data, dataSize, keepSource);
+        break;
+    default:
+        view = std::make_shared<Frame>(data, dataSize, frame->getType(), keepSource);
+        break;
+    }
+    // both copy the data before writing to it, so a write to either frame never shows in the other
+    frame->markDataShared();
+    view->markDataShared();
+    view->setStreamProfile(frame->getStreamProfile());
+    view->copyInfoFromOther(frame);
+    return view;
+}
+
 std::shared_ptr<Frame> FrameFactory::createVideoFrame(OBFrameType frameType, OBFormat frameFormat, uint32_t width, uint32_t height, uint32_t strideBytes) {
     if(frameType == OB_FRAME_UNKNOWN || frameType == OB_FRAME_ACCEL || frameType == OB_FRAME_GYRO || frameType == OB_FRAME_SET
        || frameType == OB_FRAME_LIDAR_POINTS) {
@@ -13,6 +13,9 @@ public:
     static std::shared_ptr<Frame> createFrame(OBFrameType frameType, OBFormat frameFormat, size_t datasize);
     static std::shared_ptr<Frame> createVideoFrame(OBFrameType frameType, OBFormat frameFormat, uint32_t width, uint32_t height, uint32_t strideBytes);
     static std::shared_ptr<Frame> createFrameFromOtherFrame(std::shared_ptr<const Frame> frame, bool shouldCopyData = false);
+    // A frame of the same type and info that shares the data buffer of the given frame instead of copying it, for the paths that pass a
+    // frame through unchanged. The data is copied on the first write to either frame, see Frame::markDataShared.
+    static std::shared_ptr<Frame> createFrameView(std::shared_ptr<const Frame> frame);
 
     static std::shared_ptr<Frame> createFrameFromUserBuffer(OBFrameType frameType, OBFormat format, uint8_t *buffer, size_t bufferSize,
                                                             FrameBufferReclaimFunc bufferReclaimFunc);
@@ -0,0 +1,342 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#include "FrameLatencyTracer.hpp"
+#include "utils/Utils.hpp"
+#include "utils/PublicTypeHelper.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace libobsensor {
+
+LatencyHistogram::LatencyHistogram() {
+    reset();
+}
+
+uint32_t LatencyHistogram::getBucketIndex(uint64_t valueUs) {
+    if(valueUs < SUB_BUCKET_COUNT) {
+        return static_cast<uint32_t>(valueUs);
+    }
+    uint32_t topBit = SUB_BUCKET_BITS;
+    while(topBit < 63 && (valueUs >> (topBit + 1)) != 0) {
+        topBit++;
+    }
+    auto subBucket = static_cast<uint32_t>((valueUs >> (topBit - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1));
+    return (topBit - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + subBucket;
+}
+
+uint64_t LatencyHistogram::getBucketUpperBound(uint32_t index) {
+    if(index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    uint32_t shift     = index / SUB_BUCKET_COUNT - 1;
+    uint64_t subBucket = index % SUB_BUCKET_COUNT;
+    return ((SUB_BUCKET_COUNT + subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::add(uint64_t valueUs) {
+    buckets_[getBucketIndex(valueUs)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(valueUs, std::memory_order_relaxed);
+    auto max = max_.load(std::memory_order_relaxed);
+    while(valueUs > max && !max_.compare_exchange_weak(max, valueUs, std::memory_order_relaxed)) {}
+}
+
+void LatencyHistogram::reset() {
+    for(auto &bucket: buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getCount() const {
+    return count_.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getMax() const {
+    return max_.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getSum() const {
+    return sum_.load(std::memory_order_relaxed);
+}
+
+double LatencyHistogram::getMean() const {
+    auto count = getCount();
+    return count == 0 ? 0.0 : static_cast<double>(getSum()) / static_cast<double>(count);
+}
+
+uint64_t LatencyHistogram::getPercentile(double fraction) const {
+    auto count = getCount();
+    if(count == 0) {
+        return 0;
+    }
+    auto     rank = static_cast<uint64_t>(fraction * static_cast<double>(count) + 0.5);
+    uint64_t seen = 0;
+    for(uint32_t i = 0; i < BUCKET_COUNT; i++) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if(seen >= rank && seen > 0) {
+            return std::min(getBucketUpperBound(i), getMax());
+        }
+    }
+    return getMax();
+}
+
+FrameTrace::FrameTrace(const FrameTrace &other) {
+    std::unique_lock<std::mutex> lock(other.mutex_);
+    events_ = other.events_;
+}
+
+void FrameTrace::addEvent(OBFrameTraceStage stage, uint64_t timestampUs, const char *name) {
+    OBFrameTraceEvent event = {};
+    event.stage             = stage;
+    event.timestampUs       = timestampUs;
+    if(name) {
+        strncpy(event.name, name, sizeof(event.name) - 1);
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    events_.push_back(event);
+}
+
+std::vector<OBFrameTraceEvent> FrameTrace::getEvents() const {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return events_;
+}
+
+namespace {
+
+LatencyHistogram stageHistograms[OB_FRAME_TRACE_STAGE_COUNT];
+
+struct TraceExportFile {
+    std::mutex            mutex;
+    std::ofstream         stream;
+    bool                  empty = true;
+    std::atomic<bool>     opened{ false };
+    std::atomic<uint64_t> nextTraceId{ 1 };
+};
+
+TraceExportFile traceExportFile;
+
+template <typename Func> void forEachFrame(const std::shared_ptr<const Frame> &frame, Func func) {
+    if(!frame->is<FrameSet>()) {
+        func(*frame);
+        return;
+    }
+    auto frameSet = frame->as<FrameSet>();
+    auto count    = frameSet->getCount();
+    for(uint32_t i = 0; i < count; i++) {
+        auto item = frameSet->getFrame(static_cast<int>(i));
+        if(item) {
+            func(*item);
+        }
+    }
+}
+
+std::string escapeJson(const std::string &str) {
+    std::string result;
+    for(auto c: str) {
+        if(c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+
+// an event of a nestable async slice of the Chrome trace event format, the slices with the same id are shown on one track
+void writeAsyncEvent(std::ostream &os, char phase, const std::string &name, const std::string &category, uint64_t id, uint64_t timestampUs,
+                     uint64_t frameNumber) {
+    os << "{\"name\":\"" << escapeJson(name) << "\",\"cat\":\"" << category << "\",\"ph\":\"" << phase << "\",\"id\":" << id
+       << ",\"pid\":1,\"tid\":1,\"ts\":" << timestampUs;
+    if(phase == 'b') {
+        os << ",\"args\":{\"frame_number\":" << frameNumber << "}";
+    }
+    os << "}";
+}
+
+}  // namespace
+
+std::atomic<uint32_t> FrameLatencyTracer::flags_(0);
+
+void FrameLatencyTracer::setFlag(uint32_t flag, bool enable) {
+    if(enable) {
+        flags_.fetch_or(flag, std::memory_order_relaxed);
+    }
+    else {
+        flags_.fetch_and(~flag, std::memory_order_relaxed);
+    }
+}
+
+void FrameLatencyTracer::enable(bool enable) {
+    setFlag(FLAG_HISTOGRAM, enable);
+}
+
+bool FrameLatencyTracer::isEnabled() {
+    return (flags_.load(std::memory_order_relaxed) & FLAG_HISTOGRAM) != 0;
+}
+
+void FrameLatencyTracer::reset() {
+    for(auto &histogram: stageHistograms) {
+        histogram.reset();
+    }
+}
+
+void FrameLatencyTracer::enableFrameTrace(bool enable) {
+    setFlag(FLAG_FRAME_TRACE, enable);
+}
+
+bool FrameLatencyTracer::isFrameTraceEnabled() {
+    return (flags_.load(std::memory_order_relaxed) & FLAG_FRAME_TRACE) != 0;
+}
+
+void FrameLatencyTracer::startExport(const std::string &filePath) {
+    std::unique_lock<std::mutex> lock(traceExportFile.mutex);
+    if(traceExportFile.stream.is_open()) {
+        traceExportFile.stream << "\n]\n";
+        traceExportFile.stream.close();
+    }
+    // the closing bracket of the JSON array format is optional, the file stays readable if the process ends before stopExport
+    traceExportFile.stream.open(filePath, std::ios::out | std::ios::trunc);
+    if(!traceExportFile.stream.is_open()) {
+        traceExportFile.opened = false;
+        THROW_IO_EXCEPTION("Unable to open the frame trace file: " + filePath);
+    }
+    traceExportFile.stream << "[\n";
+    traceExportFile.empty  = true;
+    traceExportFile.opened = true;
+    enableFrameTrace(true);
+}
+
+void FrameLatencyTracer::stopExport() {
+    std::unique_lock<std::mutex> lock(traceExportFile.mutex);
+    traceExportFile.opened = false;
+    if(traceExportFile.stream.is_open()) {
+        traceExportFile.stream << "\n]\n";
+        traceExportFile.stream.close();
+    }
+}
+
+void FrameLatencyTracer::markArrival(const std::shared_ptr<Frame> &frame) {
+    auto flags = flags_.load(std::memory_order_relaxed);
+    if(flags == 0 || !frame || frame->getArrivalTimeUsec() != 0) {
+        return;
+    }
+
+    auto now = utils::getSteadyTimeUs();
+    frame->setArrivalTimeUsec(now);
+    if(flags & FLAG_FRAME_TRACE) {
+        auto trace = std::make_shared<FrameTrace>();
+        trace->addEvent(OB_FRAME_TRACE_STAGE_BACKEND_RECEIVE, now, nullptr);
+        frame->setTrace(trace);
+    }
+}
+
+void FrameLatencyTracer::record(OBFrameTraceStage stage, const std::shared_ptr<const Frame> &frame, const char *name) {
+    auto flags = flags_.load(std::memory_order_relaxed);
+    if(flags == 0 || !frame) {
+        return;
+    }
+
+    auto  now       = utils::getSteadyTimeUs();
+    auto &histogram = stageHistograms[stage];
+    forEachFrame(frame, [&](const Frame &item) {
+        auto arrival = item.getArrivalTimeUsec();
+        if((flags & FLAG_HISTOGRAM) && arrival != 0 && now >= arrival) {
+            histogram.add(now - arrival);
+        }
+        auto trace = item.getTrace();
+        if((flags & FLAG_FRAME_TRACE) && trace) {
+            trace->addEvent(stage, now, name);
+        }
+    });
+}
+
+void FrameLatencyTracer::exportTrace(const std::shared_ptr<const Frame> &frame) {
+    if(!traceExportFile.opened.load(std::memory_order_relaxed) || !frame) {
+        return;
+    }
+
+    std::ostringstream oss;
+    bool               empty = true;
+    forEachFrame(frame, [&](const Frame &item) {
+        auto trace = item.getTrace();
+        if(!trace) {
+            return;
+        }
+        auto events = trace->getEvents();
+        if(events.size() < 2) {
+            return;
+        }
+
+        // the frame is a slice from its arrival to its last stage, holding one slice per stage that ends when the frame reaches the stage
+        auto id        = traceExportFile.nextTraceId.fetch_add(1, std::memory_order_relaxed);
+        auto category  = utils::obFrameToStr(item.getType());
+        auto number    = item.getNumber();
+        auto frameName = category + " #" + std::to_string(number);
+        if(!empty) {
+            oss << ",\n";
+        }
+        empty = false;
+        writeAsyncEvent(oss, 'b', frameName, category, id, events.front().timestampUs, number);
+        for(size_t i = 1; i < events.size(); i++) {
+            std::string name = getStageName(events[i].stage);
+            if(events[i].name[0] != '\0') {
+                name += std::string(" ") + events[i].name;
+            }
+            oss << ",\n";
+            writeAsyncEvent(oss, 'b', name, category, id, events[i - 1].timestampUs, number);
+            oss << ",\n";
+            writeAsyncEvent(oss, 'e', name, category, id, events[i].timestampUs, number);
+        }
+        oss << ",\n";
+        writeAsyncEvent(oss, 'e', frameName, category, id, events.back().timestampUs, number);
+    });
+    if(empty) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(traceExportFile.mutex);
+    if(!traceExportFile.stream.is_open()) {
+        return;
+    }
+    if(!traceExportFile.empty) {
+        traceExportFile.stream << ",\n";
+    }
+    traceExportFile.stream << oss.str();
+    traceExportFile.empty = false;
+}
+
+const LatencyHistogram &FrameLatencyTracer::getHistogram(OBFrameTraceStage stage) {
+    return stageHistograms[stage];
+}
+
+const char *FrameLatencyTracer::getStageName(OBFrameTraceStage stage) {
+    switch(stage) {
+    case OB_FRAME_TRACE_STAGE_BACKEND_RECEIVE:
+        return "backend_receive";
+    case OB_FRAME_TRACE_STAGE_SENSOR_OUTPUT:
+        return "sensor_output";
+    case OB_FRAME_TRACE_STAGE_FILTER_ENQUEUE:
+        return "filter_enqueue";
+    case OB_FRAME_TRACE_STAGE_FILTER_DEQUEUE:
+        return "filter_dequeue";
+    case OB_FRAME_TRACE_STAGE_FILTER_PROCESS_END:
+        return "filter_process_end";
+    case OB_FRAME_TRACE_STAGE_PIPELINE_INPUT:
+        return "pipeline_input";
+    case OB_FRAME_TRACE_STAGE_AGGREGATION:
+        return "aggregation";
+    case OB_FRAME_TRACE_STAGE_DELIVERY:
+        return "delivery";
+    case OB_FRAME_TRACE_STAGE_CALLBACK_RETURN:
+        return "callback_return";
+    default:
+        return "unknown";
+    }
+}
+
+}  // namespace libobsensor
@@ -0,0 +1,96 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "frame/Frame.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace libobsensor {
+
+// Lock-free histogram of latencies in microseconds. The buckets are exact below 16us, above that every power of two is split into 16
+// buckets, so a percentile is known within 1/16 of its value.
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    void add(uint64_t valueUs);
+    void reset();
+
+    uint64_t getCount() const;
+    uint64_t getMax() const;
+    uint64_t getSum() const;
+    double   getMean() const;
+    // the latency below which the given fraction (0 ~ 1) of the samples are, the upper bound of its bucket
+    uint64_t getPercentile(double fraction) const;
+
+private:
+    static const uint32_t SUB_BUCKET_BITS  = 4;
+    static const uint32_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static const uint32_t BUCKET_COUNT     = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    static uint32_t getBucketIndex(uint64_t valueUs);
+    static uint64_t getBucketUpperBound(uint32_t index);
+
+    std::atomic<uint64_t> buckets_[BUCKET_COUNT];
+    std::atomic<uint64_t> count_;
+    std::atomic<uint64_t> sum_;
+    std::atomic<uint64_t> max_;
+};
+
+// The trace events of a frame. The frames derived from a frame (see Frame::copyInfoFromOther) get a copy of its events.
+class FrameTrace {
+public:
+    FrameTrace() = default;
+    FrameTrace(const FrameTrace &other);
+
+    void                           addEvent(OBFrameTraceStage stage, uint64_t timestampUs, const char *name);
+    std::vector<OBFrameTraceEvent> getEvents() const;
+
+private:
+    mutable std::mutex             mutex_;
+    std::vector<OBFrameTraceEvent> events_;
+};
+
+// Host side latency of the frames through the SDK, measured from the arrival of every frame from the backend. Disabled by default, the stages
+// only check a flag then. Two independent parts can be enabled:
+// - the latency histograms: every stage keeps a histogram of the time since the arrival of the frames that reached it, for the benchmarks;
+// - the frame trace: every frame records the time it reached each stage, readable per frame and exportable to a Chrome trace / Perfetto JSON
+//   file, to find which stage a latency spike comes from.
+class FrameLatencyTracer {
+public:
+    static void enable(bool enable);
+    static bool isEnabled();
+    static void reset();  // clears the histograms of all the stages
+
+    static void enableFrameTrace(bool enable);
+    static bool isFrameTraceEnabled();
+    // writes the trace of every frameset the pipelines are done with to a JSON file (Chrome trace event format), enables the frame trace
+    static void startExport(const std::string &filePath);
+    static void stopExport();
+
+    // called where the frames come from the backend, the first call sets the arrival time of the frame
+    static void markArrival(const std::shared_ptr<Frame> &frame);
+    // records the stage on every frame of a frameset, the name is the filter name for the filter stages
+    static void record(OBFrameTraceStage stage, const std::shared_ptr<const Frame> &frame, const char *name = nullptr);
+    // called when the pipeline is done with a frameset, writes the trace of its frames to the export file if any
+    static void exportTrace(const std::shared_ptr<const Frame> &frame);
+
+    static const LatencyHistogram &getHistogram(OBFrameTraceStage stage);
+    static const char             *getStageName(OBFrameTraceStage stage);
+
+private:
+    static const uint32_t FLAG_HISTOGRAM   = 0x01;
+    static const uint32_t FLAG_FRAME_TRACE = 0x02;
+
+    static void setFlag(uint32_t flag, bool enable);
+
+    static std::atomic<uint32_t> flags_;
+};
+
+}  // namespace libobsensor
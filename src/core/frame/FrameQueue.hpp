@@ -4,6 +4,7 @@
 #pragma once
 
 #include "frame/Frame.hpp"
+#include "metrics/MetricsRegistry.hpp"
 
 #include <queue>
 
@@ -11,7 +12,14 @@ namespace libobsensor {
 
 template <typename T = Frame> class FrameQueue {
 public:
-    explicit FrameQueue(size_t capacity) : capacity_(capacity), stopped_(true), stopping_(false), callback_(nullptr), flushing_(false) {}
+    // the name labels the metrics of the queue (depth, high-water mark and dropped frames)
+    explicit FrameQueue(size_t capacity, const std::string &name = "frame_queue")
+        : capacity_(capacity), stopped_(true), stopping_(false), callback_(nullptr), flushing_(false), metricsRegistry_(MetricsRegistry::getInstance()) {
+        MetricLabels labels = { { "queue", name }, { "id", MetricsRegistry::newInstanceId() } };
+        depthGauge_         = metricsRegistry_->getGauge("ob_frame_queue_depth", "Frames waiting in the queue.", labels);
+        highWaterGauge_     = metricsRegistry_->getGauge("ob_frame_queue_high_water_mark", "Most frames that have been waiting in the queue.", labels);
+        droppedCounter_     = metricsRegistry_->getCounter("ob_frame_queue_dropped_frames_total", "Frames dropped because the queue was full.", labels);
+    }
 
     ~FrameQueue() noexcept {
         reset();
@@ -40,9 +48,27 @@ public:
     bool enqueue(std::shared_ptr<T> frame) {  // returns false if queue is full
         std::unique_lock<std::mutex> lock(mutex_);
         if(queue_.size() >= capacity_ || flushing_) {
+            if(!flushing_) {
+                droppedCounter_->add();
+            }
             return false;
         }
-        queue_.push(frame);
+        push(frame);
+        condition_.notify_all();
+        return true;
+    }
+
+    // blocking enqueue: waits until there is room in the queue, returns false if timeout is reached or queue is flushing/stopping
+    bool enqueueWait(std::shared_ptr<T> frame, uint64_t timeoutMsec) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        spaceCondition_.wait_for(lock, std::chrono::milliseconds(timeoutMsec), [this] { return queue_.size() < capacity_ || flushing_ || stopping_; });
+        if(queue_.size() >= capacity_ || flushing_ || stopping_) {
+            if(!flushing_ && !stopping_) {
+                droppedCounter_->add();
+            }
+            return false;
+        }
+        push(frame);
         condition_.notify_all();
         return true;
     }
@@ -51,8 +77,8 @@ public:
     std::shared_ptr<T> dequeue(uint64_t timeoutMsec = 0) {  // returns nullptr if timeout is reached
         std::unique_lock<std::mutex> lock(mutex_);
         if(!queue_.empty()) {
-            auto result = queue_.front();
-            queue_.pop();
+            auto result = pop();
+            spaceCondition_.notify_all();
             return result;
         }
 
@@ -64,8 +90,8 @@ public:
         if(queue_.empty()) {
             return nullptr;
         }
-        auto result = queue_.front();
-        queue_.pop();
+        auto result = pop();
+        spaceCondition_.notify_all();
         return result;
     }
 
@@ -92,13 +118,13 @@ public:
                     }
 
                     if(!queue_.empty()) {
-                        frame = queue_.front();
-                        queue_.pop();
+                        frame = pop();
+                        spaceCondition_.notify_all();
                     }
                 }
 
                 if(frame) {
-                    callback_(frame);
+                    callback_(std::move(frame));
                 }
             }
             stopped_ = true;
@@ -114,6 +140,7 @@ public:
             std::unique_lock<std::mutex> lock(mutex_);
             flushing_ = true;
             condition_.notify_all();
+            spaceCondition_.notify_all();
         }
         if(dequeueThread_.joinable()) {
             dequeueThread_.join();
@@ -125,6 +152,7 @@ public:
             std::unique_lock<std::mutex> lock(mutex_);
             stopping_ = true;
             condition_.notify_all();
+            spaceCondition_.notify_all();
         }
         if(dequeueThread_.joinable()) {
             dequeueThread_.join();
@@ -134,6 +162,7 @@ public:
         while(!queue_.empty()) {
             queue_.pop();
         }
+        depthGauge_->set(0);
     }
 
     // clear all frames in queue, flags, and callback. Stop dequeue thread. reset to initial state.
@@ -145,9 +174,26 @@ public:
         stopped_  = true;
     }
 
+private:
+    // called with the mutex locked
+    void push(const std::shared_ptr<T> &frame) {
+        queue_.push(frame);
+        auto depth = static_cast<int64_t>(queue_.size());
+        depthGauge_->set(depth);
+        highWaterGauge_->updateMax(depth);
+    }
+
+    std::shared_ptr<T> pop() {
+        auto frame = queue_.front();
+        queue_.pop();
+        depthGauge_->set(static_cast<int64_t>(queue_.size()));
+        return frame;
+    }
+
 private:
     std::mutex                     mutex_;
     std::condition_variable        condition_;
+    std::condition_variable        spaceCondition_;
     std::queue<std::shared_ptr<T>> queue_;
     size_t                         capacity_;
 
@@ -156,6 +202,11 @@ private:
     std::atomic<bool>                       stopping_;
     std::function<void(std::shared_ptr<T>)> callback_;
     std::atomic<bool>                       flushing_;
+
+    std::shared_ptr<MetricsRegistry> metricsRegistry_;
+    std::shared_ptr<MetricGauge>     depthGauge_;
+    std::shared_ptr<MetricGauge>     highWaterGauge_;
+    std::shared_ptr<MetricCounter>   droppedCounter_;
 };
 
 }  // namespace libobsensor
@@ -0,0 +1,261 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#include "MetricsRegistry.hpp"
+#include "exception/ObException.hpp"
+#include "logger/LoggerInterval.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace libobsensor {
+
+namespace {
+
+std::string escapeLabelValue(const std::string &value) {
+    std::string result;
+    for(auto c: value) {
+        if(c == '\\' || c == '"') {
+            result += '\\';
+            result += c;
+        }
+        else if(c == '\n') {
+            result += "\\n";
+        }
+        else {
+            result += c;
+        }
+    }
+    return result;
+}
+
+// the label set in the Prometheus format: {name="value",...}, empty without label
+std::string formatLabels(const MetricLabels &labels) {
+    if(labels.empty()) {
+        return "";
+    }
+    std::string result = "{";
+    for(size_t i = 0; i < labels.size(); i++) {
+        if(i > 0) {
+            result += ",";
+        }
+        result += labels[i].first + "=\"" + escapeLabelValue(labels[i].second) + "\"";
+    }
+    return result + "}";
+}
+
+// adds a label to a label set in the Prometheus format
+std::string appendLabel(const std::string &labels, const std::string &label) {
+    if(labels.empty()) {
+        return "{" + label + "}";
+    }
+    return labels.substr(0, labels.size() - 1) + "," + label + "}";
+}
+
+}  // namespace
+
+std::mutex                     MetricsRegistry::instanceMutex_;
+std::weak_ptr<MetricsRegistry> MetricsRegistry::instanceWeakPtr_;
+
+std::shared_ptr<MetricsRegistry> MetricsRegistry::getInstance() {
+    std::unique_lock<std::mutex> lock(instanceMutex_);
+    auto                         instance = instanceWeakPtr_.lock();
+    if(!instance) {
+        instance         = std::shared_ptr<MetricsRegistry>(new MetricsRegistry());
+        instanceWeakPtr_ = instance;
+    }
+    return instance;
+}
+
+MetricsRegistry::MetricsRegistry() : dumpStopping_(false), logger_(Logger::getInstance()) {}
+
+MetricsRegistry::~MetricsRegistry() noexcept {
+    TRY_EXECUTE({ stopDump(); });
+}
+
+std::string MetricsRegistry::newInstanceId() {
+    static std::atomic<uint64_t> nextId(0);
+    return std::to_string(nextId.fetch_add(1, std::memory_order_relaxed));
+}
+
+template <typename T>
+std::shared_ptr<T> MetricsRegistry::getMetric(MetricType type, const std::string &name, const std::string &help, const MetricLabels &labels) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto                         iter = families_.find(name);
+    if(iter == families_.end()) {
+        iter = families_.insert({ name, MetricFamily{ type, help, {} } }).first;
+    }
+    else if(iter->second.type != type) {
+        THROW_INVALID_PARAM_EXCEPTION("Metric " + name + " is already registered with another type");
+    }
+    // the objects registering a series each (e.g. labelled with newInstanceId) come and go, the map must not grow while no one exports
+    pruneExpiredSeries(iter->second);
+
+    auto &series = iter->second.series[formatLabels(labels)];
+    auto  metric = std::static_pointer_cast<T>(series.lock());
+    if(!metric) {
+        // not make_shared: the weak reference would keep the storage of the metric allocated along with the control block
+        metric = std::shared_ptr<T>(new T());
+        series = metric;
+    }
+    return metric;
+}
+
+void MetricsRegistry::pruneExpiredSeries(MetricFamily &family) {
+    for(auto seriesIter = family.series.begin(); seriesIter != family.series.end();) {
+        if(seriesIter->second.expired()) {
+            seriesIter = family.series.erase(seriesIter);
+        }
+        else {
+            seriesIter++;
+        }
+    }
+}
+
+std::shared_ptr<MetricCounter> MetricsRegistry::getCounter(const std::string &name, const std::string &help, const MetricLabels &labels) {
+    return getMetric<MetricCounter>(METRIC_TYPE_COUNTER, name, help, labels);
+}
+
+std::shared_ptr<MetricGauge> MetricsRegistry::getGauge(const std::string &name, const std::string &help, const MetricLabels &labels) {
+    return getMetric<MetricGauge>(METRIC_TYPE_GAUGE, name, help, labels);
+}
+
+std::shared_ptr<LatencyHistogram> MetricsRegistry::getHistogram(const std::string &name, const std::string &help, const MetricLabels &labels) {
+    return getMetric<LatencyHistogram>(METRIC_TYPE_HISTOGRAM, name, help, labels);
+}
+
+double MetricsRegistry::getValue(const std::string &name) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto                         iter = families_.find(name);
+    if(iter == families_.end()) {
+        return 0.0;
+    }
+
+    double value = 0.0;
+    for(auto &series: iter->second.series) {
+        auto metric = series.second.lock();
+        if(!metric) {
+            continue;
+        }
+        switch(iter->second.type) {
+        case METRIC_TYPE_COUNTER:
+            value += static_cast<double>(std::static_pointer_cast<MetricCounter>(metric)->get());
+            break;
+        case METRIC_TYPE_GAUGE:
+            value += static_cast<double>(std::static_pointer_cast<MetricGauge>(metric)->get());
+            break;
+        case METRIC_TYPE_HISTOGRAM:
+            value += static_cast<double>(std::static_pointer_cast<LatencyHistogram>(metric)->getCount());
+            break;
+        }
+    }
+    return value;
+}
+
+std::string MetricsRegistry::exportPrometheusText() {
+    static const char                           *TYPE_NAMES[] = { "counter", "gauge", "summary" };
+    static const std::pair<double, const char *> QUANTILES[]  = { { 0.5, "0.5" }, { 0.9, "0.9" }, { 0.99, "0.99" }, { 0.999, "0.999" } };
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    std::ostringstream           oss;
+    for(auto familyIter = families_.begin(); familyIter != families_.end();) {
+        auto &name   = familyIter->first;
+        auto &family = familyIter->second;
+
+        // drop the metrics of the objects destroyed
+        pruneExpiredSeries(family);
+        if(family.series.empty()) {
+            familyIter = families_.erase(familyIter);
+            continue;
+        }
+
+        oss << "# HELP " << name << " " << family.help << "\n";
+        oss << "# TYPE " << name << " " << TYPE_NAMES[family.type] << "\n";
+        for(auto &series: family.series) {
+            auto metric = series.second.lock();
+            if(!metric) {
+                continue;
+            }
+            auto &labels = series.first;
+            switch(family.type) {
+            case METRIC_TYPE_COUNTER:
+                oss << name << labels << " " << std::static_pointer_cast<MetricCounter>(metric)->get() << "\n";
+                break;
+            case METRIC_TYPE_GAUGE:
+                oss << name << labels << " " << std::static_pointer_cast<MetricGauge>(metric)->get() << "\n";
+                break;
+            case METRIC_TYPE_HISTOGRAM: {
+                auto histogram = std::static_pointer_cast<LatencyHistogram>(metric);
+                for(auto &quantile: QUANTILES) {
+                    oss << name << appendLabel(labels, std::string("quantile=\"") + quantile.second + "\"") << " " << histogram->getPercentile(quantile.first)
+                        << "\n";
+                }
+                oss << name << "_sum" << labels << " " << histogram->getSum() << "\n";
+                oss << name << "_count" << labels << " " << histogram->getCount() << "\n";
+                break;
+            }
+            }
+        }
+        familyIter++;
+    }
+    return oss.str();
+}
+
+void MetricsRegistry::dumpToFile(const std::string &filePath) {
+    auto text     = exportPrometheusText();
+    auto tempPath = filePath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::out | std::ios::trunc);
+        if(!file.is_open()) {
+            THROW_IO_EXCEPTION("Unable to open the metrics file: " + tempPath);
+        }
+        file << text;
+    }
+#ifdef _WIN32
+    std::remove(filePath.c_str());  // rename does not replace an existing file on Windows
+#endif
+    if(std::rename(tempPath.c_str(), filePath.c_str()) != 0) {
+        THROW_IO_EXCEPTION("Unable to replace the metrics file: " + filePath);
+    }
+}
+
+void MetricsRegistry::startDump(const std::string &filePath, uint32_t intervalMs) {
+    if(intervalMs == 0) {
+        THROW_INVALID_PARAM_EXCEPTION("The metrics dump interval must be greater than 0");
+    }
+    stopDump();
+    dumpToFile(filePath);  // reports an unwritable path to the caller
+
+    std::unique_lock<std::mutex> lock(dumpMutex_);
+    dumpStopping_ = false;
+    dumpThread_   = std::thread([this, filePath, intervalMs] {
+        std::unique_lock<std::mutex> dumpLock(dumpMutex_);
+        while(!dumpStopping_) {
+            dumpCondition_.wait_for(dumpLock, std::chrono::milliseconds(intervalMs), [this] { return dumpStopping_; });
+            dumpLock.unlock();
+            try {
+                dumpToFile(filePath);
+            }
+            catch(const std::exception &e) {
+                LOG_WARN_INTVL("Failed to dump the metrics: {}", e.what());
+            }
+            dumpLock.lock();
+        }
+    });
+    LOG_DEBUG("Metrics dump started, file: {}, interval: {}ms", filePath, intervalMs);
+}
+
+void MetricsRegistry::stopDump() {
+    {
+        std::unique_lock<std::mutex> lock(dumpMutex_);
+        dumpStopping_ = true;
+        dumpCondition_.notify_all();
+    }
+    if(dumpThread_.joinable()) {
+        dumpThread_.join();
+        LOG_DEBUG("Metrics dump stopped");
+    }
+}
+
+}  // namespace libobsensor
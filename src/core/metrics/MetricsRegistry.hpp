@@ -0,0 +1,123 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "frame/FrameLatencyTracer.hpp"
+#include "logger/Logger.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace libobsensor {
+
+typedef std::vector<std::pair<std::string, std::string>> MetricLabels;
+
+class MetricCounter {
+public:
+    void add(uint64_t value = 1) {
+        value_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    uint64_t get() const {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> value_{ 0 };
+};
+
+class MetricGauge {
+public:
+    void set(int64_t value) {
+        value_.store(value, std::memory_order_relaxed);
+    }
+
+    void add(int64_t value) {
+        value_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    // sets the gauge to the value if it is greater, for the high-water marks
+    void updateMax(int64_t value) {
+        auto current = value_.load(std::memory_order_relaxed);
+        while(value > current && !value_.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+
+    int64_t get() const {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<int64_t> value_{ 0 };
+};
+
+// Runtime metrics of the SDK: counters, gauges and histograms (in microseconds), identified by a name and a set of labels as in Prometheus.
+// The metrics are owned by the objects that update them, the registry only keeps weak references: the metrics of an object disappear with it.
+// The objects registering metrics hold the registry, the metrics of all the objects alive can be read as Prometheus text or dumped
+// periodically to a file (e.g. for the textfile collector of the Prometheus node exporter).
+class MetricsRegistry {
+private:
+    MetricsRegistry();
+
+    static std::mutex                     instanceMutex_;
+    static std::weak_ptr<MetricsRegistry> instanceWeakPtr_;
+
+public:
+    ~MetricsRegistry() noexcept;
+    static std::shared_ptr<MetricsRegistry> getInstance();
+
+    // a new value for the "id" label, to tell apart the metrics of the objects of the same kind
+    static std::string newInstanceId();
+
+    // returns the metric with the name and labels, created if not registered yet; the metrics with the same name must have the same type
+    std::shared_ptr<MetricCounter>    getCounter(const std::string &name, const std::string &help, const MetricLabels &labels = {});
+    std::shared_ptr<MetricGauge>      getGauge(const std::string &name, const std::string &help, const MetricLabels &labels = {});
+    std::shared_ptr<LatencyHistogram> getHistogram(const std::string &name, const std::string &help, const MetricLabels &labels = {});
+
+    // the sum of the values of all the metrics with the name, the sample count for a histogram
+    double getValue(const std::string &name);
+    // all the metrics in the Prometheus text exposition format, the histograms are exported as summaries
+    std::string exportPrometheusText();
+
+    // writes the Prometheus text to the file every interval, the file is replaced at once so a reader never sees it partly written
+    void startDump(const std::string &filePath, uint32_t intervalMs);
+    void stopDump();
+
+private:
+    enum MetricType {
+        METRIC_TYPE_COUNTER,
+        METRIC_TYPE_GAUGE,
+        METRIC_TYPE_HISTOGRAM,
+    };
+
+    struct MetricFamily {
+        MetricType                                 type;
+        std::string                                help;
+        std::map<std::string, std::weak_ptr<void>> series;  // key: the label set in the Prometheus format
+    };
+
+    template <typename T> std::shared_ptr<T> getMetric(MetricType type, const std::string &name, const std::string &help, const MetricLabels &labels);
+    static void pruneExpiredSeries(MetricFamily &family);
+
+    void dumpToFile(const std::string &filePath);
+
+private:
+    std::mutex                          mutex_;
+    std::map<std::string, MetricFamily> families_;
+
+    std::mutex              dumpMutex_;
+    std::condition_variable dumpCondition_;
+    std::thread             dumpThread_;
+    bool                    dumpStopping_;
+
+    std::shared_ptr<Logger> logger_;  // Manages the lifecycle of the logger object.
+};
+
+}  // namespace libobsensor
@@ -124,6 +124,14 @@ OBHardwareDecimationConfig VideoStreamProfile::getDecimationConfig() const {
     return decimationConfig_;
 }
 
+void VideoStreamProfile::setCropRegion(const OBRect &region) {
+    cropRegion_ = region;
+}
+
+OBRect VideoStreamProfile::getCropRegion() const {
+    return cropRegion_;
+}
+
 OBCameraIntrinsic VideoStreamProfile::getIntrinsic() const {
     auto intrinsicsMgr = StreamIntrinsicsManager::getInstance();
     return intrinsicsMgr->getVideoStreamIntrinsics(shared_from_this());
@@ -151,6 +159,7 @@ uint32_t VideoStreamProfile::getMaxFrameDataSize() const {
 std::shared_ptr<StreamProfile> VideoStreamProfile::clone() const {
     auto sp            = std::make_shared<VideoStreamProfile>(owner_.lock(), type_, format_, width_, height_, fps_);
     auto intrinsicsMgr = StreamIntrinsicsManager::getInstance();
+    sp->setCropRegion(cropRegion_);
     if(intrinsicsMgr->containsVideoStreamIntrinsics(shared_from_this())) {
         auto intrinsic = intrinsicsMgr->getVideoStreamIntrinsics(shared_from_this());
         intrinsicsMgr->registerVideoStreamIntrinsics(sp, intrinsic);
@@ -180,6 +189,7 @@ void DisparityBasedStreamProfile::bindDisparityParam(const OBDisparityParam &par
 std::shared_ptr<StreamProfile> DisparityBasedStreamProfile::clone() const {
     auto sp            = std::make_shared<DisparityBasedStreamProfile>(owner_.lock(), type_, format_, width_, height_, fps_);
     auto intrinsicsMgr = StreamIntrinsicsManager::getInstance();
+    sp->setCropRegion(cropRegion_);
     if(intrinsicsMgr->containsVideoStreamIntrinsics(shared_from_this())) {
         auto intrinsic = intrinsicsMgr->getVideoStreamIntrinsics(shared_from_this());
         intrinsicsMgr->registerVideoStreamIntrinsics(sp, intrinsic);
@@ -199,11 +209,17 @@ std::shared_ptr<StreamProfile> DisparityBasedStreamProfile::clone() const {
 AccelStreamProfile::AccelStreamProfile(std::shared_ptr<LazySensor> owner, OBAccelFullScaleRange fullScaleRange, OBAccelSampleRate sampleRate)
     : StreamProfile{ owner, OB_STREAM_ACCEL, OB_FORMAT_ACCEL }, fullScaleRange_(fullScaleRange), sampleRate_(sampleRate) {}
 bool VideoStreamProfile::operator==(const VideoStreamProfile &other) const {
-    return (type_ == other.type_) && (format_ == other.format_) && (width_ == other.width_) && (height_ == other.height_) && (fps_ == other.fps_);
+    return (type_ == other.type_) && (format_ == other.format_) && (width_ == other.width_) && (height_ == other.height_) && (fps_ == other.fps_)
+           && (cropRegion_.x == other.cropRegion_.x) && (cropRegion_.y == other.cropRegion_.y) && (cropRegion_.width == other.cropRegion_.width)
+           && (cropRegion_.height == other.cropRegion_.height);
 }
 
 std::ostream &VideoStreamProfile::operator<<(std::ostream &os) const {
-    os << "{" << "type: " << type_ << ", format: " << format_ << ", width: " << width_ << ", height: " << height_ << ", fps: " << fps_ << "}";
+    os << "{" << "type: " << type_ << ", format: " << format_ << ", width: " << width_ << ", height: " << height_ << ", fps: " << fps_;
+    if(cropRegion_.width != 0) {
+        os << ", crop: " << cropRegion_.x << "," << cropRegion_.y << "," << cropRegion_.width << "x" << cropRegion_.height;
+    }
+    os << "}";
     return os;
 }
 
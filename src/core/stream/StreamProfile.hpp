@@ -52,27 +52,27 @@ public:
     virtual std::shared_ptr<StreamProfile> clone(OBFormat newFormat) const;
 
     template <typename T> bool is() const {
-        return std::dynamic_pointer_cast<const T>(shared_from_this()) != nullptr;
+        return dynamic_cast<const T *>(this) != nullptr;
     }
 
     template <typename T> bool is() {
-        return std::dynamic_pointer_cast<T>(shared_from_this()) != nullptr;
+        return dynamic_cast<T *>(this) != nullptr;
     }
 
     template <typename T> std::shared_ptr<T> as() {
-        if(!is<T>()) {
+        auto ptr = std::dynamic_pointer_cast<T>(shared_from_this());
+        if(!ptr) {
             THROW_UNSUPPORTED_OPERATION_EXCEPTION("unsupported operation, object's type is not require type");
         }
-
-        return std::dynamic_pointer_cast<T>(shared_from_this());
+        return ptr;
     }
 
     template <typename T> std::shared_ptr<const T> as() const {
-        if(!is<const T>()) {
+        auto ptr = std::dynamic_pointer_cast<const T>(shared_from_this());
+        if(!ptr) {
             THROW_UNSUPPORTED_OPERATION_EXCEPTION("unsupported operation, object's type is not require type");
         }
-
-        return std::dynamic_pointer_cast<const T>(shared_from_this());
+        return ptr;
     }
 
     virtual std::ostream &operator<<(std::ostream &os) const;
@@ -98,6 +98,9 @@ public:
     uint32_t                   getFps() const;
     void                       setDecimationConfig(const OBHardwareDecimationConfig &decimationConfig);
     OBHardwareDecimationConfig getDecimationConfig() const;
+    // Region of the frames this profile's frames were cropped from (see FrameCrop), zero size if not cropped.
+    void                       setCropRegion(const OBRect &region);
+    OBRect                     getCropRegion() const;
     OBCameraIntrinsic          getIntrinsic() const;
     void                       bindIntrinsic(const OBCameraIntrinsic &intrinsic);
     OBCameraDistortion         getDistortion() const;
@@ -113,6 +116,7 @@ protected:
     uint32_t                   height_;
     OBHardwareDecimationConfig decimationConfig_{ 0, 0, 0 };
     uint32_t                   fps_;
+    OBRect                     cropRegion_{ 0, 0, 0, 0 };
 };
 
 class DisparityBasedStreamProfile : public VideoStreamProfile {
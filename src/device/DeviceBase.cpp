@@ -14,6 +14,7 @@
 #include "IDeviceMonitor.hpp"
 #include "utils/DeviceTypeHelper.hpp"
 #include "component/comprehensivefilter/DepthPostFilterParamsManager.hpp"
+#include "property/PropertyDiskCache.hpp"
 
 #ifdef __linux__
 #include "usb/uvc/UvcDevicePort.hpp"
@@ -243,6 +244,9 @@ void DeviceBase::reboot() {
         THROW_UNSUPPORTED_OPERATION_EXCEPTION("Device does not support reboot!");
     }
 
+    // the property values are reset by the reboot
+    propServer->invalidatePropertyCache();
+
     // notify
     auto cb = rebootCallback_;
     if(cb && *cb) {
@@ -596,8 +600,24 @@ void DeviceBase::updateFirmware(const std::vector<uint8_t> &firmware, DeviceFwUp
         THROW_WRONG_API_CALL_SEQUENCE_EXCEPTION("Device is streaming, please stop all sensors before updating firmware!");
     }
 
+    // Cached property values read from the old firmware are stale after the update. The cache is cleared again once the update is done,
+    // values read while an async update was running are from the old firmware too.
+    std::weak_ptr<IPropertyServer> weakPropServer = getPropertyServer().get();
+    weakPropServer.lock()->invalidatePropertyCache();
+    auto callback = [updateCallback, weakPropServer](OBFwUpdateState state, const char *message, uint8_t percent) {
+        if(state == STAT_DONE || state == STAT_DONE_WITH_DUPLICATES || state == STAT_DONE_REBOOT_AND_REUPDATE) {
+            auto propServer = weakPropServer.lock();
+            if(propServer) {
+                propServer->invalidatePropertyCache();
+            }
+        }
+        if(updateCallback) {
+            updateCallback(state, message, percent);
+        }
+    };
+
     auto updater = getComponentT<FirmwareUpdater>(OB_DEV_COMPONENT_FIRMWARE_UPDATER, true);
-    updater->updateFirmwareFromRawDataExt(firmware.data(), static_cast<uint32_t>(firmware.size()), updateCallback, async);
+    updater->updateFirmwareFromRawDataExt(firmware.data(), static_cast<uint32_t>(firmware.size()), callback, async);
 }
 
 void DeviceBase::setFirmwareUpdateState(bool isUpdating) {
@@ -630,6 +650,7 @@ void DeviceBase::updateOptionalDepthPresets(const char filePathList[][OB_PATH_MA
     });
 
     if(success) {
+        getPropertyServer()->invalidatePropertyCache();
         // refresh extension info, device error state and preset list
         fetchExtensionInfo();
         // device error state
@@ -724,6 +745,45 @@ void DeviceBase::checkAndStartHeartbeat() {
 
 void DeviceBase::updateDepthPostProcessingFilterList() {}
 
+void DeviceBase::enablePersistentDataCache(const std::vector<uint32_t> &propertyIds, std::function<std::vector<uint8_t>()> calibrationDataReader) {
+    auto envConfig = EnvConfig::getInstance();
+    bool enable    = false;
+    envConfig->getBooleanValue("Device.PersistentDataCache.Enable", enable);
+    if(!enable) {
+        return;
+    }
+
+#ifdef __ANDROID__
+    std::string cacheDir = "/sdcard/orbbec/ParamCache";
+#else
+    std::string cacheDir = "./ParamCache";
+#endif
+    envConfig->getStringValue("Device.PersistentDataCache.Dir", cacheDir);
+
+    uint64_t calibrationChecksum = 0;
+    if(calibrationDataReader) {
+        std::vector<uint8_t> calibrationData;
+        BEGIN_TRY_EXECUTE({ calibrationData = calibrationDataReader(); })
+        CATCH_EXCEPTION_AND_EXECUTE({ calibrationData.clear(); })
+        if(calibrationData.empty()) {
+            LOG_WARN("Failed to read calibration data for validation, persistent data cache is disabled");
+            return;
+        }
+        calibrationChecksum = PropertyDiskCache::checksum(calibrationData.data(), calibrationData.size());
+    }
+
+    persistentDataCache_ = std::make_shared<PropertyDiskCache>(cacheDir, deviceInfo_->deviceSn_, deviceInfo_->fwVersion_, calibrationChecksum);
+    auto propServer      = getPropertyServer();
+    propServer->setPersistentDataStore(persistentDataCache_, propertyIds);
+}
+
+std::string DeviceBase::getPersistentDataCacheSummary() const {
+    if(!persistentDataCache_) {
+        return "persistent data cache disabled";
+    }
+    return utils::string::to_string() << "persistent data cache hit " << persistentDataCache_->getHitCount() << ", miss " << persistentDataCache_->getMissCount();
+}
+
 void DeviceBase::registerRebootCallback(DeviceRebootCallback callback) {
     if(callback) {
         rebootCallback_ = std::make_shared<DeviceRebootCallback>(std::move(callback));
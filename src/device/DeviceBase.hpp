@@ -13,6 +13,7 @@
 namespace libobsensor {
 
 class Context;
+class PropertyDiskCache;
 
 class DeviceBase : public IDevice {
 private:
@@ -126,6 +127,21 @@ protected:
      */
     void checkAndStartHeartbeat();
 
+    /**
+     * @brief Serve the given read-only properties (calibration params, profile lists...) from the on-disk cache if the
+     *        "PersistentDataCache.Enable" config is true, so they are not fetched from the device on every open.
+     *        The cache is keyed by serial number, firmware version and the checksum of the data returned by calibrationDataReader,
+     *        which is read from the device on every open; on any mismatch the data is fetched from the device again.
+     *
+     * @note Must be called after fetchDeviceInfo().
+     */
+    void enablePersistentDataCache(const std::vector<uint32_t> &propertyIds, std::function<std::vector<uint8_t>()> calibrationDataReader = nullptr);
+
+    /**
+     * @brief Hit/miss summary of the on-disk cache, for the open time logs.
+     */
+    std::string getPersistentDataCacheSummary() const;
+
 protected:
     const std::shared_ptr<const IDeviceEnumInfo> enumInfo_;
     std::shared_ptr<DeviceInfo>                  deviceInfo_;
@@ -149,6 +165,8 @@ private:
 
     std::atomic<bool>                     isFirmwareUpdating_;
     std::shared_ptr<DeviceRebootCallback> rebootCallback_;
+
+    std::shared_ptr<PropertyDiskCache> persistentDataCache_;
 };
 
 }  // namespace libobsensor
@@ -6,6 +6,7 @@
 #include "libobsensor/h/Property.h"
 #include "exception/ObException.hpp"
 
+#include <string>
 #include <vector>
 #include <memory>
 
@@ -68,6 +69,36 @@ public:
     virtual void getRawData(uint32_t propertyId, GetDataCallback callback) = 0;
 };
 
+// Items of the batch property operations, failures are reported per item instead of throwing
+struct PropertyValueItem {
+    uint32_t        propertyId;
+    OBPropertyValue value;
+    bool            success;
+};
+
+struct PropertyRangeItem {
+    uint32_t        propertyId;
+    OBPropertyRange range;
+    bool            success;
+};
+
+class IBatchPropertyAccessor : virtual public IPropertyAccessor {
+public:
+    virtual ~IBatchPropertyAccessor() noexcept override                 = default;
+    virtual void setPropertyValues(std::vector<PropertyValueItem> &items) = 0;
+    virtual void getPropertyValues(std::vector<PropertyValueItem> &items) = 0;
+    virtual void getPropertyRanges(std::vector<PropertyRangeItem> &items) = 0;
+};
+
+// Storage of read-only property data (calibration params, profile lists...) that outlives the device handle
+class IPropertyDataStore {
+public:
+    virtual ~IPropertyDataStore() noexcept = default;
+
+    virtual bool load(const std::string &key, std::vector<uint8_t> &data)        = 0;
+    virtual void store(const std::string &key, const std::vector<uint8_t> &data) = 0;
+};
+
 enum PropertyAccessType {
     PROP_ACCESS_USER     = 1,  // User access(by sdk user api)
     PROP_ACCESS_INTERNAL = 2,  // Internal access (by sdk or other internal modules)
@@ -115,6 +146,20 @@ public:
 
     virtual const std::vector<uint8_t> &getStructureDataListProtoV1_1(uint32_t propertyId, uint16_t cmdVersion, PropertyAccessType accessType) = 0;
 
+    // Batch operations: the requests of properties served by the same accessor are sent together when the accessor supports it.
+    // The vendor ports still send the requests of a batch one by one, see IVendorDataPort::sendAndReceiveBatch
+    virtual void setPropertyValues(std::vector<PropertyValueItem> &items, PropertyAccessType accessType) = 0;
+    virtual void getPropertyValues(std::vector<PropertyValueItem> &items, PropertyAccessType accessType) = 0;
+    virtual void getPropertyRanges(std::vector<PropertyRangeItem> &items, PropertyAccessType accessType) = 0;
+
+    // Opt-in cache of property values read from the device. invalidatePropertyCache does not block, it may be called from any thread.
+    virtual void                      setPropertyCachePolicy(uint32_t propertyId, OBPropertyCachePolicy policy, uint32_t ttlMs) = 0;
+    virtual void                      invalidatePropertyCache()                                                               = 0;
+    virtual OBPropertyCacheStatistics getPropertyCacheStatistics() const                                                      = 0;
+
+    // Reads of the given read-only properties are served from the store once it holds their data
+    virtual void setPersistentDataStore(std::shared_ptr<IPropertyDataStore> store, const std::vector<uint32_t> &propertyIds) = 0;
+
 public:  // template functions to simplify the usage of IPropertyServer
     template <typename T>
     typename std::enable_if<!std::is_same<T, float>::value, void>::type setPropertyValueT(uint32_t propertyId, const T &value,
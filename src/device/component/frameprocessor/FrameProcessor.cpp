@@ -33,6 +33,11 @@ FrameProcessorFactory::FrameProcessorFactory(IDevice *owner) : DeviceComponentBa
         context_->destroy_context   = dylib_->get_function<void(ob_frame_processor_context *, ob_error **)>("ob_destroy_frame_processor_context");
         context_->set_hardware_d2c_params = dylib->get_function<void(ob_frame_processor *, ob_camera_intrinsic, uint8_t, float, int16_t, int16_t, int16_t,
                                                                      int16_t, bool, bool, ob_error **error)>("ob_frame_processor_set_hardware_d2c_params");
+        if(dylib_->has_symbol("ob_frame_processor_get_capabilities") && dylib_->has_symbol("ob_frame_processor_process_frame_into")) {
+            context_->get_capabilities   = dylib_->get_function<uint32_t(ob_frame_processor *, ob_error **)>("ob_frame_processor_get_capabilities");
+            context_->process_frame_into = dylib_->get_function<bool(ob_frame_processor *, const ob_frame *, ob_frame *, ob_error **)>(
+                "ob_frame_processor_process_frame_into");
+        }
     }
     if(context_->create_context && !context_->context) {
         auto cDevice      = new ob_device;
@@ -100,7 +105,12 @@ std::shared_ptr<FrameProcessor> FrameProcessorFactory::createFrameProcessor(OBSe
 }
 
 FrameProcessor::FrameProcessor(IDevice *owner, std::shared_ptr<FrameProcessorContext> context, OBSensorType sensorType)
-    : FilterExtension("FrameProcessor"), DeviceComponentBase(owner), context_(context), privateProcessor_(nullptr), sensorType_(sensorType) {
+    : FilterExtension("FrameProcessor"),
+      DeviceComponentBase(owner),
+      context_(context),
+      privateProcessor_(nullptr),
+      capabilities_(0),
+      sensorType_(sensorType) {
     if(context_->context && context_->create_processor) {
         ob_error *error   = nullptr;
         privateProcessor_ = context_->create_processor(context_->context, sensorType, &error);
@@ -111,6 +121,16 @@ FrameProcessor::FrameProcessor(IDevice *owner, std::shared_ptr<FrameProcessorCon
         }
     }
 
+    if(privateProcessor_ && context_->get_capabilities) {
+        ob_error *error = nullptr;
+        capabilities_   = context_->get_capabilities(privateProcessor_, &error);
+        if(error) {
+            LOG_WARN("Get frame processor capabilities failed: {}", error->message);
+            capabilities_ = 0;
+            delete error;
+        }
+    }
+
     if(context_->context && context_->get_config_schema) {
         ob_error   *error  = nullptr;
         const char *schema = context_->get_config_schema(privateProcessor_, &error);
@@ -135,26 +155,47 @@ FrameProcessor::~FrameProcessor() noexcept {
 
 std::shared_ptr<Frame> FrameProcessor::process(std::shared_ptr<const Frame> frame) {
     if(!context_->process_frame || !privateProcessor_) {
-        return FrameFactory::createFrameFromOtherFrame(frame, true);
+        return FrameFactory::createFrameView(frame);
     }
 
     checkAndUpdateConfig();
 
-    ob_frame              *c_frame = new ob_frame();
-    ob_error              *error   = nullptr;
-    std::shared_ptr<Frame> resultFrame;
-    c_frame->frame = std::const_pointer_cast<Frame>(frame);
+    // nobody else can see the frame if this is the only reference and the data is its own, so it can be overwritten
+    bool exclusive = frame.use_count() == 1 && !frame->isDataShared();
 
-    auto rst_frame = context_->process_frame(privateProcessor_, c_frame, &error);
+    ob_frame  inFrame;
+    ob_error *error = nullptr;
+    inFrame.frame   = std::const_pointer_cast<Frame>(frame);
+
+    if((capabilities_ & OB_FRAME_PROCESSOR_CAP_PROCESS_INTO) && context_->process_frame_into) {
+        ob_frame outFrame;
+        if(exclusive && (capabilities_ & OB_FRAME_PROCESSOR_CAP_IN_PLACE)) {
+            outFrame.frame = inFrame.frame;
+        }
+        else {
+            outFrame.frame = FrameFactory::createFrameFromOtherFrame(frame);
+        }
+
+        bool processed = context_->process_frame_into(privateProcessor_, &inFrame, &outFrame, &error);
+        if(error) {
+            delete error;
+            return FrameFactory::createFrameView(frame);
+        }
+        if(processed) {
+            return outFrame.frame;
+        }
+    }
+
+    std::shared_ptr<Frame> resultFrame;
+    auto                   rst_frame = context_->process_frame(privateProcessor_, &inFrame, &error);
     if(rst_frame) {
         resultFrame = rst_frame->frame;
         delete rst_frame;
     }
-    delete c_frame;
 
     if(error) {
         delete error;
-        return FrameFactory::createFrameFromOtherFrame(frame, true);
+        return FrameFactory::createFrameView(frame);
     }
 
     return resultFrame;
@@ -23,6 +23,10 @@ struct FrameProcessorContext {
     pfunc_ob_destroy_frame_processor                 destroy_processor       = nullptr;
     pfunc_ob_destroy_frame_processor_context         destroy_context         = nullptr;
     pfunc_ob_frame_processor_set_hardware_d2c_params set_hardware_d2c_params = nullptr;
+
+    // optional, older processor libraries only have process_frame
+    pfunc_ob_frame_processor_get_capabilities   get_capabilities   = nullptr;
+    pfunc_ob_frame_processor_process_frame_into process_frame_into = nullptr;
 };
 
 class FrameProcessorFactory : public DeviceComponentBase {
@@ -64,6 +68,8 @@ protected:
 
     ob_frame_processor *privateProcessor_;
 
+    uint32_t capabilities_;  // OB_FRAME_PROCESSOR_CAP_* of the private processor
+
 private:
     OBSensorType sensorType_;
 
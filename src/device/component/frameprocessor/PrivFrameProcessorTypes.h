@@ -22,6 +22,24 @@ typedef void (*pfunc_ob_frame_processor_update_config)(ob_frame_processor *proce
 
 typedef ob_frame *(*pfunc_ob_frame_processor_process_frame)(ob_frame_processor *processor, ob_frame *frame, ob_error **error);
 
+/**
+ * @brief Capability flags returned by @ref pfunc_ob_frame_processor_get_capabilities (optional symbol "ob_frame_processor_get_capabilities")
+ */
+#define OB_FRAME_PROCESSOR_CAP_PROCESS_INTO 0x01  // ob_frame_processor_process_frame_into is supported
+#define OB_FRAME_PROCESSOR_CAP_IN_PLACE     0x02  // ob_frame_processor_process_frame_into accepts the input frame as the output frame
+
+typedef uint32_t (*pfunc_ob_frame_processor_get_capabilities)(ob_frame_processor *processor, ob_error **error);
+
+/**
+ * @brief Process a frame into an output frame provided by the caller (optional symbol "ob_frame_processor_process_frame_into")
+ * @brief The output frame is acquired from the frame memory pool with the stream profile and info of the input frame, or is the input frame
+ * itself when the processor has OB_FRAME_PROCESSOR_CAP_IN_PLACE and the caller holds the only reference to it.
+ *
+ * @return true if the result has been written to out_frame. false if this frame needs another output (e.g. another resolution), the
+ * frames must then be left untouched and the caller falls back to ob_frame_processor_process_frame.
+ */
+typedef bool (*pfunc_ob_frame_processor_process_frame_into)(ob_frame_processor *processor, const ob_frame *frame, ob_frame *out_frame, ob_error **error);
+
 typedef void (*pfunc_ob_destroy_frame_processor)(ob_frame_processor *processor, ob_error **error);
 
 typedef void (*pfunc_ob_destroy_frame_processor_context)(ob_frame_processor_context *context, ob_error **error);
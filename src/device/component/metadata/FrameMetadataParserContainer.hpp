@@ -6,6 +6,7 @@
 #include "IFrame.hpp"
 #include "DeviceComponentBase.hpp"
 #include "exception/ObException.hpp"
+#include "logger/Logger.hpp"
 #include "utils/Utils.hpp"
 
 #include <map>
@@ -32,6 +33,24 @@ public:
         return parsers[type];
     }
 
+    virtual uint64_t parseAll(const uint8_t *metadata, size_t dataSize, int64_t *values, uint64_t skipMask) override {
+        uint64_t validMask = 0;
+        for(auto &item: parsers) {
+            auto type = static_cast<uint32_t>(item.first);
+            if(type >= OB_FRAME_METADATA_TYPE_COUNT || (skipMask & (1ULL << type))) {
+                continue;
+            }
+            BEGIN_TRY_EXECUTE({
+                if(item.second->isSupported(metadata, dataSize)) {
+                    values[type] = item.second->getValue(metadata, dataSize);
+                    validMask |= 1ULL << type;
+                }
+            })
+            CATCH_EXCEPTION
+        }
+        return validMask;
+    }
+
 protected:
     std::map<OBFrameMetadataType, std::shared_ptr<IFrameMetadataParser>> parsers;
 
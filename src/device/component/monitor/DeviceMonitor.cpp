@@ -4,6 +4,7 @@
 #include "DeviceMonitor.hpp"
 #include "protocol/Protocol.hpp"
 #include "property/InternalProperty.hpp"
+#include "IProperty.hpp"
 #include "exception/ObException.hpp"
 #include "logger/LoggerSnWrapper.hpp"  // Must be included last to override log macros
 
@@ -39,6 +40,12 @@ DeviceMonitor::DeviceMonitor(IDevice *owner, std::shared_ptr<ISourcePort> dataPo
     if(activityRecorder) {
         activityRecorder_ = activityRecorder.get();
     }
+
+    // resolved once: the property server is a lock-required component, the heartbeat thread must not take the device resource lock
+    auto propServer = owner->getComponentT<IPropertyServer>(OB_DEV_COMPONENT_PROPERTY_SERVER, false);
+    if(propServer) {
+        propertyServer_ = propServer.get();
+    }
 }
 
 DeviceMonitor::~DeviceMonitor() noexcept {
@@ -116,7 +123,15 @@ void DeviceMonitor::heartbeatAndFetchState() {
         emitNextHeartBeatImmediately = (bool)(resp->state >> 63);
 
         // Get status code (excluding cache flag 1 bit)
-        devState_ = (OBDeviceState)(resp->state & 0x7FFFFFFFFFFFFFFF);
+        auto prevState = devState_;
+        devState_      = (OBDeviceState)(resp->state & 0x7FFFFFFFFFFFFFFF);
+        if(devState_ != prevState) {
+            // the firmware changed state (e.g. an error was raised or cleared), the property values read before may no longer hold
+            auto propServer = propertyServer_.lock();
+            if(propServer) {
+                propServer->invalidatePropertyCache();
+            }
+        }
 
         // The remaining information is msg
         auto msgSize = resp->header.sizeInHalfWords * 2 - 10;  // Remove header.error and state, the remaining is msg
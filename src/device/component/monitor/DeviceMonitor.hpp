@@ -7,6 +7,7 @@
 #include "ISourcePort.hpp"
 #include "DeviceComponentBase.hpp"
 #include "DeviceActivityRecorder.hpp"
+#include "IProperty.hpp"
 #include <map>
 
 namespace libobsensor {
@@ -57,5 +58,6 @@ private:
     OBDeviceState devState_;
 
     std::shared_ptr<IDeviceActivityRecorder> activityRecorder_;
+    std::weak_ptr<IPropertyServer>           propertyServer_;  // its cache is invalidated when the device state changes
 };
 }  // namespace libobsensor
@@ -0,0 +1,128 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#include "PropertyDiskCache.hpp"
+#include "logger/Logger.hpp"
+#include "utils/FileUtils.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+namespace libobsensor {
+
+namespace {
+const uint32_t CACHE_FILE_MAGIC   = 0x4350424f;  // "OBPC"
+const uint32_t CACHE_FILE_VERSION = 1;
+const uint64_t MAX_DATA_SIZE      = 16 * 1024 * 1024;
+
+#pragma pack(push, 1)
+struct CacheFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t tag;
+    uint64_t dataSize;
+    uint64_t dataChecksum;
+};
+#pragma pack(pop)
+
+std::string toFileName(const std::string &str) {
+    std::string name;
+    for(auto c: str) {
+        bool valid = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '-' || c == '_';
+        name.push_back(valid ? c : '_');
+    }
+    return name.empty() ? "unknown" : name;
+}
+}  // namespace
+
+PropertyDiskCache::PropertyDiskCache(const std::string &cacheDir, const std::string &serialNumber, const std::string &firmwareVersion,
+                                     uint64_t calibrationChecksum)
+    : dir_(utils::joinPaths(cacheDir, toFileName(serialNumber))), hitCount_(0), missCount_(0) {
+    tag_ = checksum(reinterpret_cast<const uint8_t *>(firmwareVersion.data()), firmwareVersion.size());
+    tag_ = checksum(reinterpret_cast<const uint8_t *>(&calibrationChecksum), sizeof(calibrationChecksum), tag_);
+    LOG_DEBUG("Property disk cache: {}, tag: {:016x}", dir_, tag_);
+}
+
+bool PropertyDiskCache::load(const std::string &key, std::vector<uint8_t> &data) {
+    std::ifstream file(getFilePath(key), std::ios::binary);
+    if(!file.is_open()) {
+        missCount_++;
+        return false;
+    }
+
+    CacheFileHeader header = {};
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if(!file || header.magic != CACHE_FILE_MAGIC || header.version != CACHE_FILE_VERSION || header.tag != tag_
+       || header.dataSize > MAX_DATA_SIZE) {
+        LOG_DEBUG("Property disk cache entry {} is outdated", key);
+        missCount_++;
+        return false;
+    }
+
+    std::vector<uint8_t> buffer(static_cast<size_t>(header.dataSize));
+    file.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    if(!file || checksum(buffer.data(), buffer.size()) != header.dataChecksum) {
+        LOG_WARN("Property disk cache entry {} is corrupted, it will be fetched from device", key);
+        missCount_++;
+        return false;
+    }
+
+    data.swap(buffer);
+    hitCount_++;
+    return true;
+}
+
+void PropertyDiskCache::store(const std::string &key, const std::vector<uint8_t> &data) {
+    if(!utils::checkDir(dir_.c_str()) && utils::mkDirs(dir_.c_str()) != 0) {
+        LOG_WARN("Failed to create property disk cache directory: {}", dir_);
+        return;
+    }
+
+    // write to a temporary file first, so an interrupted write never leaves a truncated entry behind
+    auto filePath = getFilePath(key);
+    auto tmpPath  = filePath + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if(!file.is_open()) {
+            LOG_WARN("Failed to write property disk cache entry: {}", tmpPath);
+            return;
+        }
+        CacheFileHeader header = { CACHE_FILE_MAGIC, CACHE_FILE_VERSION, tag_, data.size(), checksum(data.data(), data.size()) };
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+        if(!file) {
+            LOG_WARN("Failed to write property disk cache entry: {}", tmpPath);
+            file.close();
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+    std::remove(filePath.c_str());
+    if(std::rename(tmpPath.c_str(), filePath.c_str()) != 0) {
+        LOG_WARN("Failed to write property disk cache entry: {}", filePath);
+        std::remove(tmpPath.c_str());
+    }
+}
+
+uint32_t PropertyDiskCache::getHitCount() const {
+    return hitCount_.load();
+}
+
+uint32_t PropertyDiskCache::getMissCount() const {
+    return missCount_.load();
+}
+
+uint64_t PropertyDiskCache::checksum(const uint8_t *data, size_t size, uint64_t seed) {
+    uint64_t hash = seed;
+    for(size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::string PropertyDiskCache::getFilePath(const std::string &key) const {
+    return utils::joinPaths(dir_, toFileName(key) + ".bin");
+}
+
+}  // namespace libobsensor
@@ -0,0 +1,41 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "IProperty.hpp"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace libobsensor {
+
+// On-disk store of the read-only property data of one device, one file per key in a directory per serial number.
+// Every file is tagged with the firmware version and the calibration checksum it was read with; files with another tag or
+// a corrupted payload are treated as missing and are rewritten on the next store.
+class PropertyDiskCache : public IPropertyDataStore {
+public:
+    PropertyDiskCache(const std::string &cacheDir, const std::string &serialNumber, const std::string &firmwareVersion, uint64_t calibrationChecksum);
+    ~PropertyDiskCache() noexcept override = default;
+
+    bool load(const std::string &key, std::vector<uint8_t> &data) override;
+    void store(const std::string &key, const std::vector<uint8_t> &data) override;
+
+    uint32_t getHitCount() const;
+    uint32_t getMissCount() const;
+
+    // FNV-1a 64 bit hash, used for the calibration checksum and the payload checksum
+    static uint64_t checksum(const uint8_t *data, size_t size, uint64_t seed = 0xcbf29ce484222325ULL);
+
+private:
+    std::string getFilePath(const std::string &key) const;
+
+private:
+    std::string           dir_;
+    uint64_t              tag_;
+    std::atomic<uint32_t> hitCount_;
+    std::atomic<uint32_t> missCount_;
+};
+
+}  // namespace libobsensor
@@ -5,6 +5,7 @@
 #include "exception/ObException.hpp"
 #include "logger/Logger.hpp"
 #include "utils/Utils.hpp"
+#include <algorithm>
 #include <memory>
 
 #include "logger/LoggerSnWrapper.hpp"  // Must be included last to override log macros
@@ -21,7 +22,7 @@ const std::string &PropertyServer::GetCurrentSN() const {
     return unknown;
 }
 
-PropertyServer::PropertyServer(IDevice *owner) : DeviceComponentBase(owner) {}
+PropertyServer::PropertyServer(IDevice *owner) : DeviceComponentBase(owner), cacheInvalidated_(false), cacheHitCount_(0), cacheMissCount_(0) {}
 
 void PropertyServer::registerProperty(uint32_t propertyId, OBPermissionType userPerms, OBPermissionType intPerms, std::shared_ptr<IPropertyAccessor> accessor) {
     properties_[propertyId] = { propertyId, userPerms, intPerms, accessor };
@@ -68,6 +69,7 @@ void PropertyServer::unregisterAllProperties() {
     innerPropertiesVec_.clear();
     userPropertiesVec_.clear();
     properties_.clear();
+    cache_.clear();
 }
 
 void addProperty(std::vector<OBPropertyItem> &vec, int propertyId, const char *propName, OBPropertyType propType, OBPermissionType perms) {
@@ -195,7 +197,8 @@ void PropertyServer::setPropertyValue(uint32_t propertyId, OBPropertyValue value
     }
 
     utils::Timer timer;
-    auto         basicAccessor = std::dynamic_pointer_cast<IBasicPropertyAccessor>(accessor);
+    invalidateCacheItem(propId);
+    auto basicAccessor = std::dynamic_pointer_cast<IBasicPropertyAccessor>(accessor);
     basicAccessor->setPropertyValue(propId, value);
 
     for(auto &callback: it->second.accessCallbacks) {
@@ -222,8 +225,21 @@ void PropertyServer::getPropertyValue(uint32_t propertyId, OBPropertyValue *valu
     }
 
     utils::Timer timer;
-    auto         basicAccessor = std::dynamic_pointer_cast<IBasicPropertyAccessor>(accessor);
-    basicAccessor->getPropertyValue(propId, value);
+    auto         cacheItem = findCacheItem(propId);
+    if(cacheItem && cacheItem->valueValid) {
+        *value = cacheItem->value;
+        cacheHitCount_++;
+    }
+    else {
+        auto basicAccessor = std::dynamic_pointer_cast<IBasicPropertyAccessor>(accessor);
+        basicAccessor->getPropertyValue(propId, value);
+        if(cacheItem) {
+            cacheItem->value        = *value;
+            cacheItem->valueValid   = true;
+            cacheItem->updateTimeMs = utils::getNowTimesMs();
+            cacheMissCount_++;
+        }
+    }
 
     for(auto &callback: it->second.accessCallbacks) {
         auto data = reinterpret_cast<uint8_t *>(value);
@@ -280,6 +296,8 @@ void PropertyServer::setStructureData(uint32_t propertyId, const std::vector<uin
         THROW_INVALID_DATA_EXCEPTION(utils::string::to_string() << "Property" << propId << " does not support structure data setting");
     }
     utils::Timer timer;
+    // A structured write may change several properties at once (e.g. presets, work modes)
+    invalidatePropertyCache();
     structAccessor->setStructureData(propId, data);
     for(auto &callback: it->second.accessCallbacks) {
         callback(propertyId, data.data(), data.size(), PROP_OP_WRITE);
@@ -308,7 +326,17 @@ const std::vector<uint8_t> &PropertyServer::getStructureData(uint32_t propertyId
         THROW_INVALID_DATA_EXCEPTION(utils::string::to_string() << "Property " << propId << " does not support structure data getting");
     }
     utils::Timer timer;
-    const auto  &data = structAccessor->getStructureData(propId);
+    auto         cacheItem = findCacheItem(propId);
+    if(cacheItem && cacheItem->dataValid) {
+        cacheHitCount_++;
+    }
+    else if(cacheItem) {
+        cacheItem->data         = structAccessor->getStructureData(propId);
+        cacheItem->dataValid    = true;
+        cacheItem->updateTimeMs = utils::getNowTimesMs();
+        cacheMissCount_++;
+    }
+    const auto &data = cacheItem ? cacheItem->data : structAccessor->getStructureData(propId);
     for(auto &callback: it->second.accessCallbacks) {
         callback(propertyId, data.data(), data.size(), PROP_OP_READ);
     }
@@ -337,7 +365,12 @@ void PropertyServer::getRawData(uint32_t propertyId, GetDataCallback callback, P
     }
 
     utils::Timer timer;
-    rawDataAccessor->getRawData(propId, callback);  // todo: add async support
+    if(isPersistentProperty(propId)) {
+        getRawDataWithDataStore(propId, rawDataAccessor, callback);
+    }
+    else {
+        rawDataAccessor->getRawData(propId, callback);  // todo: add async support
+    }
     for(auto &accessCallback: it->second.accessCallbacks) {
         accessCallback(propertyId, nullptr, 0, PROP_OP_READ);
     }
@@ -390,7 +423,10 @@ const std::vector<uint8_t> &PropertyServer::getStructureDataProtoV1_1(uint32_t p
         THROW_INVALID_DATA_EXCEPTION(utils::string::to_string() << "Property" << propId << " does not support structure data getting over proto v1.1");
     }
     utils::Timer timer;
-    const auto  &data = structAccessor->getStructureDataProtoV1_1(propId, cmdVersion);
+    const auto  &data = isPersistentProperty(propId)
+                            ? loadOrFetchPersistentData("struct_" + std::to_string(propId) + "_" + std::to_string(cmdVersion),
+                                                        [&]() -> const std::vector<uint8_t> & { return structAccessor->getStructureDataProtoV1_1(propId, cmdVersion); })
+                            : structAccessor->getStructureDataProtoV1_1(propId, cmdVersion);
     for(auto callback: it->second.accessCallbacks) {
         callback(propertyId, data.data(), data.size(), PROP_OP_READ);
     }
@@ -418,6 +454,7 @@ void PropertyServer::setStructureDataProtoV1_1(uint32_t propertyId, const std::v
         THROW_INVALID_DATA_EXCEPTION(utils::string::to_string() << "Property" << propId << " does not support structure data setting over proto v1.1");
     }
     utils::Timer timer;
+    invalidatePropertyCache();
     structAccessor->setStructureDataProtoV1_1(propId, data, cmdVersion);
     for(auto callback: it->second.accessCallbacks) {
         callback(propertyId, data.data(), data.size(), PROP_OP_WRITE);
@@ -445,7 +482,10 @@ const std::vector<uint8_t> &PropertyServer::getStructureDataListProtoV1_1(uint32
         THROW_INVALID_DATA_EXCEPTION(utils::string::to_string() << "Property" << propId << " does not support structure data list getting over proto v1.1");
     }
     utils::Timer timer;
-    const auto  &data = structAccessor->getStructureDataListProtoV1_1(propId, cmdVersion);
+    const auto  &data = isPersistentProperty(propId)
+                            ? loadOrFetchPersistentData("list_" + std::to_string(propId) + "_" + std::to_string(cmdVersion),
+                                                        [&]() -> const std::vector<uint8_t> & { return structAccessor->getStructureDataListProtoV1_1(propId, cmdVersion); })
+                            : structAccessor->getStructureDataListProtoV1_1(propId, cmdVersion);
     for(auto callback: it->second.accessCallbacks) {
         callback(propertyId, data.data(), data.size(), PROP_OP_READ);
     }
@@ -484,6 +524,7 @@ void PropertyServer::unregisterProperty(uint32_t propertyId) {
         return;
     }
     properties_.erase(propertyId);
+    cache_.erase(propertyId);
 
     auto infoIter = OBPropertyBaseInfoMap.find(propertyId);
     if(infoIter == OBPropertyBaseInfoMap.end()) {
@@ -500,4 +541,292 @@ void PropertyServer::unregisterProperty(uint32_t propertyId) {
             innerPropertiesVec_.end());
     }
 }
+
+template <typename Item>
+std::vector<std::pair<std::shared_ptr<IPropertyAccessor>, std::vector<size_t>>>
+PropertyServer::groupByAccessor(std::vector<Item> &items, PropertyOperationType operationType, PropertyAccessType accessType) {
+    std::vector<std::pair<std::shared_ptr<IPropertyAccessor>, std::vector<size_t>>> groups;
+    for(size_t i = 0; i < items.size(); i++) {
+        items[i].success = false;
+        if(!isPropertySupported(items[i].propertyId, operationType, accessType)) {
+            LOG_WARN("Property {} is not supported for the batch operation {}", items[i].propertyId, static_cast<int>(operationType));
+            continue;
+        }
+
+        auto &accessor = properties_.find(items[i].propertyId)->second.accessor;
+        auto  groupIt  = std::find_if(groups.begin(), groups.end(), [&accessor](const std::pair<std::shared_ptr<IPropertyAccessor>, std::vector<size_t>> &group) {
+            return group.first == accessor;
+        });
+        if(groupIt == groups.end()) {
+            groups.push_back({ accessor, { i } });
+        }
+        else {
+            groupIt->second.push_back(i);
+        }
+    }
+    return groups;
+}
+
+void PropertyServer::setPropertyValues(std::vector<PropertyValueItem> &items, PropertyAccessType accessType) {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    checkAccessMode(PROP_OP_WRITE);
+
+    utils::Timer timer;
+    auto         groups = groupByAccessor(items, PROP_OP_WRITE, accessType);
+    for(auto &group: groups) {
+        // the accessors work on the resolved property ids
+        std::vector<PropertyValueItem> batchItems;
+        for(auto index: group.second) {
+            auto propId = properties_.find(items[index].propertyId)->second.propertyId;
+            invalidateCacheItem(propId);
+            batchItems.push_back({ propId, items[index].value, false });
+        }
+
+        auto batchAccessor = std::dynamic_pointer_cast<IBatchPropertyAccessor>(group.first);
+        if(batchAccessor) {
+            batchAccessor->setPropertyValues(batchItems);
+        }
+        else {
+            auto basicAccessor = std::dynamic_pointer_cast<IBasicPropertyAccessor>(group.first);
+            for(auto &item: batchItems) {
+                BEGIN_TRY_EXECUTE({
+                    basicAccessor->setPropertyValue(item.propertyId, item.value);
+                    item.success = true;
+                })
+                CATCH_EXCEPTION_AND_EXECUTE({ LOG_WARN("Failed to set property {} in batch", item.propertyId); })
+            }
+        }
+
+        for(size_t i = 0; i < group.second.size(); i++) {
+            auto &item   = items[group.second[i]];
+            item.success = batchItems[i].success;
+            if(!item.success) {
+                continue;
+            }
+            for(auto &callback: properties_.find(item.propertyId)->second.accessCallbacks) {
+                auto data = reinterpret_cast<uint8_t *>(&item.value);
+                callback(item.propertyId, data, sizeof(OBPropertyValue), PROP_OP_WRITE);
+            }
+        }
+    }
+    auto delta = timer.touchUs();
+    LOG_DEBUG("[delta: {}us] {} properties set in batch", delta, items.size());
+}
+
+void PropertyServer::getPropertyValues(std::vector<PropertyValueItem> &items, PropertyAccessType accessType) {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    checkAccessMode(PROP_OP_READ);
+
+    utils::Timer timer;
+    auto         groups = groupByAccessor(items, PROP_OP_READ, accessType);
+    for(auto &group: groups) {
+        // serve the cached values first, only the misses are sent to the accessor
+        std::vector<PropertyValueItem> batchItems;
+        std::vector<size_t>            batchIndices;
+        for(auto index: group.second) {
+            auto propId    = properties_.find(items[index].propertyId)->second.propertyId;
+            auto cacheItem = findCacheItem(propId);
+            if(cacheItem && cacheItem->valueValid) {
+                items[index].value   = cacheItem->value;
+                items[index].success = true;
+                cacheHitCount_++;
+                continue;
+            }
+            batchItems.push_back({ propId, {}, false });
+            batchIndices.push_back(index);
+        }
+
+        auto batchAccessor = std::dynamic_pointer_cast<IBatchPropertyAccessor>(group.first);
+        if(batchAccessor) {
+            if(!batchItems.empty()) {
+                batchAccessor->getPropertyValues(batchItems);
+            }
+        }
+        else {
+            auto basicAccessor = std::dynamic_pointer_cast<IBasicPropertyAccessor>(group.first);
+            for(auto &item: batchItems) {
+                BEGIN_TRY_EXECUTE({
+                    basicAccessor->getPropertyValue(item.propertyId, &item.value);
+                    item.success = true;
+                })
+                CATCH_EXCEPTION_AND_EXECUTE({ LOG_WARN("Failed to get property {} in batch", item.propertyId); })
+            }
+        }
+
+        for(size_t i = 0; i < batchItems.size(); i++) {
+            auto &item     = items[batchIndices[i]];
+            item.value     = batchItems[i].value;
+            item.success   = batchItems[i].success;
+            auto cacheItem = item.success ? findCacheItem(batchItems[i].propertyId) : nullptr;
+            if(cacheItem) {
+                cacheItem->value        = item.value;
+                cacheItem->valueValid   = true;
+                cacheItem->updateTimeMs = utils::getNowTimesMs();
+                cacheMissCount_++;
+            }
+        }
+
+        for(auto index: group.second) {
+            auto &item = items[index];
+            if(!item.success) {
+                continue;
+            }
+            for(auto &callback: properties_.find(item.propertyId)->second.accessCallbacks) {
+                auto data = reinterpret_cast<uint8_t *>(&item.value);
+                callback(item.propertyId, data, sizeof(OBPropertyValue), PROP_OP_READ);
+            }
+        }
+    }
+    auto delta = timer.touchUs();
+    LOG_DEBUG("[delta: {}us] {} properties get in batch", delta, items.size());
+}
+
+void PropertyServer::getPropertyRanges(std::vector<PropertyRangeItem> &items, PropertyAccessType accessType) {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    checkAccessMode(PROP_OP_READ);
+
+    utils::Timer timer;
+    auto         groups = groupByAccessor(items, PROP_OP_READ, accessType);
+    for(auto &group: groups) {
+        std::vector<PropertyRangeItem> batchItems;
+        for(auto index: group.second) {
+            batchItems.push_back({ properties_.find(items[index].propertyId)->second.propertyId, {}, false });
+        }
+
+        auto batchAccessor = std::dynamic_pointer_cast<IBatchPropertyAccessor>(group.first);
+        if(batchAccessor) {
+            batchAccessor->getPropertyRanges(batchItems);
+        }
+        else {
+            auto basicAccessor = std::dynamic_pointer_cast<IBasicPropertyAccessor>(group.first);
+            for(auto &item: batchItems) {
+                BEGIN_TRY_EXECUTE({
+                    basicAccessor->getPropertyRange(item.propertyId, &item.range);
+                    item.success = true;
+                })
+                CATCH_EXCEPTION_AND_EXECUTE({ LOG_WARN("Failed to get range of property {} in batch", item.propertyId); })
+            }
+        }
+
+        for(size_t i = 0; i < group.second.size(); i++) {
+            items[group.second[i]].range   = batchItems[i].range;
+            items[group.second[i]].success = batchItems[i].success;
+        }
+    }
+    auto delta = timer.touchUs();
+    LOG_DEBUG("[delta: {}us] {} property ranges get in batch", delta, items.size());
+}
+
+void PropertyServer::setPropertyCachePolicy(uint32_t propertyId, OBPropertyCachePolicy policy, uint32_t ttlMs) {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    auto                                  it = properties_.find(propertyId);
+    if(it == properties_.end()) {
+        THROW_INVALID_PARAM_EXCEPTION(utils::string::to_string() << "Property not found to set cache policy, propertyId: " << propertyId);
+    }
+    if(policy == OB_PROPERTY_CACHE_TTL && ttlMs == 0) {
+        THROW_INVALID_PARAM_EXCEPTION("Invalid ttl for property cache, must be greater than 0");
+    }
+
+    auto propId = it->second.propertyId;
+    if(policy == OB_PROPERTY_CACHE_VOLATILE) {
+        cache_.erase(propId);
+    }
+    else {
+        cache_[propId] = { policy, ttlMs, false, {}, false, {}, 0 };
+    }
+    LOG_DEBUG("Property {} cache policy set to {}, ttl {}ms", propId, static_cast<int>(policy), ttlMs);
+}
+
+void PropertyServer::invalidatePropertyCache() {
+    // Does not take mutex_: the heartbeat thread of the device monitor calls it, and a write of OB_PROP_HEARTBEAT_BOOL holds mutex_ while
+    // it stops that thread. The cached values are dropped by the next lookup.
+    cacheInvalidated_ = true;
+}
+
+OBPropertyCacheStatistics PropertyServer::getPropertyCacheStatistics() const {
+    return { cacheHitCount_.load(), cacheMissCount_.load() };
+}
+
+PropertyServer::PropertyCacheItem *PropertyServer::findCacheItem(uint32_t propId) {
+    if(cacheInvalidated_.exchange(false)) {
+        for(auto &item: cache_) {
+            item.second.valueValid = false;
+            item.second.dataValid  = false;
+        }
+    }
+
+    auto it = cache_.find(propId);
+    if(it == cache_.end()) {
+        return nullptr;
+    }
+
+    auto &item = it->second;
+    if(item.policy == OB_PROPERTY_CACHE_TTL && utils::getNowTimesMs() - item.updateTimeMs >= item.ttlMs) {
+        item.valueValid = false;
+        item.dataValid  = false;
+    }
+    return &item;
+}
+
+void PropertyServer::invalidateCacheItem(uint32_t propId) {
+    auto it = cache_.find(propId);
+    if(it != cache_.end()) {
+        it->second.valueValid = false;
+        it->second.dataValid  = false;
+    }
+}
+
+void PropertyServer::setPersistentDataStore(std::shared_ptr<IPropertyDataStore> store, const std::vector<uint32_t> &propertyIds) {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    dataStore_ = store;
+    persistentProperties_.clear();
+    persistentDataBuffers_.clear();
+    if(dataStore_) {
+        persistentProperties_.insert(propertyIds.begin(), propertyIds.end());
+    }
+}
+
+bool PropertyServer::isPersistentProperty(uint32_t propId) const {
+    return dataStore_ && persistentProperties_.count(propId);
+}
+
+const std::vector<uint8_t> &PropertyServer::loadOrFetchPersistentData(const std::string &key, const std::function<const std::vector<uint8_t> &()> &fetch) {
+    auto &buffer = persistentDataBuffers_[key];
+    if(!dataStore_->load(key, buffer)) {
+        buffer = fetch();
+        if(!buffer.empty()) {
+            dataStore_->store(key, buffer);
+        }
+    }
+    return buffer;
+}
+
+void PropertyServer::getRawDataWithDataStore(uint32_t propId, const std::shared_ptr<IRawDataAccessor> &accessor, GetDataCallback callback) {
+    auto                 key = "raw_" + std::to_string(propId);
+    std::vector<uint8_t> data;
+    if(dataStore_->load(key, data)) {
+        // replay the stored data as a single chunk
+        auto        dataSize  = static_cast<uint32_t>(data.size());
+        OBDataChunk dataChunk = { data.data(), dataSize, 0, dataSize };
+        if(callback) {
+            callback(DATA_TRAN_STAT_TRANSFERRING, &dataChunk);
+            dataChunk = { nullptr, 0, dataSize, dataSize };
+            callback(DATA_TRAN_STAT_DONE, &dataChunk);
+        }
+        return;
+    }
+
+    accessor->getRawData(propId, [&](OBDataTranState state, OBDataChunk *dataChunk) {
+        if(state == DATA_TRAN_STAT_TRANSFERRING) {
+            data.insert(data.end(), dataChunk->data, dataChunk->data + dataChunk->size);
+        }
+        else if(state == DATA_TRAN_STAT_DONE && !data.empty()) {
+            dataStore_->store(key, data);
+        }
+        if(callback) {
+            callback(state, dataChunk);
+        }
+    });
+}
+
 }  // namespace libobsensor
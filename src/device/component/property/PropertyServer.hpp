@@ -9,6 +9,11 @@
 #include "PropertyHelper.hpp"
 #include "DeviceComponentBase.hpp"
 
+#include <atomic>
+#include <functional>
+#include <map>
+#include <set>
+
 namespace libobsensor {
 
 class PropertyServer : public IPropertyServer, public DeviceComponentBase {
@@ -21,6 +26,16 @@ class PropertyServer : public IPropertyServer, public DeviceComponentBase {
         std::vector<PropertyAccessCallback> accessCallbacks;
     };
 
+    struct PropertyCacheItem {
+        OBPropertyCachePolicy policy;
+        uint32_t              ttlMs;
+        bool                  valueValid;
+        OBPropertyValue       value;
+        bool                  dataValid;
+        std::vector<uint8_t>  data;
+        uint64_t              updateTimeMs;
+    };
+
 public:
     PropertyServer(IDevice *owner);
     ~PropertyServer() noexcept override = default;
@@ -53,7 +68,27 @@ public:
     void setStructureDataProtoV1_1(uint32_t propertyId, const std::vector<uint8_t> &data, uint16_t cmdVersion, PropertyAccessType accessType) override;
     const std::vector<uint8_t> &getStructureDataListProtoV1_1(uint32_t propertyId, uint16_t cmdVersion, PropertyAccessType accessType) override;
 
+    void setPropertyValues(std::vector<PropertyValueItem> &items, PropertyAccessType accessType) override;
+    void getPropertyValues(std::vector<PropertyValueItem> &items, PropertyAccessType accessType) override;
+    void getPropertyRanges(std::vector<PropertyRangeItem> &items, PropertyAccessType accessType) override;
+
+    void                      setPropertyCachePolicy(uint32_t propertyId, OBPropertyCachePolicy policy, uint32_t ttlMs) override;
+    void                      invalidatePropertyCache() override;
+    OBPropertyCacheStatistics getPropertyCacheStatistics() const override;
+
+    void setPersistentDataStore(std::shared_ptr<IPropertyDataStore> store, const std::vector<uint32_t> &propertyIds) override;
+
 private:
+    // Group the indices of the items by the accessor of the property, the items of unsupported properties are marked as failed
+    template <typename Item>
+    std::vector<std::pair<std::shared_ptr<IPropertyAccessor>, std::vector<size_t>>> groupByAccessor(std::vector<Item> &items, PropertyOperationType operationType,
+                                                                                                    PropertyAccessType accessType);
+
+    PropertyCacheItem        *findCacheItem(uint32_t propId);
+    void                      invalidateCacheItem(uint32_t propId);
+    bool                      isPersistentProperty(uint32_t propId) const;
+    const std::vector<uint8_t> &loadOrFetchPersistentData(const std::string &key, const std::function<const std::vector<uint8_t> &()> &fetch);
+    void getRawDataWithDataStore(uint32_t propId, const std::shared_ptr<IRawDataAccessor> &accessor, GetDataCallback callback);
     void                      appendToPropertyMap(uint32_t propertyId, OBPermissionType userPerms, OBPermissionType intPerms);
     inline void               checkAccessMode(PropertyOperationType op);
     inline const std::string &GetCurrentSN() const;
@@ -63,6 +98,16 @@ private:
     std::map<uint32_t, PropertyItem> properties_;
     std::vector<OBPropertyItem>      userPropertiesVec_;
     std::vector<OBPropertyItem>      innerPropertiesVec_;
+
+    // keyed by the resolved property id, so aliases share the cached value
+    std::map<uint32_t, PropertyCacheItem> cache_;
+    std::atomic<bool>                     cacheInvalidated_;  // set by invalidatePropertyCache, applied to cache_ by findCacheItem
+    std::atomic<uint64_t>                 cacheHitCount_;
+    std::atomic<uint64_t>                 cacheMissCount_;
+
+    std::shared_ptr<IPropertyDataStore>         dataStore_;
+    std::set<uint32_t>                          persistentProperties_;
+    std::map<std::string, std::vector<uint8_t>> persistentDataBuffers_;  // backs the references returned for persistent data
 };
 
 }  // namespace libobsensor
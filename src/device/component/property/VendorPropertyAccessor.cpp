@@ -282,6 +282,102 @@ void VendorPropertyAccessor::triggerReboot() {
     }
 }
 
+void VendorPropertyAccessor::setPropertyValues(std::vector<PropertyValueItem> &items) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    prepareBatchBuffers(items.size());
+
+    std::vector<uint32_t> propertyIds;
+    for(size_t i = 0; i < items.size(); i++) {
+        protocol::initSetPropertyReq(batchSendData_.data() + i * batchReqSlotSize_, items[i].propertyId, items[i].value.intValue);
+        propertyIds.push_back(items[i].propertyId);
+    }
+
+    auto requests = executeBatch(propertyIds, sizeof(protocol::SetPropertyReq));
+    for(size_t i = 0; i < items.size(); i++) {
+        items[i].success = checkBatchStatus(items[i].propertyId, requests[i].status);
+    }
+}
+
+void VendorPropertyAccessor::getPropertyValues(std::vector<PropertyValueItem> &items) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    prepareBatchBuffers(items.size());
+
+    std::vector<uint32_t> propertyIds;
+    for(size_t i = 0; i < items.size(); i++) {
+        protocol::initGetPropertyReq(batchSendData_.data() + i * batchReqSlotSize_, items[i].propertyId);
+        propertyIds.push_back(items[i].propertyId);
+    }
+
+    auto requests = executeBatch(propertyIds, sizeof(protocol::GetPropertyReq));
+    for(size_t i = 0; i < items.size(); i++) {
+        items[i].success = checkBatchStatus(items[i].propertyId, requests[i].status) && requests[i].respDataSize >= sizeof(protocol::GetPropertyResp);
+        if(items[i].success) {
+            auto resp               = protocol::parseGetPropertyResp(requests[i].respData, requests[i].respDataSize);
+            items[i].value.intValue = resp->data.cur;
+        }
+    }
+}
+
+void VendorPropertyAccessor::getPropertyRanges(std::vector<PropertyRangeItem> &items) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    prepareBatchBuffers(items.size());
+
+    std::vector<uint32_t> propertyIds;
+    for(size_t i = 0; i < items.size(); i++) {
+        protocol::initGetPropertyReq(batchSendData_.data() + i * batchReqSlotSize_, items[i].propertyId);
+        propertyIds.push_back(items[i].propertyId);
+    }
+
+    auto requests = executeBatch(propertyIds, sizeof(protocol::GetPropertyReq));
+    for(size_t i = 0; i < items.size(); i++) {
+        items[i].success = checkBatchStatus(items[i].propertyId, requests[i].status) && requests[i].respDataSize >= sizeof(protocol::GetPropertyResp);
+        if(items[i].success) {
+            auto  resp          = protocol::parseGetPropertyResp(requests[i].respData, requests[i].respDataSize);
+            auto &range         = items[i].range;
+            range.cur.intValue  = resp->data.cur;
+            range.max.intValue  = resp->data.max;
+            range.min.intValue  = resp->data.min;
+            range.step.intValue = resp->data.step;
+            range.def.intValue  = resp->data.def;
+        }
+    }
+}
+
+std::vector<protocol::BatchRequest> VendorPropertyAccessor::executeBatch(const std::vector<uint32_t> &propertyIds, uint16_t reqDataSize) {
+    std::vector<protocol::BatchRequest> requests;
+    for(size_t i = 0; i < propertyIds.size(); i++) {
+        requests.push_back({ batchSendData_.data() + i * batchReqSlotSize_, reqDataSize, batchRecvData_.data() + i * batchRespSlotSize_, 0, 0, {} });
+    }
+
+    auto port = std::dynamic_pointer_cast<IVendorDataPort>(backend_);
+    protocol::executeBatch(port, requests);
+
+    for(size_t i = 0; i < requests.size(); i++) {
+        auto &request = requests[i];
+        if(!protocol::isTransientStatus(request.status)) {
+            continue;
+        }
+        // fall back to the serial path, which retries and handles the response channel faults
+        try {
+            request.status = executeAndCheck(port, request.reqData, request.reqDataSize, request.respData, &request.respDataSize, propertyIds[i]);
+        }
+        catch(const libobsensor_exception &e) {
+            LOG_WARN("Batch request of property {} failed, {}", propertyIds[i], e.what());
+        }
+    }
+    return requests;
+}
+
+bool VendorPropertyAccessor::checkBatchStatus(uint32_t propertyId, const protocol::HpStatus &status) {
+    // Warnings are not failures, the same as the single request path
+    return protocol::checkStatus(propertyId, status, false) || status.statusCode == protocol::HP_STATUS_DEVICE_RESPONSE_WARNING;
+}
+
+void VendorPropertyAccessor::prepareBatchBuffers(size_t count) {
+    batchSendData_.assign(count * batchReqSlotSize_, 0);
+    batchRecvData_.assign(count * batchRespSlotSize_, 0);
+}
+
 protocol::HpStatus VendorPropertyAccessor::executeAndCheck(const std::shared_ptr<IVendorDataPort> &port,
                                                            uint8_t  *reqData,
                                                            uint16_t  reqDataSize,
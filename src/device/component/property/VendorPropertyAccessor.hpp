@@ -15,7 +15,8 @@ class VendorPropertyAccessor : public IDeviceComponent,
                                public IBasicPropertyAccessor,
                                public IStructureDataAccessor,
                                public IStructureDataAccessorV1_1,
-                               public IRawDataAccessor {
+                               public IRawDataAccessor,
+                               public IBatchPropertyAccessor {
 public:
     explicit VendorPropertyAccessor(IDevice *owner, const std::shared_ptr<ISourcePort> &backend);
     ~VendorPropertyAccessor() noexcept override = default;
@@ -36,6 +37,10 @@ public:
     void                        setStructureDataProtoV1_1(uint32_t propertyId, const std::vector<uint8_t> &data, uint16_t cmdVersion) override;
     const std::vector<uint8_t> &getStructureDataListProtoV1_1(uint32_t propertyId, uint16_t cmdVersion) override;
 
+    void setPropertyValues(std::vector<PropertyValueItem> &items) override;
+    void getPropertyValues(std::vector<PropertyValueItem> &items) override;
+    void getPropertyRanges(std::vector<PropertyRangeItem> &items) override;
+
     void setRawdataTransferPacketSize(uint32_t size);
     void setStructListDataTransferPacketSize(uint32_t size);
 
@@ -60,6 +65,11 @@ private:
     // Guaranteed to execute at most once per VendorPropertyAccessor instance.
     void triggerReboot();
 
+    // Send the requests prepared in batchSendData_ together, then re-execute the ones that failed with a transient status through executeAndCheck()
+    std::vector<protocol::BatchRequest> executeBatch(const std::vector<uint32_t> &propertyIds, uint16_t reqDataSize);
+    bool                                checkBatchStatus(uint32_t propertyId, const protocol::HpStatus &status);
+    void                                prepareBatchBuffers(size_t count);
+
     void clearBuffers();
 
 private:
@@ -70,11 +80,16 @@ private:
     std::vector<uint8_t>              sendData_;
     std::vector<uint8_t>              outputData_;
     std::vector<std::vector<uint8_t>> structureDataList_;  // for cmd version 1.1
+    std::vector<uint8_t>              batchSendData_;      // one slot of batchReqSlotSize_ per request
+    std::vector<uint8_t>              batchRecvData_;      // one slot of batchRespSlotSize_ per request
     uint32_t                          rawdataTransferPacketSize_;
     uint32_t                          structListDataTransferPacketSize_;
 
     bool                 autoRebootEnabled_{ false };  // controlled by setAutoRebootEnabled()
     std::atomic<bool>    rebootTriggered_{ false };    // prevents duplicate reboot triggers
+
+    static const size_t batchReqSlotSize_  = 32;
+    static const size_t batchRespSlotSize_ = 1024;  // same as recvData_, some ports always read up to 1024 bytes
 };
 }  // namespace libobsensor
 
@@ -5,6 +5,7 @@
 #include "IDeviceSyncConfigurator.hpp"
 #include "utils/PublicTypeHelper.hpp"
 #include "frame/Frame.hpp"
+#include "frame/FrameLatencyTracer.hpp"
 #include "stream/StreamProfile.hpp"
 #include "logger/LoggerInterval.hpp"
 #include "logger/LoggerHelper.hpp"
@@ -404,6 +405,7 @@ void SensorBase::outputFrame(std::shared_ptr<Frame> frame) {
     if(streamState_ != STREAM_STATE_STREAMING && streamState_ != STREAM_STATE_STARTING) {
         return;
     }
+    FrameLatencyTracer::markArrival(frame);  // the sensors without a backend frame callback
 
     if(activatedStreamProfile_) {
         frame->setStreamProfile(activatedStreamProfile_);
@@ -436,6 +438,7 @@ void SensorBase::outputFrame(std::shared_ptr<Frame> frame) {
         frameRecordingCallback_(frame);
     }
 
+    FrameLatencyTracer::record(OB_FRAME_TRACE_STAGE_SENSOR_OUTPUT, frame);
     if(frameProcessor_) {
         frameProcessor_->pushFrame(frame);
     }
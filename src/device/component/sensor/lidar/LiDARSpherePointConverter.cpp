@@ -0,0 +1,244 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#include "LiDARSpherePointConverter.hpp"
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <arpa/inet.h>
+#endif
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+#undef min
+#undef max
+#include <cmath>
+#include <algorithm>
+
+namespace libobsensor {
+
+namespace {
+
+constexpr int   HIGH_POWER_LOW_THRESH_TABLE_SIZE    = 45;
+constexpr int   HIGH_POWER_MEDIUM_THRESH_TABLE_SIZE = 37;
+constexpr int   LOW_POWER_LOW_THRESH_TABLE_SIZE     = 21;
+constexpr int   LOW_POWER_MEDIUM_THRESH_TABLE_SIZE  = 14;
+constexpr float MAX_PULSE_WIDTH                     = 0x3FFF;  // 14 bits
+
+// reference calibration data: { pulse width, received power }
+const float highPowerLowThreshRefCalibData[HIGH_POWER_LOW_THRESH_TABLE_SIZE][2] = {
+    { 240, 2 },   { 255, 2 },    { 293, 2 },    { 312, 2 },    { 345, 3 },    { 369, 3 },    { 408, 3 },    { 385, 3 },    { 403, 3 },
+    { 453, 4 },   { 474, 4 },    { 488, 4 },    { 504, 5 },    { 521, 5 },    { 542, 6 },    { 566, 7 },    { 576, 7 },    { 623, 8 },
+    { 636, 10 },  { 686, 11 },   { 691, 13 },   { 741, 15 },   { 775, 18 },   { 826, 22 },   { 851, 13 },   { 904, 14 },   { 915, 16 },
+    { 968, 18 },  { 1019, 20 },  { 1021, 23 },  { 1030, 27 },  { 1043, 31 },  { 1054, 37 },  { 1062, 44 },  { 1079, 54 },  { 1097, 68 },
+    { 1124, 87 }, { 1145, 100 }, { 1140, 116 }, { 1178, 136 }, { 1189, 162 }, { 1208, 197 }, { 1275, 244 }, { 1322, 309 }, { 1378, 405 },
+};
+
+const float highPowerMediumThreshRefCalibData[HIGH_POWER_MEDIUM_THRESH_TABLE_SIZE][2] = {
+    { 111, 4 },   { 141, 4 },   { 143, 5 },   { 146, 5 },   { 163, 6 },   { 203, 7 },    { 228, 7 },    { 288, 8 },   { 313, 10 },  { 369, 11 },
+    { 373, 13 },  { 421, 15 },  { 451, 18 },  { 516, 22 },  { 544, 13 },  { 612, 14 },   { 625, 16 },   { 689, 18 },  { 739, 20 },  { 741, 23 },
+    { 752, 27 },  { 766, 31 },  { 772, 37 },  { 786, 44 },  { 799, 54 },  { 810, 68 },   { 827, 87 },   { 844, 100 }, { 847, 116 }, { 865, 136 },
+    { 875, 162 }, { 889, 197 }, { 921, 244 }, { 952, 309 }, { 982, 405 }, { 1040, 555 }, { 1115, 805 },
+};
+
+const float lowPowerLowThreshRefCalibData[LOW_POWER_LOW_THRESH_TABLE_SIZE][2] = {
+    { 153, 27 },  { 198, 31 },  { 210, 37 },  { 273, 44 },   { 316, 54 },   { 349, 68 },    { 420, 87 },
+    { 453, 100 }, { 458, 116 }, { 518, 136 }, { 550, 162 },  { 577, 197 },  { 633, 244 },   { 671, 309 },
+    { 734, 405 }, { 810, 555 }, { 861, 805 }, { 910, 1271 }, { 958, 2298 }, { 1028, 5361 }, { 1391, 16109 },
+};
+
+const float lowPowerMediumThreshRefCalibData[LOW_POWER_MEDIUM_THRESH_TABLE_SIZE][2] = {
+    { 126, 100 }, { 137, 116 }, { 181, 136 }, { 216, 162 },  { 257, 197 },  { 324, 244 },  { 352, 309 },
+    { 406, 405 }, { 505, 555 }, { 565, 805 }, { 607, 1271 }, { 644, 2298 }, { 700, 5361 }, { 809, 16109 },
+};
+
+inline float floatLerp(const float &x0, const float &x1, const float &y0, const float &y1, const float &x) {
+    const float &dy     = y1 - y0;
+    const float &dx     = x1 - x0;
+    float        result = 0.0f;
+
+    if(dx == 0) {
+        return y0;
+    }
+
+    result = y0 + (x - x0) * dy / dx;
+    return result;
+}
+
+inline void getExtValue(const LiDARSpherePoint *point, uint8_t &tag, uint16_t &pulseWidth) {
+    uint16_t extValue = (static_cast<uint16_t>(point->reflectivity) << 8) | point->tag;
+
+    tag        = static_cast<uint8_t>(extValue >> 14);
+    pulseWidth = extValue & 0x3FFF;
+}
+
+}  // namespace
+
+LiDARSpherePointConverter::LiDARSpherePointConverter() {
+    setReflectivityFactors({ 1.f, 1.f }, { 1.f, 1.f });
+}
+
+void LiDARSpherePointConverter::setReflectivityFactors(const ReflectivityFactors &lowPowerFactors, const ReflectivityFactors &highPowerFactors) {
+    lowPowerFactors_  = lowPowerFactors;
+    highPowerFactors_ = highPowerFactors;
+
+    // The received power only depends on the mode and the 14 bit pulse width. Every table stops at the first pulse width beyond the
+    // calibration data, where the received power stays at the last calibrated value.
+    const float lastPulseWidths[TARGET_FLAG_COUNT] = {
+        lowPowerLowThreshRefCalibData[LOW_POWER_LOW_THRESH_TABLE_SIZE - 1][0] / lowPowerFactors_.lowThresh,
+        lowPowerMediumThreshRefCalibData[LOW_POWER_MEDIUM_THRESH_TABLE_SIZE - 1][0] / lowPowerFactors_.mediumThresh,
+        highPowerLowThreshRefCalibData[HIGH_POWER_LOW_THRESH_TABLE_SIZE - 1][0] / highPowerFactors_.lowThresh,
+        highPowerMediumThreshRefCalibData[HIGH_POWER_MEDIUM_THRESH_TABLE_SIZE - 1][0] / highPowerFactors_.mediumThresh,
+    };
+    for(uint16_t targetFlag = 0; targetFlag < TARGET_FLAG_COUNT; targetFlag++) {
+        auto  &table    = recPowerTables_[targetFlag];
+        auto   lastItem = lastPulseWidths[targetFlag];
+        size_t size     = (lastItem >= 0 && lastItem < MAX_PULSE_WIDTH) ? static_cast<size_t>(std::ceil(lastItem)) + 2 : 0x3FFF + 1;
+        size            = std::min<size_t>(size, 0x3FFF + 1);
+        table.resize(size);
+        for(size_t pulseWidth = 0; pulseWidth < size; pulseWidth++) {
+            table[pulseWidth] = calculateReceivedPower(static_cast<float>(pulseWidth), targetFlag);
+        }
+    }
+}
+
+void LiDARSpherePointConverter::convert(const LiDARSpherePoint *points, OBLiDARSpherePoint *obPoints, size_t count) const {
+    size_t i = 0;
+#if defined(__SSSE3__)
+    static_assert(sizeof(LiDARSpherePoint) == 8, "two LiDAR points per 128 bit load");
+    // Byte swap and scale the distance and angles of 4 points at a time. Each big endian field is moved to the high half of a 32 bit
+    // lane, then shifted down to zero extend the distance and sign extend the angles.
+    const __m128i distanceMask = _mm_setr_epi8(-1, -1, 1, 0, -1, -1, 9, 8, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i thetaMask    = _mm_setr_epi8(-1, -1, 3, 2, -1, -1, 11, 10, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i phiMask      = _mm_setr_epi8(-1, -1, 5, 4, -1, -1, 13, 12, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128  distanceUnit = _mm_set1_ps(2.0f);
+    const __m128  angleUnit    = _mm_set1_ps(0.01f);
+
+    alignas(16) float distances[4];
+    alignas(16) float thetas[4];
+    alignas(16) float phis[4];
+    for(; i + 4 <= count; i += 4) {
+        auto block0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(points + i));
+        auto block1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(points + i + 2));
+
+        auto distance = _mm_unpacklo_epi64(_mm_shuffle_epi8(block0, distanceMask), _mm_shuffle_epi8(block1, distanceMask));
+        auto theta    = _mm_unpacklo_epi64(_mm_shuffle_epi8(block0, thetaMask), _mm_shuffle_epi8(block1, thetaMask));
+        auto phi      = _mm_unpacklo_epi64(_mm_shuffle_epi8(block0, phiMask), _mm_shuffle_epi8(block1, phiMask));
+        _mm_store_ps(distances, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(distance, 16)), distanceUnit));
+        _mm_store_ps(thetas, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(theta, 16)), angleUnit));
+        _mm_store_ps(phis, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(phi, 16)), angleUnit));
+
+        for(size_t k = 0; k < 4; k++) {
+            auto    &obPoint = obPoints[i + k];
+            uint8_t  tag;
+            uint16_t pulseWidth;
+            getExtValue(points + i + k, tag, pulseWidth);
+
+            auto &table          = recPowerTables_[tag];
+            obPoint.distance     = distances[k];
+            obPoint.theta        = thetas[k];
+            obPoint.phi          = phis[k];
+            obPoint.tag          = tag;
+            obPoint.reflectivity = calculateReflectivity(table[std::min<size_t>(pulseWidth, table.size() - 1)], distances[k] * 0.01f);
+        }
+    }
+#endif
+
+    for(; i < count; i++) {
+        auto    &obPoint = obPoints[i];
+        auto     point   = points + i;
+        uint8_t  tag;
+        uint16_t pulseWidth;
+        getExtValue(point, tag, pulseWidth);
+
+        auto &table          = recPowerTables_[tag];
+        obPoint.distance     = ntohs(point->distance) * 2.0f;
+        obPoint.theta        = static_cast<int16_t>(ntohs(point->theta)) * 0.01f;
+        obPoint.phi          = static_cast<int16_t>(ntohs(point->phi)) * 0.01f;
+        obPoint.tag          = tag;
+        obPoint.reflectivity = calculateReflectivity(table[std::min<size_t>(pulseWidth, table.size() - 1)], obPoint.distance * 0.01f);
+    }
+}
+
+void LiDARSpherePointConverter::convertReference(const LiDARSpherePoint *points, OBLiDARSpherePoint *obPoints, size_t count) const {
+    for(size_t i = 0; i < count; i++) {
+        auto    &obPoint = obPoints[i];
+        auto     point   = points + i;
+        uint8_t  tag;
+        uint16_t pulseWidth;
+        getExtValue(point, tag, pulseWidth);
+
+        // to host order and to unit mm / degrees
+        obPoint.distance     = ntohs(point->distance) * 2.0f;
+        obPoint.theta        = static_cast<int16_t>(ntohs(point->theta)) * 0.01f;
+        obPoint.phi          = static_cast<int16_t>(ntohs(point->phi)) * 0.01f;
+        obPoint.tag          = tag;
+        obPoint.reflectivity = calculateReflectivity(calculateReceivedPower(static_cast<float>(pulseWidth), tag), obPoint.distance * 0.01f);
+    }
+}
+
+float LiDARSpherePointConverter::calculateReceivedPower(float pulseWidth, uint16_t targetFlag) const {
+    const float(*tableData)[2] = nullptr;
+    int tableSize              = 0;
+    float recPower             = 0;
+
+    switch(targetFlag) {
+    case 0x0:  // low power low threshold
+        pulseWidth = pulseWidth * lowPowerFactors_.lowThresh;
+        tableData  = lowPowerLowThreshRefCalibData;
+        tableSize  = LOW_POWER_LOW_THRESH_TABLE_SIZE;
+        break;
+    case 0x1:  // low power medium threshold
+        pulseWidth = pulseWidth * lowPowerFactors_.mediumThresh;
+        tableData  = lowPowerMediumThreshRefCalibData;
+        tableSize  = LOW_POWER_MEDIUM_THRESH_TABLE_SIZE;
+        break;
+    case 0x2:  // high power low threshold
+        pulseWidth = pulseWidth * highPowerFactors_.lowThresh;
+        tableData  = highPowerLowThreshRefCalibData;
+        tableSize  = HIGH_POWER_LOW_THRESH_TABLE_SIZE;
+        break;
+    case 0x3:  // high power medium threshold
+        pulseWidth = pulseWidth * highPowerFactors_.mediumThresh;
+        tableData  = highPowerMediumThreshRefCalibData;
+        tableSize  = HIGH_POWER_MEDIUM_THRESH_TABLE_SIZE;
+        break;
+    default:
+        recPower = 0;
+        break;
+    }
+
+    if(tableData) {
+        if(pulseWidth <= tableData[0][0])
+            recPower = tableData[0][1];
+        else if(pulseWidth >= tableData[tableSize - 1][0])
+            recPower = tableData[tableSize - 1][1];
+        else {
+            for(int i = 0; i < tableSize; i++) {
+                if(pulseWidth > tableData[i][0])
+                    continue;
+                recPower = floatLerp(tableData[i - 1][0], tableData[i][0], tableData[i - 1][1], tableData[i][1], pulseWidth);
+                break;
+            }
+        }
+    }
+    return recPower;
+}
+
+uint8_t LiDARSpherePointConverter::calculateReflectivity(float recPower, float distance) {
+    float refValue = recPower * distance * distance * 0.00020218f;
+    if(refValue > 10 && refValue < 100) {
+        refValue = sqrt(refValue) * 10;
+    }
+    refValue = (refValue >= 120.f) ? (refValue * 0.7f) : refValue;
+
+    refValue = (refValue > 255.f) ? 255.f : refValue;
+    refValue = (refValue < 5.f) ? 5.f : refValue;
+
+    return static_cast<uint8_t>(refValue);
+}
+
+}  // namespace libobsensor
@@ -0,0 +1,49 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "libobsensor/h/ObTypes.h"
+#include "InternalTypes.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace libobsensor {
+
+/**
+ * @brief Converts the sphere points of the LiDAR data blocks (network order, raw units) to OBLiDARSpherePoint
+ * @brief The received power of every power/threshold mode is precomputed for all pulse widths when the reflectivity factors change, so a
+ * point only needs a table lookup instead of a search and interpolation over the calibration data.
+ */
+class LiDARSpherePointConverter {
+public:
+    typedef struct {
+        float lowThresh;
+        float mediumThresh;
+    } ReflectivityFactors;
+
+    LiDARSpherePointConverter();
+
+    void setReflectivityFactors(const ReflectivityFactors &lowPowerFactors, const ReflectivityFactors &highPowerFactors);
+
+    void convert(const LiDARSpherePoint *points, OBLiDARSpherePoint *obPoints, size_t count) const;
+
+    // Per point conversion with the calibration table search, the reference for the lookup tables
+    void convertReference(const LiDARSpherePoint *points, OBLiDARSpherePoint *obPoints, size_t count) const;
+
+private:
+    float          calculateReceivedPower(float pulseWidth, uint16_t targetFlag) const;
+    static uint8_t calculateReflectivity(float recPower, float distance);
+
+private:
+    static constexpr int TARGET_FLAG_COUNT = 4;  // low/high power x low/medium threshold
+
+    ReflectivityFactors lowPowerFactors_;
+    ReflectivityFactors highPowerFactors_;
+
+    // received power indexed by the raw pulse width, the last item applies to all larger pulse widths
+    std::vector<float> recPowerTables_[TARGET_FLAG_COUNT];
+};
+
+}  // namespace libobsensor
@@ -8,6 +8,7 @@
 #include "IDeviceComponent.hpp"
 #include "ILiDARStreamer.hpp"
 #include "InternalTypes.hpp"
+#include "LiDARSpherePointConverter.hpp"
 #include <atomic>
 #include <map>
 #include <mutex>
@@ -38,14 +39,6 @@ private:
     std::shared_ptr<IFilter> getFormatConverter();
     std::shared_ptr<IFilter> getPointFilter();
 
-    uint8_t calculateReflectivity(const float &distance, const uint16_t &pulseWidth, const uint16_t &targetFlag);
-    void    copyToOBLiDARSpherePoint(const LiDARSpherePoint *point, OBLiDARSpherePoint *obPoint);
-
-    typedef struct {
-        float lowThresh;
-        float mediumThresh;
-    } ReflectivityFactors;
-
 private:
     IDevice                             *owner_;
     std::shared_ptr<IDataStreamPort>     backend_;
@@ -61,8 +54,7 @@ private:
 
     std::vector<std::pair<std::string, std::shared_ptr<IFilter>>> filters_;
 
-    ReflectivityFactors lowPowerFactors_;
-    ReflectivityFactors highPowerFactors_;
+    LiDARSpherePointConverter pointConverter_;
 };
 
 }  // namespace libobsensor
@@ -10,6 +10,7 @@
 #include "utils/Utils.hpp"
 #include "stream/StreamProfile.hpp"
 #include "frame/Frame.hpp"
+#include "frame/FrameLatencyTracer.hpp"
 #include "FilterDecorator.hpp"
 #include "publicfilters/FormatConverterProcess.hpp"
 #include "property/InternalProperty.hpp"
@@ -149,6 +150,7 @@ void VideoSensor::onBackendFrameCallback(std::shared_ptr<Frame> frame) {
     if(streamState_ != STREAM_STATE_STREAMING && streamState_ != STREAM_STATE_STARTING) {
         return;
     }
+    FrameLatencyTracer::markArrival(frame);
 
     LOG_FREQ_CALC(INFO, 5000, "{} backend frame callback, frameRate={freq}fps", sensorType_);
     auto deviceInfo = owner_->getInfo();
@@ -9,6 +9,8 @@
 #include "property/InternalProperty.hpp"
 #include "environment/EnvConfig.hpp"
 
+#include <cstring>
+
 #include "logger/LoggerSnWrapper.hpp"  // Must be included last to override log macros
 
 namespace libobsensor {
@@ -24,7 +26,12 @@ const std::string &GlobalTimestampFitter::GetCurrentSN() const {
 }
 
 GlobalTimestampFitter::GlobalTimestampFitter(IDevice *owner)
-    : DeviceComponentBase(owner), enable_(false), sampleLoopExit_(false), linearFuncParam_({ 0, 0, 0, 0 }), maxValidRtt_(MAX_VALID_RTT) {
+    : DeviceComponentBase(owner), enable_(false), sampleLoopExit_(false), linearFuncParamSeq_(0), lastCheckDataY_(0), maxValidRtt_(MAX_VALID_RTT) {
+    static_assert(sizeof(LinearFuncParam) % sizeof(uint64_t) == 0, "LinearFuncParam must be a whole number of 64 bit words");
+    for(auto &word: linearFuncParamWords_) {
+        word.store(0, std::memory_order_relaxed);
+    }
+
     std::string deviceName = utils::string::removeSpace(owner->getInfo()->name_);
     auto        envConfig  = EnvConfig::getInstance();
     int         value      = 0;
@@ -65,15 +72,38 @@ GlobalTimestampFitter::~GlobalTimestampFitter() {
 }
 
 LinearFuncParam GlobalTimestampFitter::getLinearFuncParam() {
-    std::unique_lock<std::mutex> lock(linearFuncParamMutex_);
-    if(lastCheckDataY != linearFuncParam_.checkDataY) {
-        lastCheckDataY = linearFuncParam_.checkDataY;
-        auto &param    = linearFuncParam_;
+    uint64_t words[LINEAR_FUNC_PARAM_WORDS];
+    uint32_t seq;
+    do {
+        seq = linearFuncParamSeq_.load(std::memory_order_acquire);
+        for(size_t i = 0; i < LINEAR_FUNC_PARAM_WORDS; i++) {
+            words[i] = linearFuncParamWords_[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while((seq & 1) || seq != linearFuncParamSeq_.load(std::memory_order_relaxed));
+
+    LinearFuncParam param;
+    memcpy(&param, words, sizeof(param));
+
+    if(lastCheckDataY_.load(std::memory_order_relaxed) != param.checkDataY && lastCheckDataY_.exchange(param.checkDataY) != param.checkDataY) {
         LOG_DEBUG("GetLinearFuncParam: coefficientA: {}, constantB: {}, checkDataX: {}, checkDataY: {}", param.coefficientA, param.constantB, param.checkDataX,
                   param.checkDataY);
     }
+    return param;
+}
 
-    return linearFuncParam_;
+void GlobalTimestampFitter::publishLinearFuncParam(const LinearFuncParam &param) {
+    // called with linearFuncParamMutex_ held, so there is a single writer
+    uint64_t words[LINEAR_FUNC_PARAM_WORDS];
+    memcpy(words, &param, sizeof(param));
+
+    auto seq = linearFuncParamSeq_.load(std::memory_order_relaxed);
+    linearFuncParamSeq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for(size_t i = 0; i < LINEAR_FUNC_PARAM_WORDS; i++) {
+        linearFuncParamWords_[i].store(words[i], std::memory_order_relaxed);
+    }
+    linearFuncParamSeq_.store(seq + 2, std::memory_order_release);
 }
 
 void GlobalTimestampFitter::reFitting(bool async) {
@@ -140,52 +170,28 @@ bool GlobalTimestampFitter::isEnabled() const {
 }
 
 void GlobalTimestampFitter::calcLinearParam(uint64_t sysTimestamp, uint64_t devTimestamp) {
-    // Use the first set of data as offset to prevent overflow during calculation
-    uint64_t offset_x  = 0;
-    uint64_t offset_y  = 0;
-    double   Ex        = 0;
-    double   Exx       = 0;
-    double   Ey        = 0;
-    double   Exy       = 0;
-    size_t   queueSize = 0;
+    LinearFuncParam param     = { 0, 0, devTimestamp, sysTimestamp };
+    size_t          queueSize = 0;
     {
         std::unique_lock<std::mutex> lock(sampleMutex_);
 
         if(!needCalculation_) {
             return;
         }
+        needCalculation_ = false;
+        queueSize        = samplingQueue_.size();
 
-        auto it = samplingQueue_.begin();
-
-        offset_x  = samplingQueue_.front().deviceTimestamp;
-        offset_y  = samplingQueue_.front().systemTimestamp;
-        queueSize = samplingQueue_.size();
-
-        while(it != samplingQueue_.end()) {
-            auto systemTimestamp = it->systemTimestamp - offset_y;
-            auto deviceTimestamp = it->deviceTimestamp - offset_x;
-            Ex += deviceTimestamp;
-            Exx += deviceTimestamp * deviceTimestamp;
-            Ey += systemTimestamp;
-            Exy += deviceTimestamp * systemTimestamp;
-            it++;
+        // Linear regression to find a and b: y=ax+b, the sums are maintained as samples are added and removed
+        if(!samplingQueue_.solve(param.coefficientA, param.constantB)) {
+            LOG_DEBUG("LinearParam not updated, samples do not determine a line. QueueSize: {}", queueSize);
+            return;
         }
-        needCalculation_ = false;
     }
 
     {
         std::unique_lock<std::mutex> linearFuncParamLock(linearFuncParamMutex_);
-        // Linear regression to find a and b: y=ax+b
-        linearFuncParam_.coefficientA = (Exy * queueSize - Ex * Ey) / (queueSize * Exx - Ex * Ex);
-        linearFuncParam_.constantB    = (Exx * Ey - Exy * Ex) / (queueSize * Exx - Ex * Ex) + offset_y - linearFuncParam_.coefficientA * offset_x;
-        linearFuncParam_.checkDataX   = devTimestamp;
-        linearFuncParam_.checkDataY   = sysTimestamp;
-
-        // auto fixDevTsp = (double)devTime *linearFuncParam_.coefficientA + linearFuncParam_.constantB;
-        // auto fixDiff   = fixDevTsp -sysTspUsec;
-        // LOG_TRACE("a = {}, b = {}, fix={}, diff={}", linearFuncParam_.coefficientA, linearFuncParam_.constantB, fixDevTsp, fixDiff);
+        publishLinearFuncParam(param);
 
-        auto &param = linearFuncParam_;
         LOG_DEBUG("LinearParam update! QueueSize: {}, coefficientA: {}, constantB: {}, checkDataX: {}, checkDataY: {}", queueSize, param.coefficientA,
                   param.constantB, param.checkDataX, param.checkDataY);
         linearFuncParamCondVar_.notify_all();
@@ -220,7 +226,7 @@ bool GlobalTimestampFitter::ensureFitting() {
 
             // Clearing and refitting when the timestamp is out of order
             if(!samplingQueue_.empty()) {
-                auto last = samplingQueue_.back().deviceTimestamp;
+                auto last = samplingQueue_.back().x;
                 if(devTime.time < last) {
                     LOG_DEBUG("Device time is out of order, clear queue. Last={}, current={}", last, devTime.time);
                     samplingQueue_.clear();
@@ -228,7 +234,7 @@ bool GlobalTimestampFitter::ensureFitting() {
             }
             needCalculation_ = true;
             calc             = true;
-            samplingQueue_.push_back({ sysTspUsec, devTime.time });
+            samplingQueue_.push(devTime.time, sysTspUsec);
             std::this_thread::sleep_for(std::chrono::milliseconds(40));
         }
         if(samplingQueue_.size() < 4) {
@@ -291,16 +297,16 @@ void GlobalTimestampFitter::fittingLoop() {
         {
             std::unique_lock<std::mutex> lock(sampleMutex_);
             if(samplingQueue_.size() > maxQueueSize_) {
-                samplingQueue_.pop_front();
+                samplingQueue_.popFront();
             }
 
             // Clearing and refitting when the timestamp is out of order
-            if(!samplingQueue_.empty() && (devTime.time < samplingQueue_.back().deviceTimestamp)) {
+            if(!samplingQueue_.empty() && (devTime.time < samplingQueue_.back().x)) {
                 samplingQueue_.clear();
             }
 
             needCalculation_ = true;
-            samplingQueue_.push_back({ sysTspUsec, devTime.time });
+            samplingQueue_.push(devTime.time, sysTspUsec);
 
             if(samplingQueue_.size() < 4) {
                 std::this_thread::sleep_for(std::chrono::milliseconds(50));
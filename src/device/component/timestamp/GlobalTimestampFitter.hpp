@@ -5,9 +5,10 @@
 #include "IDevice.hpp"
 #include "IFrameTimestamp.hpp"
 #include "DeviceComponentBase.hpp"
+#include "SlidingLinearRegression.hpp"
 
+#include <atomic>
 #include <thread>
-#include <queue>
 #include <mutex>
 #include <condition_variable>
 
@@ -32,6 +33,7 @@ private:
     inline const std::string &GetCurrentSN() const;
     void                      calcLinearParam(uint64_t sysTimestamp, uint64_t devTimestamp);
     bool                      ensureFitting();
+    void                      publishLinearFuncParam(const LinearFuncParam &param);
 
 private:
     const uint64_t MAX_VALID_RTT = 20000;  // 10ms
@@ -42,22 +44,24 @@ private:
     std::condition_variable sampleCondVar_;
     bool                    sampleLoopExit_;
 
-    typedef struct {
-        uint64_t systemTimestamp;
-        uint64_t deviceTimestamp;
-    } TimestampPair;
-
-    std::deque<TimestampPair> samplingQueue_;
-    uint32_t                  maxQueueSize_ = 100;
-    bool                      needCalculation_{ false };  // true if samplingQueue_ changed
+    // x: device timestamp, y: system timestamp
+    SlidingLinearRegression samplingQueue_;
+    uint32_t                maxQueueSize_ = 100;
+    bool                    needCalculation_{ false };  // true if samplingQueue_ changed
 
     // The refresh interval needs to be less than half the interval of the data frame, that is, it needs to be sampled at least twice within an overflow period.
     uint32_t refreshIntervalMsec_ = 1000;
 
+    // serializes the writers of the linear param, the readers go through the sequence lock below
     std::mutex              linearFuncParamMutex_;
     std::condition_variable linearFuncParamCondVar_;
-    LinearFuncParam         linearFuncParam_;
-    uint64_t                lastCheckDataY = 0;
-    uint64_t                maxValidRtt_;
+
+    // The linear param is read for every frame of every sensor, so it is published with a sequence lock: the reader copies the words
+    // and retries if the sequence changed meanwhile, it never blocks on the fitting thread.
+    static const size_t   LINEAR_FUNC_PARAM_WORDS = sizeof(LinearFuncParam) / sizeof(uint64_t);
+    std::atomic<uint32_t> linearFuncParamSeq_;
+    std::atomic<uint64_t> linearFuncParamWords_[LINEAR_FUNC_PARAM_WORDS];
+    std::atomic<uint64_t> lastCheckDataY_;
+    uint64_t              maxValidRtt_;
 };
 }  // namespace libobsensor
@@ -0,0 +1,125 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+namespace libobsensor {
+
+// Least squares fit of y = a * x + b over a sliding window of samples.
+// The regression sums are updated when a sample is pushed or popped instead of being recomputed over the whole window. They are
+// taken relative to an anchor sample to keep the values small, and are rebuilt around the oldest sample once the whole window has
+// been replaced, which bounds both the distance to the anchor and the rounding error accumulated by the removals.
+class SlidingLinearRegression {
+public:
+    struct Sample {
+        uint64_t x;
+        uint64_t y;
+    };
+
+    SlidingLinearRegression() {
+        clear();
+    }
+
+    void push(uint64_t x, uint64_t y) {
+        if(samples_.empty()) {
+            anchorX_ = x;
+            anchorY_ = y;
+        }
+        samples_.push_back({ x, y });
+        accumulate(samples_.back(), 1.0);
+    }
+
+    void popFront() {
+        if(samples_.empty()) {
+            return;
+        }
+        accumulate(samples_.front(), -1.0);
+        samples_.pop_front();
+        if(++popCount_ >= samples_.size()) {
+            rebuild();
+        }
+    }
+
+    void clear() {
+        samples_.clear();
+        anchorX_  = 0;
+        anchorY_  = 0;
+        popCount_ = 0;
+        sumX_     = 0;
+        sumY_     = 0;
+        sumXX_    = 0;
+        sumXY_    = 0;
+    }
+
+    size_t size() const {
+        return samples_.size();
+    }
+
+    bool empty() const {
+        return samples_.empty();
+    }
+
+    const Sample &front() const {
+        return samples_.front();
+    }
+
+    const Sample &back() const {
+        return samples_.back();
+    }
+
+    /**
+     * @brief Solve the fitted coefficients, returns false if the samples do not determine a line
+     */
+    bool solve(double &a, double &b) const {
+        auto n     = static_cast<double>(samples_.size());
+        auto denom = n * sumXX_ - sumX_ * sumX_;
+        if(samples_.size() < 2 || denom == 0) {
+            return false;
+        }
+        a = (sumXY_ * n - sumX_ * sumY_) / denom;
+        b = (sumXX_ * sumY_ - sumXY_ * sumX_) / denom + static_cast<double>(anchorY_) - a * static_cast<double>(anchorX_);
+        return true;
+    }
+
+private:
+    void accumulate(const Sample &sample, double sign) {
+        auto dx = static_cast<double>(static_cast<int64_t>(sample.x - anchorX_));
+        auto dy = static_cast<double>(static_cast<int64_t>(sample.y - anchorY_));
+        sumX_ += sign * dx;
+        sumY_ += sign * dy;
+        sumXX_ += sign * dx * dx;
+        sumXY_ += sign * dx * dy;
+    }
+
+    void rebuild() {
+        popCount_ = 0;
+        sumX_     = 0;
+        sumY_     = 0;
+        sumXX_    = 0;
+        sumXY_    = 0;
+        if(samples_.empty()) {
+            return;
+        }
+        anchorX_ = samples_.front().x;
+        anchorY_ = samples_.front().y;
+        for(const auto &sample: samples_) {
+            accumulate(sample, 1.0);
+        }
+    }
+
+private:
+    std::deque<Sample> samples_;
+    uint64_t           anchorX_;
+    uint64_t           anchorY_;
+    size_t             popCount_;  // samples popped since the last rebuild
+    double             sumX_;
+    double             sumY_;
+    double             sumXX_;
+    double             sumXY_;
+};
+
+}  // namespace libobsensor
@@ -43,6 +43,7 @@ Context::Context(const std::string &configFilePath) {
     filterFactory_           = FilterFactory::getInstance();
     platform_                = Platform::getInstance();
     dynamicLibraryManager_   = DynamicLibraryManager::getInstance();
+    metricsRegistry_         = MetricsRegistry::getInstance();
 
     if(configFilePath.empty()) {
         LOG_DEBUG("Context created! Library version: v{}", OB_LIB_VERSION_STR);
@@ -90,6 +91,10 @@ std::shared_ptr<Platform> Context::getPlatform() const {
     return platform_;
 }
 
+std::shared_ptr<MetricsRegistry> Context::getMetricsRegistry() const {
+    return metricsRegistry_;
+}
+
 #ifdef OB_BUILD_WITH_EXTENSIONS_COMMIT_HASH
 typedef const char *(*pfunc_ob_get_commit_hash)();
 
@@ -12,6 +12,7 @@
 #include "logger/Logger.hpp"
 #include "environment/EnvConfig.hpp"
 #include "frame/FrameMemoryPool.hpp"
+#include "metrics/MetricsRegistry.hpp"
 #include "stream/StreamIntrinsicsManager.hpp"
 #include "stream/StreamExtrinsicsManager.hpp"
 #include "FilterFactory.hpp"
@@ -36,6 +37,7 @@ public:
     std::shared_ptr<Logger>          getLogger() const;
     std::shared_ptr<FrameMemoryPool> getFrameMemoryPool() const;
     std::shared_ptr<Platform>        getPlatform() const;
+    std::shared_ptr<MetricsRegistry> getMetricsRegistry() const;
 
 private:
 #ifdef OB_BUILD_WITH_EXTENSIONS_COMMIT_HASH
@@ -50,6 +52,7 @@ private:
     std::shared_ptr<FilterFactory>           filterFactory_;
     std::shared_ptr<Platform>                platform_;
     std::shared_ptr<DynamicLibraryManager>   dynamicLibraryManager_;
+    std::shared_ptr<MetricsRegistry>         metricsRegistry_;
 
     std::once_flag devMgrFlag_;
 };
@@ -61,6 +64,7 @@ extern "C" {
 struct ob_context_t {
     std::shared_ptr<libobsensor::Context> context;
     std::vector<OBCallbackId>             callbackIds;
+    std::string                           metricsText;
 };
 #ifdef __cplusplus
 }
@@ -31,6 +31,11 @@ const float    CHIP_ADC_UNITS_PER_DEG_C   = 5.45f;  // This is a hardcoded param
 const uint32_t CHIP_EFUSE_REG_TEMP_CAL_TJ = 20739;  // Read from EFUSE address 0x0B. LSB: Temp Cal Version, MSB: Forced Tj
 const uint32_t CHIP_EFUSE_REG_TJ_ADC_VAL  = 1927;   // Read from EFUSE address 0x0C. Temp Sensor ADC value at Tj
 
+// Pipeline
+const size_t MAX_QUEUED_RAW_FRAMES            = 2;  // parsed raw frames waiting for the depth engine
+const size_t MAX_QUEUED_DEPTH_ENGINE_RESULTS  = 2;  // depth engine outputs waiting to be delivered
+const double RAW_PHASE_STATS_LOG_INTERVAL_SEC = 10.0;
+
 #pragma pack(push, 1)
 struct InputInfo {
     uint16_t systemId;
@@ -165,12 +170,20 @@ void RawPhaseStreamer::startStream(std::shared_ptr<const StreamProfile> sp, Muta
     auto &pair   = iter->second;
     auto  realSp = StreamProfileFactory::createVideoStreamProfile(profile->getType(), profile->getFormat(), pair.first, pair.second, profile->getFps());
     backend_->startStream(realSp, [this](std::shared_ptr<Frame> frame) {
-        std::unique_lock<std::mutex> lock(frameQueueMutex_);
-        if(frameQueue_.size() > 1) {
-            frameQueue_.pop();
+        // parse on the receive thread, the depth engine thread only runs the engine
+        RawPhaseJob job;
+        job.arrivalTime = std::chrono::steady_clock::now();
+        if(!parseFrame(std::move(frame), job)) {
+            return;
         }
+        parseCounter_.add(job.arrivalTime, std::chrono::steady_clock::now());
 
-        frameQueue_.push(frame);
+        std::unique_lock<std::mutex> lock(frameQueueMutex_);
+        if(frameQueue_.size() >= MAX_QUEUED_RAW_FRAMES) {
+            frameQueue_.pop_front();
+            droppedFrameCount_++;
+        }
+        frameQueue_.push_back(std::move(job));
         frameQueueCV_.notify_one();
     });
     running_ = true;
@@ -219,7 +232,22 @@ bool RawPhaseStreamer::isRunning() const {
     return running_;
 }
 
-void RawPhaseStreamer::parseAndOutputFrame(std::shared_ptr<Frame> frame) {
+void RawPhaseStreamer::StageCounter::add(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    auto us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+    count.fetch_add(1, std::memory_order_relaxed);
+    totalUs.fetch_add(us, std::memory_order_relaxed);
+    if(us > maxUs.load(std::memory_order_relaxed)) {
+        maxUs.store(us, std::memory_order_relaxed);
+    }
+}
+
+void RawPhaseStreamer::StageCounter::reset() {
+    count   = 0;
+    totalUs = 0;
+    maxUs   = 0;
+}
+
+bool RawPhaseStreamer::parseFrame(std::shared_ptr<Frame> frame, RawPhaseJob &job) {
     InputInfo inputInfo   = { 0 };
     size_t    captureSize = 0, rawFrameSize = 0; /** headerSize = 0*/
 
@@ -233,7 +261,7 @@ void RawPhaseStreamer::parseAndOutputFrame(std::shared_ptr<Frame> frame) {
         mipiHeadSize = sizeof(YEATS_MIPI_HDR);
     }
 
-    auto data = frame->getData();
+    auto data = frame->getDataMutable();
     // Try reading chip ID to determine if there is padding in header or not
     uint16_t chipId = *(uint16_t *)data;
     if(chipId == 0x5931) {
@@ -241,14 +269,10 @@ void RawPhaseStreamer::parseAndOutputFrame(std::shared_ptr<Frame> frame) {
         mipiHdr = *(YEATS_MIPI_HDR *)data;
     }
     else {
-        //  int size = sizeof(YEATS_MIPI_HDR) * 2;
         // For mode 4/7, we need to skip every other byte because of padding from Jetson Nano
-        std::vector<uint8_t> headerData(sizeof(YEATS_MIPI_HDR) * 2);
-        // inFile.read(reinterpret_cast<char *>(headerData.data()), sizeof(YEATS_MIPI_HDR) * 2);
-        memcpy(headerData.data(), data, sizeof(YEATS_MIPI_HDR) * 2);
+        uint8_t *mipiHdrArray = reinterpret_cast<uint8_t *>(&mipiHdr);
         for(size_t i = 0; i < sizeof(YEATS_MIPI_HDR); ++i) {
-            uint8_t *mipiHdrArray = reinterpret_cast<uint8_t *>(&mipiHdr);
-            mipiHdrArray[i]       = headerData[i * 2];
+            mipiHdrArray[i] = data[i * 2];
         }
     }
 
@@ -265,88 +289,138 @@ void RawPhaseStreamer::parseAndOutputFrame(std::shared_ptr<Frame> frame) {
     rawFrameSize = captureSize * inputInfo.nStreams;
     if(rawFrameSize > frameDataSize || inputInfo.nRows * 2u >= rawFrameSize) {
         LOG_ERROR("Frame data size error: rawFrameSize: {}, frameDataSize: {}, nRows: {}", rawFrameSize, frameDataSize, inputInfo.nRows);
-        return;
+        return false;
     }
 
-    uint8_t *dstData = (uint8_t *)data + rawFrameSize;
-    uint8_t *srcData = (uint8_t *)data + rawFrameSize - static_cast<size_t>(inputInfo.nRows) * 2;
+    uint8_t *dstData = data + rawFrameSize;
+    uint8_t *srcData = data + rawFrameSize - static_cast<size_t>(inputInfo.nRows) * 2;
     memcpy(dstData, srcData, mipiHeadSize);
 
-    auto   global      = depthEngineLoader_->getGlobalContext();
-    size_t outputBytes = global->plugin.depth_engine_get_output_frame_size(depthEngineContext_);
-
-    std::vector<uint8_t> outputBuffer(outputBytes, 0);
-
-    // For every frame, read the RAW data and process it.
-    k4a_depth_engine_input_frame_info_t  inputFrameInfo  = { 0 };
-    k4a_depth_engine_output_frame_info_t outputFrameInfo = { 0 };
+    // Need to add in the laser and sensor temperature info.
+    // Read this from the chip EFUSE in combination with header.
+    uint32_t Tj               = (CHIP_EFUSE_REG_TEMP_CAL_TJ >> 8);
+    float    sensorTempOffset = CHIP_EFUSE_REG_TJ_ADC_VAL - Tj * CHIP_ADC_UNITS_PER_DEG_C;
 
+    auto &inputFrameInfo = job.inputFrameInfo;
+    memset(&inputFrameInfo, 0, sizeof(inputFrameInfo));
     {
+        int32_t resvValue      = ((int32_t)mipiHdr.resv[0]) | ((int32_t)mipiHdr.resv[1] << 16);
+        int16_t integerPart    = static_cast<uint16_t>(resvValue / 1000);
+        int16_t fractionalPart = static_cast<uint16_t>(resvValue % 1000);
 
-        // Need to add in the laser and sensor temperature info.
-        // Read this from the chip EFUSE in combination with header.
-        uint32_t Tj               = (CHIP_EFUSE_REG_TEMP_CAL_TJ >> 8);
-        float    sensorTempOffset = CHIP_EFUSE_REG_TJ_ADC_VAL - Tj * CHIP_ADC_UNITS_PER_DEG_C;
-
-        {
+        float tmpValue               = static_cast<float>(integerPart) + static_cast<float>(fractionalPart) / 1000.0f;
+        inputFrameInfo.laser_temp[0] = tmpValue;
+    }
 
-            int32_t resvValue      = ((int32_t)mipiHdr.resv[0]) | ((int32_t)mipiHdr.resv[1] << 16);
-            int16_t integerPart    = static_cast<uint16_t>(resvValue / 1000);
-            int16_t fractionalPart = static_cast<uint16_t>(resvValue % 1000);
+    inputFrameInfo.laser_temp[1]               = 0;  // This can just be populated with 0
+    inputFrameInfo.sensor_temp                 = (((float)mipiHdr.tempSensorADC.bits.adcVal) - sensorTempOffset) / CHIP_ADC_UNITS_PER_DEG_C;
+    inputFrameInfo.center_of_exposure_in_ticks = 0;  // This isn't used within the depth engine
 
-            float tmpValue               = static_cast<float>(integerPart) + static_cast<float>(fractionalPart) / 1000.0f;
-            inputFrameInfo.laser_temp[0] = tmpValue;
-            // LOG_INFO("get temp from ebd:{}", tmpValue);
-            // LOG_INFO("origin data:{:x},{:x},{:x},{:x}", mipiHdr.resv[0], mipiHdr.resv[1], mipiHdr.resv[2], mipiHdr.resv[3]);
-        }
+    job.outputType = k4a_depth_engine_output_type_t::K4A_DEPTH_ENGINE_OUTPUT_TYPE_Z_DEPTH;
+    if(passiveIRModeEnabled_) {
+        job.outputType = k4a_depth_engine_output_type_t::K4A_DEPTH_ENGINE_OUTPUT_TYPE_PCM;
+    }
+    job.rawData      = data + mipiHeadSize;
+    job.rawFrameSize = rawFrameSize;
+    job.frame        = std::move(frame);
+    return true;
+}
 
-        inputFrameInfo.laser_temp[1]               = 0;  // This can just be populated with 0
-        inputFrameInfo.sensor_temp                 = (((float)mipiHdr.tempSensorADC.bits.adcVal) - sensorTempOffset) / CHIP_ADC_UNITS_PER_DEG_C;
-        inputFrameInfo.center_of_exposure_in_ticks = 0;  // This isn't used within the depth engine
+bool RawPhaseStreamer::processFrame(RawPhaseJob &job, DepthEngineResult &result) {
+    auto global         = depthEngineLoader_->getGlobalContext();
+    result.outputBuffer = acquireOutputBuffer();
 
-        k4a_depth_engine_output_type_t outputType = k4a_depth_engine_output_type_t::K4A_DEPTH_ENGINE_OUTPUT_TYPE_Z_DEPTH;
-        if(passiveIRModeEnabled_) {
-            outputType = k4a_depth_engine_output_type_t::K4A_DEPTH_ENGINE_OUTPUT_TYPE_PCM;
-        }
+    auto retCode =
+        global->plugin.depth_engine_process_frame(depthEngineContext_, const_cast<uint8_t *>(job.rawData), job.rawFrameSize, job.outputType,
+                                                  result.outputBuffer.data(), result.outputBuffer.size(), &result.outputFrameInfo, &job.inputFrameInfo);
+    if(K4A_DEPTH_ENGINE_RESULT_SUCCEEDED != retCode) {
+        LOG_ERROR("Process frame failed! Error code:{}", static_cast<int>(retCode));
+        releaseOutputBuffer(std::move(result.outputBuffer));
+        return false;
+    }
 
-        auto retCode = global->plugin.depth_engine_process_frame(depthEngineContext_, (uint8_t *)data + mipiHeadSize, rawFrameSize, outputType,
-                                                                 outputBuffer.data(), outputBytes, &outputFrameInfo, &inputFrameInfo);
+    result.frame       = std::move(job.frame);
+    result.outputType  = job.outputType;
+    result.arrivalTime = job.arrivalTime;
+    return true;
+}
 
-        if(K4A_DEPTH_ENGINE_RESULT_SUCCEEDED != retCode) {
-            LOG_ERROR("Process frame failed! Error code:{}", static_cast<int>(retCode));
-            return;
+void RawPhaseStreamer::outputFrame(const DepthEngineResult &result) {
+    // Now we have the output data. They are uint16_t type and AB frame immediately follows Z frame.
+    auto  &outputFrameInfo = result.outputFrameInfo;
+    auto   outputType      = result.outputType;
+    size_t nPixels         = static_cast<size_t>(outputFrameInfo.output_height) * static_cast<size_t>(outputFrameInfo.output_width);
+    auto   outputFrame     = reinterpret_cast<const uint16_t *>(result.outputBuffer.data());
+    auto   zFrame          = outputFrame;
+    auto   abFrame         = outputFrame + nPixels;
+
+    if(outputType == k4a_depth_engine_output_type_t::K4A_DEPTH_ENGINE_OUTPUT_TYPE_PCM) {
+        abFrame = zFrame;
+    }
+
+    std::lock_guard<std::mutex> lock(cbMtx_);
+    for(const auto &iter: callbacks_) {
+        if(iter.first->getType() == OB_STREAM_DEPTH && outputType != k4a_depth_engine_output_type_t::K4A_DEPTH_ENGINE_OUTPUT_TYPE_PCM) {
+            auto depthStreamProfile = iter.first->as<libobsensor::VideoStreamProfile>();
+            auto depthFrame         = FrameFactory::createFrameFromStreamProfile(depthStreamProfile);
+            depthFrame->updateData((const uint8_t *)zFrame, nPixels * 2);
+            depthFrame->setDataSize(nPixels * 2);
+            depthFrame->copyInfoFromOther(result.frame);
+            iter.second(depthFrame);
         }
-
-        // Now we have the output data. They are uint16_t type and AB frame immediately follows Z frame.
-        size_t    nPixels     = static_cast<size_t>(outputFrameInfo.output_height) * static_cast<size_t>(outputFrameInfo.output_width);
-        uint16_t *outputFrame = reinterpret_cast<uint16_t *>(outputBuffer.data());
-        uint16_t *zFrame      = outputFrame;
-        uint16_t *abFrame     = outputFrame + nPixels;
-
-        if(outputType == k4a_depth_engine_output_type_t::K4A_DEPTH_ENGINE_OUTPUT_TYPE_PCM) {
-            abFrame = zFrame;
+        else if(iter.first->getType() == OB_STREAM_IR) {
+            auto irStreamProfile = iter.first->as<libobsensor::VideoStreamProfile>();
+            auto irFrame         = FrameFactory::createFrameFromStreamProfile(irStreamProfile);
+            irFrame->updateData((const uint8_t *)abFrame, nPixels * 2);
+            irFrame->setDataSize(nPixels * 2);
+            irFrame->copyInfoFromOther(result.frame);
+            iter.second(irFrame);
         }
+    }
+}
 
-        std::lock_guard<std::mutex> lock(cbMtx_);
-        for(const auto &iter: callbacks_) {
-            if(iter.first->getType() == OB_STREAM_DEPTH && outputType != k4a_depth_engine_output_type_t::K4A_DEPTH_ENGINE_OUTPUT_TYPE_PCM) {
-                auto depthStreamProfile = iter.first->as<libobsensor::VideoStreamProfile>();
-                auto depthFrame         = FrameFactory::createFrameFromStreamProfile(depthStreamProfile);
-                depthFrame->updateData((const uint8_t *)zFrame, nPixels * 2);
-                depthFrame->setDataSize(nPixels * 2);
-                depthFrame->copyInfoFromOther(frame);
-                iter.second(depthFrame);
-            }
-            else if(iter.first->getType() == OB_STREAM_IR) {
-                auto irStreamProfile = iter.first->as<libobsensor::VideoStreamProfile>();
-                auto irFrame         = FrameFactory::createFrameFromStreamProfile(irStreamProfile);
-                irFrame->updateData((const uint8_t *)abFrame, nPixels * 2);
-                irFrame->setDataSize(nPixels * 2);
-                irFrame->copyInfoFromOther(frame);
-                iter.second(irFrame);
-            }
+std::vector<uint8_t> RawPhaseStreamer::acquireOutputBuffer() {
+    std::vector<uint8_t> buffer;
+    {
+        std::lock_guard<std::mutex> lock(outputBufferPoolMutex_);
+        if(!outputBufferPool_.empty()) {
+            buffer = std::move(outputBufferPool_.back());
+            outputBufferPool_.pop_back();
         }
     }
+    buffer.resize(outputBufferSize_);
+    return buffer;
+}
+
+void RawPhaseStreamer::releaseOutputBuffer(std::vector<uint8_t> &&buffer) {
+    if(buffer.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(outputBufferPoolMutex_);
+    outputBufferPool_.push_back(std::move(buffer));
+}
+
+void RawPhaseStreamer::logPipelineStats() {
+    auto now     = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration<double>(now - statsStartTime_).count();
+    if(elapsed < RAW_PHASE_STATS_LOG_INTERVAL_SEC) {
+        return;
+    }
+
+    auto avgUs = [](const StageCounter &counter) {
+        auto count = counter.count.load();
+        return count == 0 ? 0 : counter.totalUs.load() / count;
+    };
+    LOG_DEBUG("Raw phase pipeline: {:.1f} fps, dropped: {}, parse: {}/{}us, depth engine: {}/{}us, output: {}/{}us, latency: {}/{}us (avg/max)",
+              outputCounter_.count.load() / elapsed, droppedFrameCount_.load(), avgUs(parseCounter_), parseCounter_.maxUs.load(), avgUs(engineCounter_),
+              engineCounter_.maxUs.load(), avgUs(outputCounter_), outputCounter_.maxUs.load(), avgUs(latencyCounter_), latencyCounter_.maxUs.load());
+
+    parseCounter_.reset();
+    engineCounter_.reset();
+    outputCounter_.reset();
+    latencyCounter_.reset();
+    droppedFrameCount_ = 0;
+    statsStartTime_    = now;
 }
 
 k4a_depth_engine_mode_t RawPhaseStreamer::getDepthEngineMode(std::shared_ptr<const StreamProfile> profile) {
@@ -381,9 +455,88 @@ void RawPhaseStreamer::stopDepthEngineThread() {
     depthEngineThreadExit_ = true;
     {
         std::unique_lock<std::mutex> lock(frameQueueMutex_);
-        frameQueueCV_.notify_one();
+        frameQueueCV_.notify_all();
+    }
+    {
+        std::unique_lock<std::mutex> lock(resultQueueMutex_);
+        resultQueueCV_.notify_all();
     }
     depthEngineThread_.join();
+    if(outputThread_.joinable()) {
+        outputThread_.join();
+    }
+
+    // the queued frames were parsed for the stopped depth engine
+    {
+        std::unique_lock<std::mutex> lock(frameQueueMutex_);
+        frameQueue_.clear();
+    }
+    resultQueue_.clear();
+    std::lock_guard<std::mutex> lock(outputBufferPoolMutex_);
+    outputBufferPool_.clear();
+}
+
+void RawPhaseStreamer::depthEngineLoop(std::shared_ptr<const StreamProfile> profile) {
+    // depth engine must be initialize, using and deinitialize in the same thread
+    initDepthEngine(profile);  // init depth engine
+    outputBufferSize_ = depthEngineLoader_->getGlobalContext()->plugin.depth_engine_get_output_frame_size(depthEngineContext_);
+
+    while(!depthEngineThreadExit_) {
+        RawPhaseJob job;
+        {
+            std::unique_lock<std::mutex> lock(frameQueueMutex_);
+            frameQueueCV_.wait(lock, [&]() { return !frameQueue_.empty() || depthEngineThreadExit_; });
+            if(depthEngineThreadExit_) {
+                break;
+            }
+
+            job = std::move(frameQueue_.front());
+            frameQueue_.pop_front();
+        }
+
+        DepthEngineResult result;
+        auto              start = std::chrono::steady_clock::now();
+        if(!processFrame(job, result)) {
+            continue;
+        }
+        engineCounter_.add(start, std::chrono::steady_clock::now());
+
+        // wait for the output thread rather than dropping a processed frame, the raw frame queue drops instead
+        std::unique_lock<std::mutex> lock(resultQueueMutex_);
+        resultQueueCV_.wait(lock, [&]() { return resultQueue_.size() < MAX_QUEUED_DEPTH_ENGINE_RESULTS || depthEngineThreadExit_; });
+        if(depthEngineThreadExit_) {
+            break;
+        }
+        resultQueue_.push_back(std::move(result));
+        resultQueueCV_.notify_all();
+    }
+    deinitDepthEngine();
+}
+
+void RawPhaseStreamer::outputLoop() {
+    while(!depthEngineThreadExit_) {
+        DepthEngineResult result;
+        {
+            std::unique_lock<std::mutex> lock(resultQueueMutex_);
+            resultQueueCV_.wait(lock, [&]() { return !resultQueue_.empty() || depthEngineThreadExit_; });
+            if(depthEngineThreadExit_) {
+                break;
+            }
+
+            result = std::move(resultQueue_.front());
+            resultQueue_.pop_front();
+            resultQueueCV_.notify_all();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        outputFrame(result);
+        auto end = std::chrono::steady_clock::now();
+        outputCounter_.add(start, end);
+        latencyCounter_.add(result.arrivalTime, end);
+
+        releaseOutputBuffer(std::move(result.outputBuffer));
+        logPipelineStats();
+    }
 }
 
 void RawPhaseStreamer::startDepthEngineThread(std::shared_ptr<const StreamProfile> profile) {
@@ -399,6 +552,7 @@ void RawPhaseStreamer::startDepthEngineThread(std::shared_ptr<const StreamProfil
     lastStreamProfile_     = profile;
     depthEngineThreadExit_ = false;
     depthEngineReady_      = false;
+    statsStartTime_        = std::chrono::steady_clock::now();
 #ifdef OB_BOLT_OPENGL_COMPAT
     // clear opengl context before depth engine initialize
     auto display        = glXGetCurrentDisplay();
@@ -406,25 +560,8 @@ void RawPhaseStreamer::startDepthEngineThread(std::shared_ptr<const StreamProfil
     auto currentContext = glXGetCurrentContext();
     glXMakeCurrent(nullptr, None, nullptr);
 #endif
-    depthEngineThread_ = std::thread([profile, this] {
-        // depth engine must be initialize, using and deinitialize in the same thread
-        initDepthEngine(profile);  // init depth engine
-        std::shared_ptr<Frame> frame;
-        while(!depthEngineThreadExit_) {
-            {
-                std::unique_lock<std::mutex> lock(frameQueueMutex_);
-                frameQueueCV_.wait(lock, [&]() { return !frameQueue_.empty() || depthEngineThreadExit_; });
-                if(depthEngineThreadExit_) {
-                    break;
-                }
-
-                frame = frameQueue_.front();
-                frameQueue_.pop();
-            }
-            parseAndOutputFrame(frame);
-        }
-        deinitDepthEngine();
-    });
+    depthEngineThread_ = std::thread([profile, this] { depthEngineLoop(profile); });
+    outputThread_      = std::thread([this] { outputLoop(); });
 
     // wait for depth engine ready
     std::unique_lock<std::mutex> depthEngineLock(depthEngineMutex_);
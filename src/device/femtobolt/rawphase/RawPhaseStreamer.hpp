@@ -5,9 +5,11 @@
 
 #include <condition_variable>
 #include <atomic>
+#include <chrono>
+#include <deque>
 #include <map>
 #include <mutex>
-#include <queue>
+#include <vector>
 
 #include "ISourcePort.hpp"
 #include "IDeviceComponent.hpp"
@@ -15,6 +17,13 @@
 #include "depthengine/YeatsFrameHdr.h"
 
 namespace libobsensor {
+
+/**
+ * @brief Converts the raw phase frames of Femto Bolt to depth/IR frames with the depth engine
+ * @brief The conversion is pipelined in three stages: the MIPI header is parsed on the backend receive thread, the depth engine runs on its own
+ * thread (it must init/process/deinit on the same thread) and the output frames are created and delivered on an output thread, so the engine can
+ * start the next frame while the previous one is still being delivered. The engine writes to output buffers reused across frames.
+ */
 class RawPhaseStreamer : public IDeviceComponent, public IVideoStreamPort {
 public:
     RawPhaseStreamer(IDevice *owner, const std::shared_ptr<IVideoStreamPort> &backend);
@@ -33,7 +42,44 @@ public:
     void waitNvramDataReady();
 
 private:
-    void parseAndOutputFrame(std::shared_ptr<Frame> frame);
+    // raw phase frame parsed from the MIPI header, ready for the depth engine
+    struct RawPhaseJob {
+        std::shared_ptr<Frame>                frame;
+        const uint8_t                        *rawData      = nullptr;
+        size_t                                rawFrameSize = 0;
+        k4a_depth_engine_input_frame_info_t   inputFrameInfo;
+        k4a_depth_engine_output_type_t        outputType;
+        std::chrono::steady_clock::time_point arrivalTime;
+    };
+
+    // depth engine output waiting to be delivered
+    struct DepthEngineResult {
+        std::shared_ptr<Frame>                frame;  // source raw frame, the frame info of the output frames is copied from it
+        std::vector<uint8_t>                  outputBuffer;
+        k4a_depth_engine_output_frame_info_t  outputFrameInfo;
+        k4a_depth_engine_output_type_t        outputType;
+        std::chrono::steady_clock::time_point arrivalTime;
+    };
+
+    // Per stage counters, every stage is updated by a single thread
+    struct StageCounter {
+        std::atomic<uint64_t> count{ 0 };
+        std::atomic<uint64_t> totalUs{ 0 };
+        std::atomic<uint64_t> maxUs{ 0 };
+
+        void add(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+        void reset();
+    };
+
+    bool parseFrame(std::shared_ptr<Frame> frame, RawPhaseJob &job);
+    bool processFrame(RawPhaseJob &job, DepthEngineResult &result);
+    void outputFrame(const DepthEngineResult &result);
+
+    void                 depthEngineLoop(std::shared_ptr<const StreamProfile> profile);
+    void                 outputLoop();
+    std::vector<uint8_t> acquireOutputBuffer();
+    void                 releaseOutputBuffer(std::vector<uint8_t> &&buffer);
+    void                 logPipelineStats();
 
     // depth engine
     void                    initNvramData();
@@ -69,16 +115,34 @@ private:
     k4a_depth_engine_mode_t     curDepthEngineMode_ = K4A_DEPTH_ENGINE_MODE_UNKNOWN;
 
     std::shared_ptr<DepthEngineLoadFactory> depthEngineLoader_;
-    bool                                    depthEngineThreadExit_ = false;
+    std::atomic<bool>                       depthEngineThreadExit_{ false };
     std::thread                             depthEngineThread_;
+    std::thread                             outputThread_;
     std::shared_ptr<const StreamProfile>    lastStreamProfile_;
     std::mutex                              depthEngineMutex_;
     std::condition_variable                 depthEngineCV_;
     bool                                    depthEngineReady_ = false;
 
-    std::mutex                         frameQueueMutex_;
-    std::condition_variable            frameQueueCV_;
-    std::queue<std::shared_ptr<Frame>> frameQueue_;
+    // parsed raw frames waiting for the depth engine, the oldest one is dropped when full
+    std::mutex              frameQueueMutex_;
+    std::condition_variable frameQueueCV_;
+    std::deque<RawPhaseJob> frameQueue_;
+
+    // depth engine results waiting for output, the depth engine waits when full
+    std::mutex                    resultQueueMutex_;
+    std::condition_variable       resultQueueCV_;
+    std::deque<DepthEngineResult> resultQueue_;
+
+    std::mutex                        outputBufferPoolMutex_;
+    std::vector<std::vector<uint8_t>> outputBufferPool_;
+    size_t                            outputBufferSize_ = 0;
+
+    StageCounter                          parseCounter_;
+    StageCounter                          engineCounter_;
+    StageCounter                          outputCounter_;
+    StageCounter                          latencyCounter_;  // from frame arrival to output frame delivered
+    std::atomic<uint64_t>                 droppedFrameCount_{ 0 };
+    std::chrono::steady_clock::time_point statsStartTime_;
 };
 
 }  // namespace libobsensor
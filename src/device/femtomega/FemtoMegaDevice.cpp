@@ -30,6 +30,7 @@
 #include "publicfilters/IMUCorrector.hpp"
 
 #include "utils/BufferParser.hpp"
+#include "utils/Utils.hpp"
 #include "utils/PublicTypeHelper.hpp"
 
 #include "FemtoMegaPropertyAccessor.hpp"
@@ -52,11 +53,15 @@ FemtoMegaUsbDevice::FemtoMegaUsbDevice(const std::shared_ptr<const IDeviceEnumIn
 FemtoMegaUsbDevice::~FemtoMegaUsbDevice() noexcept {}
 
 void FemtoMegaUsbDevice::init() {
+    utils::Timer timer;
     initSensorList();
     initProperties();
+    auto sensorsAndPropertiesMs = timer.touchMs();
 
     fetchDeviceInfo();
     fetchExtensionInfo();
+    // The calibration params are not cached: there is no small calibration data to detect a recalibration with.
+    auto deviceInfoMs = timer.touchMs();
     if(getFirmwareVersionInt() >= 10209) {
         deviceTimeFreq_ = 1000000;
         frameTimeFreq_  = 1000000;
@@ -67,6 +72,7 @@ void FemtoMegaUsbDevice::init() {
 
     auto algParamManager = std::make_shared<TOFDeviceCommonAlgParamManager>(this);
     registerComponent(OB_DEV_COMPONENT_ALG_PARAM_MANAGER, algParamManager);
+    auto algParamMs = timer.touchMs();
 
     auto presetManager = std::make_shared<MegaPresetManager>(this);
     registerComponent(OB_DEV_COMPONENT_PRESET_MANAGER, presetManager);
@@ -94,6 +100,11 @@ void FemtoMegaUsbDevice::init() {
 
     auto deviceClockSynchronizer = std::make_shared<DeviceClockSynchronizer>(this, deviceTimeFreq_, deviceTimeFreq_);
     registerComponent(OB_DEV_COMPONENT_DEVICE_CLOCK_SYNCHRONIZER, deviceClockSynchronizer);
+
+    auto othersMs = timer.touchMs();
+    auto totalMs  = timer.touchMs(false);
+    LOG_DEBUG("Device open time: sensors and properties {}ms, device info {}ms, alg params {}ms, others {}ms, total {}ms, {}", sensorsAndPropertiesMs,
+              deviceInfoMs, algParamMs, othersMs, totalMs, getPersistentDataCacheSummary());
 }
 
 void FemtoMegaUsbDevice::initSensorStreamProfile(std::shared_ptr<ISensor> sensor) {
@@ -526,14 +537,21 @@ FemtoMegaNetDevice::FemtoMegaNetDevice(const std::shared_ptr<const IDeviceEnumIn
 FemtoMegaNetDevice::~FemtoMegaNetDevice() noexcept {}
 
 void FemtoMegaNetDevice::init() {
+    utils::Timer timer;
     initProperties();
 
     fetchDeviceInfo();
     fetchExtensionInfo();
+    auto deviceInfoMs = timer.touchMs();
 
     if(!inRecoveryMode_) {
+        // Only the stream profile list is cached, it depends on the firmware only. The calibration params and the D2C profile list are not:
+        // there is no small calibration data to detect a recalibration with.
+        enablePersistentDataCache({ OB_RAW_DATA_STREAM_PROFILE_LIST });
+
         initSensorList();
         fetchAllVideoStreamProfileList();
+        auto profileListMs = timer.touchMs();
 
         if(getFirmwareVersionInt() >= 10209) {
             deviceTimeFreq_     = 1000000;
@@ -545,6 +563,7 @@ void FemtoMegaNetDevice::init() {
 
         auto algParamManager = std::make_shared<TOFDeviceCommonAlgParamManager>(this);
         registerComponent(OB_DEV_COMPONENT_ALG_PARAM_MANAGER, algParamManager);
+        auto algParamMs = timer.touchMs();
 
         auto presetManager = std::make_shared<MegaPresetManager>(this);
         registerComponent(OB_DEV_COMPONENT_PRESET_MANAGER, presetManager);
@@ -574,6 +593,11 @@ void FemtoMegaNetDevice::init() {
 
         auto deviceClockSynchronizer = std::make_shared<DeviceClockSynchronizer>(this, deviceTimeFreq_, deviceTimeFreq_);
         registerComponent(OB_DEV_COMPONENT_DEVICE_CLOCK_SYNCHRONIZER, deviceClockSynchronizer);
+
+        auto othersMs = timer.touchMs();
+        auto totalMs  = timer.touchMs(false);
+        LOG_DEBUG("Device open time: device info {}ms, sensors and profile list {}ms, alg params {}ms, others {}ms, total {}ms, {}", deviceInfoMs,
+                  profileListMs, algParamMs, othersMs, totalMs, getPersistentDataCacheSummary());
     }
     // firmware updater
     registerComponent(OB_DEV_COMPONENT_FIRMWARE_UPDATER, [this]() {
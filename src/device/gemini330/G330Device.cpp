@@ -81,6 +81,7 @@ G330Device::G330Device(const std::shared_ptr<const IDeviceEnumInfo> &info) : Dev
 G330Device::~G330Device() noexcept {}
 
 void G330Device::init() {
+    utils::Timer timer;
     if(isGmslDevice_) {
         LOG_DEBUG("G330Device::init() for GMSL2 device");
         initSensorListGMSL();
@@ -89,8 +90,15 @@ void G330Device::init() {
         initSensorList();
     }
     initProperties();
+    auto sensorsAndPropertiesMs = timer.touchMs();
+
     fetchDeviceInfo();
     fetchExtensionInfo();
+    // the depth calibration param is small and always read from the device, it validates the cached calibration data
+    enablePersistentDataCache({ OB_RAW_DATA_ALIGN_CALIB_PARAM, OB_RAW_DATA_D2C_ALIGN_SUPPORT_PROFILE_LIST }, [this]() {
+        return getPropertyServer()->getStructureDataListProtoV1_1(OB_RAW_DATA_DEPTH_CALIB_PARAM, 1, PROP_ACCESS_INTERNAL);
+    });
+    auto deviceInfoMs = timer.touchMs();
 
     videoFrameTimestampCalculatorCreator_ = [this]() {
         auto vid          = deviceInfo_->vid_;
@@ -107,6 +115,7 @@ void G330Device::init() {
 
     auto algParamManager = std::make_shared<G330AlgParamManager>(this);
     registerComponent(OB_DEV_COMPONENT_ALG_PARAM_MANAGER, algParamManager);
+    auto algParamMs = timer.touchMs();
 
     auto depthWorkModeManager = std::make_shared<G330DepthWorkModeManager>(this);
     registerComponent(OB_DEV_COMPONENT_DEPTH_WORK_MODE_MANAGER, depthWorkModeManager);
@@ -260,6 +269,11 @@ void G330Device::init() {
     });
 
     fetchDeviceErrorState();
+
+    auto othersMs = timer.touchMs();
+    auto totalMs  = timer.touchMs(false);
+    LOG_DEBUG("Device open time: sensors and properties {}ms, device info {}ms, alg params {}ms, others {}ms, total {}ms, {}", sensorsAndPropertiesMs,
+              deviceInfoMs, algParamMs, othersMs, totalMs, getPersistentDataCacheSummary());
 }
 
 void G330Device::fetchDeviceInfo() {
@@ -1454,12 +1468,22 @@ void G330NetDevice::deactivate() {
 }
 
 void G330NetDevice::init() {
+    utils::Timer timer;
     checkAndAcquireCCP();
     initSensorList();
     initProperties();
+    auto sensorsAndPropertiesMs = timer.touchMs();
+
     fetchDeviceInfo();
     fetchExtensionInfo();
+    // the depth calibration param is small and always read from the device, it validates the cached calibration data
+    enablePersistentDataCache({ OB_RAW_DATA_ALIGN_CALIB_PARAM, OB_RAW_DATA_D2C_ALIGN_SUPPORT_PROFILE_LIST, OB_RAW_DATA_STREAM_PROFILE_LIST }, [this]() {
+        return getPropertyServer()->getStructureDataListProtoV1_1(OB_RAW_DATA_DEPTH_CALIB_PARAM, 1, PROP_ACCESS_INTERNAL);
+    });
+    auto deviceInfoMs = timer.touchMs();
+
     fetchAllProfileList();
+    auto profileListMs = timer.touchMs();
 
     videoFrameTimestampCalculatorCreator_ = [this]() {
         auto vid          = deviceInfo_->vid_;
@@ -1476,6 +1500,7 @@ void G330NetDevice::init() {
 
     auto algParamManager = std::make_shared<G330AlgParamManager>(this);
     registerComponent(OB_DEV_COMPONENT_ALG_PARAM_MANAGER, algParamManager);
+    auto algParamMs = timer.touchMs();
 
     auto depthWorkModeManager = std::make_shared<G330DepthWorkModeManager>(this);
     registerComponent(OB_DEV_COMPONENT_DEPTH_WORK_MODE_MANAGER, depthWorkModeManager);
@@ -1635,6 +1660,11 @@ void G330NetDevice::init() {
                                            });
 
     fetchDeviceErrorState();
+
+    auto othersMs = timer.touchMs();
+    auto totalMs  = timer.touchMs(false);
+    LOG_DEBUG("Device open time: sensors and properties {}ms, device info {}ms, profile list {}ms, alg params {}ms, others {}ms, total {}ms, {}",
+              sensorsAndPropertiesMs, deviceInfoMs, profileListMs, algParamMs, othersMs, totalMs, getPersistentDataCacheSummary());
 }
 
 void G330NetDevice::postInitialize() {
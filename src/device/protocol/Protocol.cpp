@@ -213,6 +213,40 @@ HpStatus execute(const std::shared_ptr<IVendorDataPort> &dataPort, uint8_t *reqD
     return hpStatus;
 }
 
+void executeBatch(const std::shared_ptr<IVendorDataPort> &dataPort, std::vector<BatchRequest> &requests) {
+    std::vector<VendorTransfer> transfers;
+    transfers.reserve(requests.size());
+    for(auto &request: requests) {
+        uint16_t expectedRespLen = request.expectedRespLen;
+        if(expectedRespLen == 0) {
+            expectedRespLen = getExpectedRespSize(static_cast<HpOpCodes>(((ReqHeader *)(request.reqData))->opcode));
+        }
+        transfers.push_back({ request.reqData, request.reqDataSize, request.respData, expectedRespLen, 0 });
+    }
+
+    dataPort->sendAndReceiveBatch(transfers);
+
+    for(size_t i = 0; i < requests.size(); i++) {
+        auto &request        = requests[i];
+        auto  header         = (ReqHeader *)(request.reqData);
+        request.respDataSize = static_cast<uint16_t>(transfers[i].recvLen);
+        if(request.respDataSize == 0) {
+            request.status.statusCode    = HP_STATUS_CONTROL_TRANSFER_FAILED;
+            request.status.respErrorCode = HP_RESP_ERROR_UNKNOWN;
+            request.status.msg           = "Send control transfer failed!";
+            continue;
+        }
+        request.status = validateResp(request.respData, request.respDataSize, header->opcode, header->requestId);
+    }
+}
+
+bool isTransientStatus(const HpStatus &status) {
+    // Same conditions as the retry loop of execute(), plus transfer failures
+    return status.statusCode == HP_STATUS_CONTROL_TRANSFER_FAILED || status.statusCode == HP_STATUS_DEVICE_RESPONSE_IO_ERROR
+           || status.statusCode == HP_STATUS_DEVICE_RESPONSE_BAD_MAGIC || status.statusCode == HP_STATUS_DEVICE_RESPONSE_WRONG_ID
+           || status.statusCode == HP_STATUS_DEVICE_RESPONSE_WRONG_DATA_SIZE || status.respErrorCode == HP_RESP_ERROR_DEVICE_BUSY;
+}
+
 uint16_t generateRequestId() {
     static uint16_t requestId = 0;
     requestId++;
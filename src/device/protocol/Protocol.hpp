@@ -282,8 +282,21 @@ ReadRawDataResp               *parseReadRawDataResp(uint8_t *dataBuf, uint16_t d
 StartGetStructureDataListResp *parseStartStructureDataListResp(uint8_t *dataBuf, uint16_t dataSize);
 HeartbeatAndStateResp         *parseHeartbeatAndStateResp(uint8_t *dataBuf, uint16_t dataSize);
 
+struct BatchRequest {
+    uint8_t *reqData;
+    uint16_t reqDataSize;
+    uint8_t *respData;
+    uint16_t respDataSize;
+    uint16_t expectedRespLen;  // 0: use the default size of the opcode
+    HpStatus status;
+};
+
 HpStatus execute(const std::shared_ptr<IVendorDataPort> &dataPort, uint8_t *reqData, uint16_t reqDataSize, uint8_t *respData, uint16_t *respDataSize,
                  uint16_t expectedRespLen = 0);
+// Send all requests through IVendorDataPort::sendAndReceiveBatch and validate each response, without retries.
+// Requests that failed with a transient status (see isTransientStatus) can be re-executed with execute().
+void executeBatch(const std::shared_ptr<IVendorDataPort> &dataPort, std::vector<BatchRequest> &requests);
+bool isTransientStatus(const HpStatus &status);
 bool     checkStatus(uint32_t propertyId, HpStatus stat, bool throwException = true);
 
 }  // namespace protocol
@@ -3,15 +3,18 @@
 
 #include "FilterDecorator.hpp"
 #include "frame/FrameFactory.hpp"
+#include "frame/FrameLatencyTracer.hpp"
 #include "exception/ObException.hpp"
 #include "logger/LoggerInterval.hpp"
 #include "utils/StringUtils.hpp"
+#include "utils/Utils.hpp"
 namespace libobsensor {
 
 const size_t DEFAULT_FRAME_QUEUE_CAPACITY = 10;
 
 FilterExtension::FilterExtension(const std::string &name) : name_(name), enabled_(true), configChanged_(false) {
-    srcFrameQueue_ = std::make_shared<FrameQueue<const Frame>>(DEFAULT_FRAME_QUEUE_CAPACITY);  // todo： read from config file to set the size of frame queue
+    // todo： read from config file to set the size of frame queue
+    srcFrameQueue_ = std::make_shared<FrameQueue<const Frame>>(DEFAULT_FRAME_QUEUE_CAPACITY, "filter_" + name_);
     LOG_DEBUG("Filter {} created with frame queue capacity {}", name_, srcFrameQueue_->capacity());
 }
 
@@ -26,19 +29,23 @@ const std::string &FilterExtension::getName() const {
 void FilterExtension::pushFrame(std::shared_ptr<const Frame> frame) {
     if(!srcFrameQueue_->isStarted()) {
         srcFrameQueue_->start([&](std::shared_ptr<const Frame> frameToProcess) {
+            FrameLatencyTracer::record(OB_FRAME_TRACE_STAGE_FILTER_DEQUEUE, frameToProcess, name_.c_str());
             std::shared_ptr<Frame> rstFrame;
             if(enabled_) {
                 checkAndUpdateConfig();
-                BEGIN_TRY_EXECUTE({ rstFrame = process(frameToProcess); })
+                auto frameType   = frameToProcess->getType();
+                auto frameNumber = frameToProcess->getNumber();
+                // pass the reference on, a filter holding the only one may process the frame in place
+                BEGIN_TRY_EXECUTE({ rstFrame = process(std::move(frameToProcess)); })
                 CATCH_EXCEPTION_AND_EXECUTE({  // catch all exceptions to avoid crashing on the inner thread
-                    LOG_WARN("Filter {}: exception caught while processing frame {}#{}, this frame will be dropped", name_, frameToProcess->getType(),
-                             frameToProcess->getNumber());
+                    LOG_WARN("Filter {}: exception caught while processing frame {}#{}, this frame will be dropped", name_, frameType, frameNumber);
                     return;
                 })
             }
             else {
-                rstFrame = FrameFactory::createFrameFromOtherFrame(frameToProcess, true);
+                rstFrame = FrameFactory::createFrameView(frameToProcess);
             }
+            FrameLatencyTracer::record(OB_FRAME_TRACE_STAGE_FILTER_PROCESS_END, rstFrame, name_.c_str());
             std::unique_lock<std::mutex> lock(callbackMutex_);
             if(callback_ && rstFrame) {
                 callback_(rstFrame);
@@ -46,6 +53,7 @@ void FilterExtension::pushFrame(std::shared_ptr<const Frame> frame) {
         });
         LOG_DEBUG("Filter {}: start frame queue", name_);
     }
+    FrameLatencyTracer::record(OB_FRAME_TRACE_STAGE_FILTER_ENQUEUE, frame, name_.c_str());
     srcFrameQueue_->enqueue(frame);
 }
 
@@ -279,7 +287,11 @@ void FilterExtension::updateConfigCache(std::vector<std::string> &params) {
     }
 }
 
-FilterDecorator::FilterDecorator(const std::string &name, std::shared_ptr<IFilterBase> baseFilter) : FilterExtension(name), baseFilter_(baseFilter) {}
+FilterDecorator::FilterDecorator(const std::string &name, std::shared_ptr<IFilterBase> baseFilter)
+    : FilterExtension(name), baseFilter_(baseFilter), metricsRegistry_(MetricsRegistry::getInstance()) {
+    MetricLabels labels   = { { "filter", name }, { "id", MetricsRegistry::newInstanceId() } };
+    processTimeHistogram_ = metricsRegistry_->getHistogram("ob_filter_process_time_us", "Time taken by the filter to process a frame, in microseconds.", labels);
+}
 
 FilterDecorator::~FilterDecorator() noexcept {
     reset();
@@ -314,7 +326,10 @@ std::shared_ptr<Frame> FilterDecorator::process(std::shared_ptr<const Frame> fra
     checkAndUpdateConfig();
 
     std::unique_lock<std::mutex> lock(processMutex_);
-    return baseFilter_->process(frame);
+    auto                         startTime = utils::getSteadyTimeUs();
+    auto                         rstFrame  = baseFilter_->process(std::move(frame));
+    processTimeHistogram_->add(utils::getSteadyTimeUs() - startTime);
+    return rstFrame;
 }
 
 std::shared_ptr<IFilterBase> FilterDecorator::getBaseFilter() const {
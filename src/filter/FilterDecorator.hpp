@@ -4,6 +4,7 @@
 #pragma once
 #include "IFilter.hpp"
 #include "frame/FrameQueue.hpp"
+#include "metrics/MetricsRegistry.hpp"
 #include "stream/StreamProfile.hpp"
 #include <atomic>
 #include <memory>
@@ -72,6 +73,9 @@ public:
 private:
     std::mutex                   processMutex_;
     std::shared_ptr<IFilterBase> baseFilter_;
+
+    std::shared_ptr<MetricsRegistry>  metricsRegistry_;
+    std::shared_ptr<LatencyHistogram> processTimeHistogram_;
 };
 
 }  // namespace libobsensor
@@ -4,12 +4,24 @@
 #include "PrivFilterCppWrapper.hpp"
 #include "logger/Logger.hpp"
 #include "exception/ObException.hpp"
+#include "frame/FrameFactory.hpp"
 
 namespace libobsensor {
-PrivFilterCppWrapper::PrivFilterCppWrapper(const std::string &filterName, std::shared_ptr<ob_priv_filter_context> filterCtx)
-    : name_(filterName), privFilterCtx_(filterCtx) {
-    ob_error   *error = nullptr;
-    const char *desc  = privFilterCtx_->get_config_schema(privFilterCtx_->filter, &error);
+PrivFilterCppWrapper::PrivFilterCppWrapper(const std::string &filterName, std::shared_ptr<ob_priv_filter_context> filterCtx,
+                                           pfunc_ob_priv_filter_get_capabilities getCapabilities, pfunc_ob_priv_filter_process_into processInto)
+    : name_(filterName), privFilterCtx_(filterCtx), processInto_(processInto), capabilities_(0) {
+    ob_error *error = nullptr;
+    if(getCapabilities && processInto_) {
+        capabilities_ = getCapabilities(privFilterCtx_->filter, &error);
+        if(error) {
+            LOG_WARN("Private filter {} get capabilities failed: {}", name_, error->message);
+            capabilities_ = 0;
+            delete error;
+            error = nullptr;
+        }
+    }
+
+    const char *desc = privFilterCtx_->get_config_schema(privFilterCtx_->filter, &error);
     if(error) {
         LOG_WARN("Private filter {} get config schema failed: {}", name_, error->message);
         delete error;
@@ -67,17 +79,37 @@ void PrivFilterCppWrapper::reset() {
 }
 
 std::shared_ptr<Frame> PrivFilterCppWrapper::process(std::shared_ptr<const Frame> frame) {
-    ob_error              *error   = nullptr;
-    ob_frame              *c_frame = new ob_frame();
-    std::shared_ptr<Frame> resultFrame;
-    c_frame->frame = std::const_pointer_cast<Frame>(frame);
+    // nobody else can see the frame if this is the only reference and the data is its own, so it can be overwritten
+    bool exclusive = frame.use_count() == 1 && !frame->isDataShared();
+
+    ob_frame  inFrame;
+    ob_error *error = nullptr;
+    inFrame.frame   = std::const_pointer_cast<Frame>(frame);
+
+    if(capabilities_ & OB_PRIV_FILTER_CAP_PROCESS_INTO) {
+        ob_frame outFrame;
+        if(exclusive && (capabilities_ & OB_PRIV_FILTER_CAP_IN_PLACE)) {
+            outFrame.frame = inFrame.frame;
+        }
+        else {
+            outFrame.frame = FrameFactory::createFrameFromOtherFrame(frame);
+        }
 
-    auto rst_frame = privFilterCtx_->process(privFilterCtx_->filter, c_frame, &error);
+        bool processed = processInto_(privFilterCtx_->filter, &inFrame, &outFrame, &error);
+        if(error) {
+            THROW_UNRECOVERABLE(std::string(error->message), error->exception_type, error->status);
+        }
+        if(processed) {
+            return outFrame.frame;
+        }
+    }
+
+    std::shared_ptr<Frame> resultFrame;
+    auto                   rst_frame = privFilterCtx_->process(privFilterCtx_->filter, &inFrame, &error);
     if(rst_frame) {
         resultFrame = rst_frame->frame;
         delete rst_frame;
     }
-    delete c_frame;
 
     if(error) {
         // LOG_WARN("Private filter {} process failed: {}", name_, error->message);
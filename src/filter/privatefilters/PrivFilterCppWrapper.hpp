@@ -12,7 +12,8 @@ extern "C" {
 namespace libobsensor {
 class PrivFilterCppWrapper : public IFilterBase {
 public:
-    PrivFilterCppWrapper(const std::string &filterName, std::shared_ptr<ob_priv_filter_context> filterCtx);
+    PrivFilterCppWrapper(const std::string &filterName, std::shared_ptr<ob_priv_filter_context> filterCtx,
+                         pfunc_ob_priv_filter_get_capabilities getCapabilities = nullptr, pfunc_ob_priv_filter_process_into processInto = nullptr);
     virtual ~PrivFilterCppWrapper() noexcept override;
 
     // Config
@@ -29,5 +30,7 @@ private:
     std::string                               name_;
     std::shared_ptr<ob_priv_filter_context_t> privFilterCtx_;
     std::string                               configSchema_;
+    pfunc_ob_priv_filter_process_into         processInto_;
+    uint32_t                                  capabilities_;  // OB_PRIV_FILTER_CAP_*
 };
 }  // namespace libobsensor
@@ -63,7 +63,7 @@ std::shared_ptr<IFilter> PrivFilterCreator::create() {
         }
     });
 
-    auto baseFilter = std::make_shared<PrivFilterCppWrapper>(filterName, privFilterCtxShared);
+    auto baseFilter = std::make_shared<PrivFilterCppWrapper>(filterName, privFilterCtxShared, pkgCtx_->get_capabilities, pkgCtx_->process_into);
     return std::make_shared<FilterDecorator>(filterName, baseFilter);
 }
 
@@ -112,7 +112,7 @@ std::shared_ptr<IFilter> PrivFilterCreator::create(const std::string &activation
             ctx = nullptr;
         }
     });
-    auto baseFilter          = std::make_shared<PrivFilterCppWrapper>(filterName, privFilterCtxShared);
+    auto baseFilter          = std::make_shared<PrivFilterCppWrapper>(filterName, privFilterCtxShared, pkgCtx_->get_capabilities, pkgCtx_->process_into);
     return std::make_shared<FilterDecorator>(filterName, baseFilter);
 }
 
@@ -142,6 +142,11 @@ std::map<std::string, std::shared_ptr<IFilterCreator>> getCreators() {
             pkgCtx_->get_vendor_specific_code = pkgCtx_->dynamic_library->get_function<const char *(ob_error **)>("ob_priv_filter_get_vendor_specific_code");
             pkgCtx_->is_activated             = pkgCtx_->dynamic_library->get_function<bool(ob_error **)>("ob_priv_filter_is_activated");
             pkgCtx_->activate                 = pkgCtx_->dynamic_library->get_function<bool(const char *, ob_error **)>("ob_priv_filter_activate");
+            if(pkgCtx_->dynamic_library->has_symbol("ob_priv_filter_get_capabilities") && pkgCtx_->dynamic_library->has_symbol("ob_priv_filter_process_into")) {
+                pkgCtx_->get_capabilities = pkgCtx_->dynamic_library->get_function<uint32_t(const ob_priv_filter *, ob_error **)>("ob_priv_filter_get_capabilities");
+                pkgCtx_->process_into =
+                    pkgCtx_->dynamic_library->get_function<bool(ob_priv_filter *, const ob_frame *, ob_frame *, ob_error **)>("ob_priv_filter_process_into");
+            }
         }
         catch(const std::exception &e) {
             LOG_DEBUG("Failed to load private filter library {}: {}", dir + packageName, e.what());
@@ -28,6 +28,8 @@ struct PrivFilterPackageContext {
     pfunc_ob_priv_filter_get_vendor_specific_code get_vendor_specific_code;
     pfunc_ob_priv_filter_is_activated             is_activated;
     pfunc_ob_priv_filter_activate                 activate;
+    pfunc_ob_priv_filter_get_capabilities         get_capabilities = nullptr;  // optional, with process_into
+    pfunc_ob_priv_filter_process_into             process_into     = nullptr;
 };
 
 class PrivFilterCreator : public IPrivFilterCreator {
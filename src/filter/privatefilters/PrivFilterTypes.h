@@ -73,6 +73,40 @@ typedef void (*pfunc_ob_priv_filter_reset)(ob_priv_filter *filter, ob_error **er
  */
 typedef ob_frame *(*pfunc_ob_priv_filter_process)(ob_priv_filter *filter, const ob_frame *frame, ob_error **error);
 
+/**
+ * @brief Capability flags returned by @ref pfunc_ob_priv_filter_get_capabilities
+ */
+#define OB_PRIV_FILTER_CAP_PROCESS_INTO 0x01  // the filter supports @ref pfunc_ob_priv_filter_process_into
+#define OB_PRIV_FILTER_CAP_IN_PLACE     0x02  // the output frame of @ref pfunc_ob_priv_filter_process_into can be the input frame
+
+/**
+ * @brief Function pointer type for the get capabilities function of the filter package
+ * @brief Optional, exported as "ob_priv_filter_get_capabilities" together with "ob_priv_filter_process_into". The packages without these symbols
+ * only use @ref pfunc_ob_priv_filter_process.
+ *
+ * @param[in] filter The filter object to get the capabilities for
+ * @param[out] error Pointer to an error object that will be set if an error occurs
+ *
+ * @return The OB_PRIV_FILTER_CAP_* flags supported by the filter
+ */
+typedef uint32_t (*pfunc_ob_priv_filter_get_capabilities)(const ob_priv_filter *filter, ob_error **error);
+
+/**
+ * @brief Function pointer type for the process into function of the filter package
+ * @brief Process a frame into an output frame provided by the caller instead of creating a new one. The output frame is acquired from the frame
+ * memory pool with the stream profile and info of the input frame, or is the input frame itself if the filter has OB_PRIV_FILTER_CAP_IN_PLACE and
+ * the caller holds the only reference to it.
+ *
+ * @param[in] filter The filter object to process the frame with
+ * @param[in] frame The frame to process
+ * @param[out] out_frame The frame to write the result to
+ * @param[out] error Pointer to an error object that will be set if an error occurs
+ *
+ * @return true if the result has been written to out_frame. false if the frame needs another kind of output frame, the frames must then be left
+ * untouched and the caller falls back to @ref pfunc_ob_priv_filter_process.
+ */
+typedef bool (*pfunc_ob_priv_filter_process_into)(ob_priv_filter *filter, const ob_frame *frame, ob_frame *out_frame, ob_error **error);
+
 /**
  * @brief Function pointer type for the destroy function of the filter context object
  *
@@ -8,199 +8,314 @@
 #include "libobsensor/h/ObTypes.h"
 #include "utils/Utils.hpp"
 
+#include <algorithm>
+
+#if defined(__ARM_NEON__) || defined(__NEON__) || defined(__SSSE3__)
+#if(defined(__ARM_NEON__) || defined(__aarch64__) || defined(__arm__))
+#include "SSE2NEON.h"
+#else
+#include <tmmintrin.h>
+#endif
+#define DECIMATION_SIMD
+#endif
+
 namespace libobsensor {
 
-#define SWAP(a, b)            \
-    {                         \
-        uint16_t temp = (a);  \
-        (a)           = (b);  \
-        (b)           = temp; \
-    }
+namespace {
 
-inline uint16_t median1(uint16_t arr[]) {
+// The median networks below are written once for the scalar values and for the SIMD vectors of 8 values, so both give the same results.
+// They only pick the true median for some counts; the results of the networks are kept as they are.
+inline uint16_t minValue(uint16_t a, uint16_t b) {
+    return a < b ? a : b;
+}
+
+inline uint16_t maxValue(uint16_t a, uint16_t b) {
+    return a < b ? b : a;
+}
+
+#ifdef DECIMATION_SIMD
+// 8 values of 16 bits with the sign bits flipped, so the signed comparisons order them as unsigned values
+struct BiasedVector {
+    __m128i value;
+};
+
+inline BiasedVector minValue(BiasedVector a, BiasedVector b) {
+    return { _mm_min_epi16(a.value, b.value) };
+}
+
+inline BiasedVector maxValue(BiasedVector a, BiasedVector b) {
+    return { _mm_max_epi16(a.value, b.value) };
+}
+#endif
+
+template <typename T> inline void sortPair(T &a, T &b) {
+    T low = minValue(a, b);
+    b     = maxValue(a, b);
+    a     = low;
+}
+
+template <typename T> inline T median1(T arr[]) {
     return arr[0];
 }
 
-inline uint16_t median2(uint16_t arr[]) {
-    if(arr[0] > arr[1])
-        SWAP(arr[0], arr[1]);
+template <typename T> inline T median2(T arr[]) {
+    sortPair(arr[0], arr[1]);
     return arr[0];
 }
 
-inline uint16_t median3(uint16_t arr[]) {
-    if(arr[0] > arr[1])
-        SWAP(arr[0], arr[1]);
-    if(arr[1] > arr[2])
-        SWAP(arr[1], arr[2]);
-    if(arr[0] > arr[1])
-        SWAP(arr[0], arr[1]);
+template <typename T> inline T median3(T arr[]) {
+    sortPair(arr[0], arr[1]);
+    sortPair(arr[1], arr[2]);
+    sortPair(arr[0], arr[1]);
     return arr[1];
 }
 
-inline uint16_t median4(uint16_t arr[]) {
-    if(arr[0] > arr[1])
-        SWAP(arr[0], arr[1]);
-    if(arr[2] > arr[3])
-        SWAP(arr[2], arr[3]);
-    if(arr[0] > arr[2])
-        SWAP(arr[0], arr[2]);
-    if(arr[1] > arr[3])
-        SWAP(arr[1], arr[3]);
-    if(arr[1] > arr[2])
-        SWAP(arr[1], arr[2]);
+template <typename T> inline T median4(T arr[]) {
+    sortPair(arr[0], arr[1]);
+    sortPair(arr[2], arr[3]);
+    sortPair(arr[0], arr[2]);
+    sortPair(arr[1], arr[3]);
+    sortPair(arr[1], arr[2]);
     return arr[1];
 }
 
-inline uint16_t median5(uint16_t arr[]) {
-    if(arr[0] > arr[1])
-        SWAP(arr[0], arr[1]);
-    if(arr[3] > arr[4])
-        SWAP(arr[3], arr[4]);
-    if(arr[0] > arr[2])
-        SWAP(arr[0], arr[2]);
-    if(arr[1] > arr[2])
-        SWAP(arr[1], arr[2]);
-    if(arr[3] > arr[2])
-        SWAP(arr[3], arr[2]);
-    if(arr[4] > arr[2])
-        SWAP(arr[4], arr[2]);
-    if(arr[1] > arr[3])
-        SWAP(arr[1], arr[3]);
+template <typename T> inline T median5(T arr[]) {
+    sortPair(arr[0], arr[1]);
+    sortPair(arr[3], arr[4]);
+    sortPair(arr[0], arr[2]);
+    sortPair(arr[1], arr[2]);
+    sortPair(arr[3], arr[2]);
+    sortPair(arr[4], arr[2]);
+    sortPair(arr[1], arr[3]);
     return arr[2];
 }
 
-inline uint16_t median6(uint16_t arr[]) {
-    if(arr[0] > arr[1])
-        SWAP(arr[0], arr[1]);
-    if(arr[2] > arr[3])
-        SWAP(arr[2], arr[3]);
-    if(arr[4] > arr[5])
-        SWAP(arr[4], arr[5]);
-    if(arr[0] > arr[2])
-        SWAP(arr[0], arr[2]);
-    if(arr[1] > arr[3])
-        SWAP(arr[1], arr[3]);
-    if(arr[2] > arr[4])
-        SWAP(arr[2], arr[4]);
-    if(arr[3] > arr[5])
-        SWAP(arr[3], arr[5]);
-    if(arr[1] > arr[4])
-        SWAP(arr[1], arr[4]);
-    if(arr[3] > arr[4])
-        SWAP(arr[3], arr[4]);
+template <typename T> inline T median6(T arr[]) {
+    sortPair(arr[0], arr[1]);
+    sortPair(arr[2], arr[3]);
+    sortPair(arr[4], arr[5]);
+    sortPair(arr[0], arr[2]);
+    sortPair(arr[1], arr[3]);
+    sortPair(arr[2], arr[4]);
+    sortPair(arr[3], arr[5]);
+    sortPair(arr[1], arr[4]);
+    sortPair(arr[3], arr[4]);
     return arr[2];
 }
 
-inline uint16_t median7(uint16_t arr[]) {
-    if(arr[0] > arr[5])
-        SWAP(arr[0], arr[5]);
-    if(arr[0] > arr[3])
-        SWAP(arr[0], arr[3]);
-    if(arr[1] > arr[6])
-        SWAP(arr[1], arr[6]);
-    if(arr[2] > arr[4])
-        SWAP(arr[2], arr[4]);
-    if(arr[0] > arr[1])
-        SWAP(arr[0], arr[1]);
-    if(arr[3] > arr[5])
-        SWAP(arr[3], arr[5]);
-    if(arr[2] > arr[6])
-        SWAP(arr[2], arr[6]);
-    if(arr[2] > arr[3])
-        SWAP(arr[2], arr[3]);
-    if(arr[3] > arr[6])
-        SWAP(arr[3], arr[6]);
-    if(arr[4] > arr[5])
-        SWAP(arr[4], arr[5]);
-    if(arr[1] > arr[5])
-        SWAP(arr[1], arr[5]);
-    if(arr[1] > arr[3])
-        SWAP(arr[1], arr[3]);
-    if(arr[3] > arr[4])
-        SWAP(arr[3], arr[4]);
+template <typename T> inline T median7(T arr[]) {
+    sortPair(arr[0], arr[5]);
+    sortPair(arr[0], arr[3]);
+    sortPair(arr[1], arr[6]);
+    sortPair(arr[2], arr[4]);
+    sortPair(arr[0], arr[1]);
+    sortPair(arr[3], arr[5]);
+    sortPair(arr[2], arr[6]);
+    sortPair(arr[2], arr[3]);
+    sortPair(arr[3], arr[6]);
+    sortPair(arr[4], arr[5]);
+    sortPair(arr[1], arr[5]);
+    sortPair(arr[1], arr[3]);
+    sortPair(arr[3], arr[4]);
     return arr[3];
 }
 
-inline uint16_t median8(uint16_t arr[]) {
-    if(arr[0] > arr[1])
-        SWAP(arr[0], arr[1]);
-    if(arr[2] > arr[3])
-        SWAP(arr[2], arr[3]);
-    if(arr[4] > arr[5])
-        SWAP(arr[4], arr[5]);
-    if(arr[6] > arr[7])
-        SWAP(arr[6], arr[7]);
-    if(arr[0] > arr[2])
-        SWAP(arr[0], arr[2]);
-    if(arr[1] > arr[3])
-        SWAP(arr[1], arr[3]);
-    if(arr[4] > arr[6])
-        SWAP(arr[4], arr[6]);
-    if(arr[5] > arr[7])
-        SWAP(arr[5], arr[7]);
-    if(arr[1] > arr[4])
-        SWAP(arr[1], arr[4]);
-    if(arr[3] > arr[6])
-        SWAP(arr[3], arr[6]);
-    if(arr[2] > arr[5])
-        SWAP(arr[2], arr[5]);
-    if(arr[3] > arr[4])
-        SWAP(arr[3], arr[4]);
-    if(arr[2] > arr[6])
-        SWAP(arr[2], arr[6]);
-    if(arr[1] > arr[3])
-        SWAP(arr[1], arr[3]);
-    if(arr[5] > arr[7])
-        SWAP(arr[5], arr[7]);
-    if(arr[3] > arr[5])
-        SWAP(arr[3], arr[5]);
-    if(arr[4] > arr[6])
-        SWAP(arr[4], arr[6]);
+template <typename T> inline T median8(T arr[]) {
+    sortPair(arr[0], arr[1]);
+    sortPair(arr[2], arr[3]);
+    sortPair(arr[4], arr[5]);
+    sortPair(arr[6], arr[7]);
+    sortPair(arr[0], arr[2]);
+    sortPair(arr[1], arr[3]);
+    sortPair(arr[4], arr[6]);
+    sortPair(arr[5], arr[7]);
+    sortPair(arr[1], arr[4]);
+    sortPair(arr[3], arr[6]);
+    sortPair(arr[2], arr[5]);
+    sortPair(arr[3], arr[4]);
+    sortPair(arr[2], arr[6]);
+    sortPair(arr[1], arr[3]);
+    sortPair(arr[5], arr[7]);
+    sortPair(arr[3], arr[5]);
+    sortPair(arr[4], arr[6]);
     return arr[3];
 }
 
-inline uint16_t median9(uint16_t arr[]) {
-    if(arr[0] > arr[1])
-        SWAP(arr[0], arr[1]);
-    if(arr[3] > arr[4])
-        SWAP(arr[3], arr[4]);
-    if(arr[6] > arr[7])
-        SWAP(arr[6], arr[7]);
-    if(arr[1] > arr[2])
-        SWAP(arr[1], arr[2]);
-    if(arr[4] > arr[5])
-        SWAP(arr[4], arr[5]);
-    if(arr[7] > arr[8])
-        SWAP(arr[7], arr[8]);
-    if(arr[0] > arr[1])
-        SWAP(arr[0], arr[1]);
-    if(arr[3] > arr[4])
-        SWAP(arr[3], arr[4]);
-    if(arr[6] > arr[7])
-        SWAP(arr[6], arr[7]);
-    if(arr[1] > arr[2])
-        SWAP(arr[1], arr[2]);
-    if(arr[4] > arr[5])
-        SWAP(arr[4], arr[5]);
-    if(arr[7] > arr[8])
-        SWAP(arr[7], arr[8]);
-    arr[3] = arr[0] > arr[3] ? arr[0] : arr[3];
-    arr[5] = arr[5] > arr[8] ? arr[8] : arr[5];
-    if(arr[4] > arr[7])
-        SWAP(arr[4], arr[7]);
-    arr[6] = arr[3] > arr[6] ? arr[3] : arr[6];
-    arr[4] = arr[1] > arr[4] ? arr[1] : arr[4];
-    arr[2] = arr[2] > arr[5] ? arr[5] : arr[2];
-    arr[4] = arr[4] > arr[7] ? arr[7] : arr[4];
-    if(arr[4] > arr[2])
-        SWAP(arr[4], arr[2]);
-    arr[4] = arr[4] > arr[6] ? arr[6] : arr[4];
+template <typename T> inline T median9(T arr[]) {
+    sortPair(arr[0], arr[1]);
+    sortPair(arr[3], arr[4]);
+    sortPair(arr[6], arr[7]);
+    sortPair(arr[1], arr[2]);
+    sortPair(arr[4], arr[5]);
+    sortPair(arr[7], arr[8]);
+    sortPair(arr[0], arr[1]);
+    sortPair(arr[3], arr[4]);
+    sortPair(arr[6], arr[7]);
+    sortPair(arr[1], arr[2]);
+    sortPair(arr[4], arr[5]);
+    sortPair(arr[7], arr[8]);
+    arr[3] = maxValue(arr[0], arr[3]);
+    arr[5] = minValue(arr[5], arr[8]);
+    sortPair(arr[4], arr[7]);
+    arr[6] = maxValue(arr[3], arr[6]);
+    arr[4] = maxValue(arr[1], arr[4]);
+    arr[2] = minValue(arr[2], arr[5]);
+    arr[4] = minValue(arr[4], arr[7]);
+    sortPair(arr[4], arr[2]);
+    arr[4] = minValue(arr[4], arr[6]);
     return arr[4];
 }
 
 typedef uint16_t (*MDFUNC)(uint16_t arr[]);
 // 0     1       2        3        4         5        6        7       8       9
-static MDFUNC _mdfunc[] = { 0, median1, median2, median3, median4, median5, median6, median7, median8, median9 };
+static MDFUNC _mdfunc[] = { 0,                 median1<uint16_t>, median2<uint16_t>, median3<uint16_t>, median4<uint16_t>,
+                            median5<uint16_t>, median6<uint16_t>, median7<uint16_t>, median8<uint16_t>, median9<uint16_t> };
+
+// below this number of output pixels per band the frame is decimated on the calling thread only
+const uint32_t MIN_PIXELS_PER_BAND = 16384;
+
+// median of the non-zero pixels of the scale x scale patch, in the row order, scale 2 or 3
+inline uint16_t medianPatch(const uint16_t *patch, size_t widthIn, uint32_t scale) {
+    uint16_t workingKernel[9];
+    int      count = 0;
+    for(uint32_t n = 0; n < scale; n++) {
+        for(uint32_t m = 0; m < scale; m++) {
+            auto value           = patch[n * widthIn + m];
+            workingKernel[count] = value;
+            count += value != 0;
+        }
+    }
+    return count == 0 ? 0 : _mdfunc[count](workingKernel);
+}
+
+#ifdef DECIMATION_SIMD
+template <int N> inline BiasedVector applyMedian(const BiasedVector *values, BiasedVector (*median)(BiasedVector *)) {
+    BiasedVector arr[N];
+    for(int k = 0; k < N; k++) {
+        arr[k] = values[k];
+    }
+    return median(arr);
+}
+
+// Medians of 8 output pixels at a time: the non-zero values of every patch are moved to the front in their order, then every median network
+// is applied to all the patches and each pixel takes the result of the network of its count of non-zero values. Returns the number of output
+// pixels done.
+uint32_t medianRowSimd(const uint16_t *block, size_t widthIn, uint32_t scale, uint16_t *dst, uint32_t realWidth) {
+    const uint32_t kernelSize = scale * scale;
+    const __m128i  zero       = _mm_setzero_si128();
+    const __m128i  sign       = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+    uint32_t       i          = 0;
+    for(; i + 8 <= realWidth; i += 8) {
+        // values[k] holds the value k of the patch of every pixel
+        alignas(16) uint16_t patches[9][8];
+        for(uint32_t n = 0; n < scale; n++) {
+            const uint16_t *row = block + n * widthIn + static_cast<size_t>(i) * scale;
+            for(uint32_t l = 0; l < 8; l++) {
+                for(uint32_t m = 0; m < scale; m++) {
+                    patches[n * scale + m][l] = row[l * scale + m];
+                }
+            }
+        }
+
+        __m128i values[9];
+        __m128i zeros = zero;  // count of zero values, negated
+        for(uint32_t k = 0; k < kernelSize; k++) {
+            values[k] = _mm_load_si128(reinterpret_cast<const __m128i *>(patches[k]));
+            zeros     = _mm_add_epi16(zeros, _mm_cmpeq_epi16(values[k], zero));
+        }
+        auto count = _mm_add_epi16(_mm_set1_epi16(static_cast<int16_t>(kernelSize)), zeros);
+
+        // stable bubble of the zero values to the back
+        for(uint32_t pass = 0; pass + 1 < kernelSize; pass++) {
+            for(uint32_t k = 0; k + 1 + pass < kernelSize; k++) {
+                auto isZero   = _mm_cmpeq_epi16(values[k], zero);
+                values[k]     = _mm_or_si128(_mm_and_si128(isZero, values[k + 1]), _mm_andnot_si128(isZero, values[k]));
+                values[k + 1] = _mm_andnot_si128(isZero, values[k + 1]);
+            }
+        }
+
+        BiasedVector biased[9];
+        for(uint32_t k = 0; k < kernelSize; k++) {
+            biased[k].value = _mm_xor_si128(values[k], sign);
+        }
+        BiasedVector medians[10];
+        medians[1] = applyMedian<1>(biased, median1<BiasedVector>);
+        medians[2] = applyMedian<2>(biased, median2<BiasedVector>);
+        medians[3] = applyMedian<3>(biased, median3<BiasedVector>);
+        medians[4] = applyMedian<4>(biased, median4<BiasedVector>);
+        if(kernelSize == 9) {
+            medians[5] = applyMedian<5>(biased, median5<BiasedVector>);
+            medians[6] = applyMedian<6>(biased, median6<BiasedVector>);
+            medians[7] = applyMedian<7>(biased, median7<BiasedVector>);
+            medians[8] = applyMedian<8>(biased, median8<BiasedVector>);
+            medians[9] = applyMedian<9>(biased, median9<BiasedVector>);
+        }
+
+        auto result = zero;
+        for(uint32_t k = 1; k <= kernelSize; k++) {
+            auto selected = _mm_cmpeq_epi16(count, _mm_set1_epi16(static_cast<int16_t>(k)));
+            result        = _mm_or_si128(result, _mm_and_si128(selected, _mm_xor_si128(medians[k].value, sign)));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), result);
+    }
+    return i;
+}
+#endif
+
+// The median (scale 2, 3) or the mean (scale 4 and above) of the non-zero pixels of every patch, for the output rows [rowBegin, rowEnd).
+void decimateDepthRows(const uint16_t *in, uint16_t *out, size_t widthIn, uint32_t scale, uint32_t realWidth, uint32_t paddedWidth, uint32_t rowBegin,
+                       uint32_t rowEnd) {
+    std::vector<uint32_t> columnSums;
+    std::vector<uint8_t>  columnCounts;
+    if(scale > 3) {
+        columnSums.resize(realWidth * scale);
+        columnCounts.resize(realWidth * scale);
+    }
+
+    for(uint32_t j = rowBegin; j < rowEnd; j++) {
+        const uint16_t *block = in + static_cast<size_t>(j) * scale * widthIn;
+        uint16_t       *dst   = out + static_cast<size_t>(j) * paddedWidth;
+        if(scale == 2 || scale == 3) {
+            uint32_t i = 0;
+#ifdef DECIMATION_SIMD
+            i = medianRowSimd(block, widthIn, scale, dst, realWidth);
+#endif
+            for(; i < realWidth; i++) {
+                dst[i] = medianPatch(block + static_cast<size_t>(i) * scale, widthIn, scale);
+            }
+        }
+        else if(scale == 1) {
+            memcpy(dst, block, realWidth * sizeof(uint16_t));
+        }
+        else {
+            // the sums and counts of the columns first, contiguous so they vectorize, then of the patches
+            const uint32_t columns = realWidth * scale;
+            std::fill(columnSums.begin(), columnSums.end(), 0);
+            std::fill(columnCounts.begin(), columnCounts.end(), static_cast<uint8_t>(0));
+            for(uint32_t n = 0; n < scale; n++) {
+                const uint16_t *row = block + n * widthIn;
+                for(uint32_t x = 0; x < columns; x++) {
+                    columnSums[x] += row[x];
+                    columnCounts[x] += row[x] != 0;
+                }
+            }
+            for(uint32_t i = 0; i < realWidth; i++) {
+                uint32_t sum   = 0;
+                uint32_t count = 0;
+                for(uint32_t m = 0; m < scale; m++) {
+                    sum += columnSums[i * scale + m];
+                    count += columnCounts[i * scale + m];
+                }
+                dst[i] = static_cast<uint16_t>(count == 0 ? 0 : sum / count);
+            }
+        }
+
+        // filling right side blanks
+        std::fill(dst + realWidth, dst + paddedWidth, static_cast<uint16_t>(0));
+    }
+}
+
+}  // namespace
 
 DecimationFilter::DecimationFilter()
     : decimation_factor_(2),
@@ -212,7 +327,8 @@ DecimationFilter::DecimationFilter()
       padded_width_(0),
       padded_height_(0),
       recalc_profile_(false),
-      options_changed_(false) {}
+      options_changed_(false),
+      workerPool_(WorkerPool::getInstance()) {}
 
 DecimationFilter::~DecimationFilter() noexcept {}
 
@@ -262,13 +378,13 @@ std::shared_ptr<Frame> DecimationFilter::process(std::shared_ptr<const Frame> fr
 
     if(frame->is<FrameSet>()) {
         LOG_WARN_INTVL("The Frame processed by DecimationFilter cannot be FrameSet!");
-        auto outFrame = FrameFactory::createFrameFromOtherFrame(frame, true);
+        auto outFrame = FrameFactory::createFrameView(frame);
         return outFrame;
     }
 
     if(!isFrameFormatTypeSupported(frame->getFormat())) {
         LOG_WARN_INTVL("Unsupported decimation filter processing frame format @{}.", frame->getFormat());
-        auto outFrame = FrameFactory::createFrameFromOtherFrame(frame, true);
+        auto outFrame = FrameFactory::createFrameView(frame);
         return outFrame;
     }
 
@@ -281,7 +397,8 @@ std::shared_ptr<Frame> DecimationFilter::process(std::shared_ptr<const Frame> fr
     auto srcVideosFrame = frame->as<VideoFrame>();
     auto newVideoFrame  = newOutFrame->as<VideoFrame>();
     if(frame->getType() == OB_FRAME_DEPTH && (frameFormat == OB_FORMAT_Y16 || frameFormat == OB_FORMAT_Z16 || frameFormat == OB_FORMAT_Y12C4)) {
-        decimateDepth((uint16_t *)frame->getData(), (uint16_t *)newVideoFrame->getData(), srcVideosFrame->getWidth(), patch_size_);
+        decimateDepth(reinterpret_cast<const uint16_t *>(frame->getData()), reinterpret_cast<uint16_t *>(newVideoFrame->getDataMutable()),
+                      srcVideosFrame->getWidth(), patch_size_);
     }
     else {
         decimateOthers(frameFormat, (void *)frame->getData(), (void *)newVideoFrame->getData(), srcVideosFrame->getWidth(), patch_size_);
@@ -370,87 +487,21 @@ void DecimationFilter::updateOutputProfile(const std::shared_ptr<const Frame> fr
     }
 }
 
-void DecimationFilter::decimateDepth(uint16_t *frame_data_in, uint16_t *frame_data_out, size_t width_in, size_t scale) {
-
-    // construct internal register buf
-    uint16_t  working_kernel[9];
-    uint16_t *pixel_raws[10];  // max scale set 10
-    uint16_t *block_start = const_cast<uint16_t *>(frame_data_in);
-    uint16_t *p{};
-    int       wk_count = 0;
-    int       wk_sum   = 0;
-    MDFUNC    f;
-
-    if(scale == 2 || scale == 3) {
-        // loop through rows
-        for(int j = 0; j < real_height_; j++) {
-
-            for(size_t i = 0; i < scale; i++) {
-                pixel_raws[i] = block_start + (width_in * i);
-                //__builtin_prefetch(pixel_raws[i] + (width_in * scale), 0, 3);
-            }
-
-            // processing row-wisely
-            for(size_t i = 0, chunk_offset = 0; i < real_width_; i++, chunk_offset += scale) {
-                wk_count = 0;
-                // processing kernel
-                for(size_t n = 0; n < scale; ++n) {
-                    p = pixel_raws[n] + chunk_offset;
-                    for(size_t m = 0; m < scale; ++m) {
-                        if(*(p + m)) {
-                            working_kernel[wk_count] = *(p + m);
-                            wk_count++;
-                        }
-                    }
-                }
-
-                if(wk_count == 0)
-                    *frame_data_out++ = 0;
-                else {
-                    f                 = _mdfunc[wk_count];
-                    *frame_data_out++ = f(working_kernel);
-                }
-            }
-
-            // filling right side blanks
-            for(int k = real_width_; k < padded_width_; k++)
-                *frame_data_out++ = 0;
-
-            // move to the start position of next processing block
-            block_start += width_in * scale;
-        }
-    }
-    else {
-
-        for(int j = 0; j < real_height_; j++) {
-
-            for(size_t i = 0; i < scale; i++) {
-                pixel_raws[i] = block_start + (width_in * i);
-            }
-
-            for(size_t i = 0, chunk_offset = 0; i < real_width_; i++, chunk_offset += scale) {
-                wk_sum   = 0;
-                wk_count = 0;
-                for(size_t n = 0; n < scale; ++n) {
-                    p = pixel_raws[n] + chunk_offset;
-                    for(size_t m = 0; m < scale; ++m) {
-                        if(*(p + m)) {
-                            wk_sum += p[m];
-                            ++wk_count;
-                        }
-                    }
-                }
-
-                *frame_data_out++ = (uint16_t)(wk_count == 0 ? 0 : wk_sum / wk_count);
-            }
-
-            for(int k = real_width_; k < padded_width_; k++)
-                *frame_data_out++ = 0;
-
-            block_start += width_in * scale;
-        }
-    }
-    memset(frame_data_out, 0, (padded_height_ - real_height_) * padded_width_ * sizeof(uint16_t));
+void DecimationFilter::decimateDepth(const uint16_t *frame_data_in, uint16_t *frame_data_out, size_t width_in, size_t scale) {
+    // the output rows are split into bands decimated in parallel
+    uint32_t rows        = real_height_;
+    uint32_t realWidth   = real_width_;
+    uint32_t paddedWidth = padded_width_;
+    uint32_t patchSize   = static_cast<uint32_t>(scale);
+    uint32_t bands       = std::max(1u, std::min(workerPool_->getConcurrency(), rows * realWidth / MIN_PIXELS_PER_BAND));
+    uint32_t rowsPerBand = (rows + bands - 1) / bands;
+
+    workerPool_->parallelFor(bands, [&](uint32_t band) {
+        auto bandBegin = std::min(rows, band * rowsPerBand);
+        auto bandEnd   = std::min(rows, bandBegin + rowsPerBand);
+        decimateDepthRows(frame_data_in, frame_data_out, width_in, patchSize, realWidth, paddedWidth, bandBegin, bandEnd);
+    });
+    memset(frame_data_out + static_cast<size_t>(real_height_) * padded_width_, 0, (padded_height_ - real_height_) * padded_width_ * sizeof(uint16_t));
 }
 
 void DecimationFilter::decimateOthers(OBFormat format, void *frame_data_in, void *frame_data_out, size_t width_in, size_t scale) {
@@ -4,6 +4,7 @@
 #pragma once
 #include "IFilter.hpp"
 #include "stream/StreamProfile.hpp"
+#include "utils/WorkerPool.hpp"
 #include <mutex>
 #include <map>
 #include <tuple>
@@ -25,7 +26,7 @@ private:
 
     bool isFrameFormatTypeSupported(OBFormat type);
     void updateOutputProfile(const std::shared_ptr<const Frame> frame);
-    void decimateDepth(uint16_t *frame_data_in, uint16_t *frame_data_out, size_t width_in, size_t scale);
+    void decimateDepth(const uint16_t *frame_data_in, uint16_t *frame_data_out, size_t width_in, size_t scale);
     void decimateOthers(OBFormat format, void *frame_data_in, void *frame_data_out, size_t width_in, size_t scale);
 
 protected:
@@ -44,6 +45,8 @@ protected:
     uint16_t padded_height_;
     bool     recalc_profile_;
     bool     options_changed_;  // Tracking changes imposed by user
+
+    std::shared_ptr<WorkerPool> workerPool_;  // decimates the row bands of a depth frame in parallel
 };
 
 }  // namespace libobsensor
@@ -0,0 +1,496 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#include "DepthTransformProcess.hpp"
+#include "exception/ObException.hpp"
+#include "logger/LoggerInterval.hpp"
+#include "frame/FrameFactory.hpp"
+#include "utils/CameraParamProcess.hpp"
+#include "utils/Utils.hpp"
+
+#include <algorithm>
+
+#if defined(__ARM_NEON__) || defined(__NEON__) || defined(__SSSE3__)
+#if(defined(__ARM_NEON__) || defined(__aarch64__) || defined(__arm__))
+#include "SSE2NEON.h"
+#else
+#include <tmmintrin.h>
+#endif
+#define DEPTH_TRANSFORM_SIMD
+#endif
+
+namespace libobsensor {
+
+namespace {
+
+// the per pixel operations, in the order they apply
+struct ValueOps {
+    bool     threshold;  // zero the values out of [min, max]
+    uint32_t min;
+    uint32_t max;
+    bool     scale;
+    float    scaleValue;
+    int8_t   offset;  // right shift when positive, left shift when negative
+};
+
+template <typename T> inline T transformValue(T value, const ValueOps &ops) {
+    uint32_t result = value;
+    if(ops.threshold && (result < ops.min || result > ops.max)) {
+        result = 0;
+    }
+    if(ops.scale) {
+        // truncated and wrapped to the pixel size, as (T)(value * scale) in PixelValueScaler
+        result = static_cast<T>(static_cast<int32_t>(static_cast<float>(result) * ops.scaleValue));
+    }
+    if(ops.offset > 0) {
+        result >>= ops.offset;
+    }
+    else if(ops.offset < 0) {
+        result <<= -ops.offset;
+    }
+    return static_cast<T>(result);
+}
+
+// Walk of the source image in the order of the output pixels: the output pixel (x, y) is the source pixel base + x * colStep + y * rowStep.
+struct PixelWalk {
+    int64_t  base;
+    int64_t  colStep;
+    int64_t  rowStep;
+    uint32_t outWidth;
+    uint32_t outHeight;
+};
+
+// mirror and flip first, then rotate clockwise
+PixelWalk makePixelWalk(uint32_t width, uint32_t height, bool mirror, bool flip, uint32_t rotateDegree) {
+    int64_t w         = width;
+    int64_t h         = height;
+    auto    srcOffset = [&](int64_t outX, int64_t outY) {
+        int64_t x = outX;
+        int64_t y = outY;
+        if(rotateDegree == 90) {
+            x = outY;
+            y = h - 1 - outX;
+        }
+        else if(rotateDegree == 180) {
+            x = w - 1 - outX;
+            y = h - 1 - outY;
+        }
+        else if(rotateDegree == 270) {
+            x = w - 1 - outY;
+            y = outX;
+        }
+        x = mirror ? w - 1 - x : x;
+        y = flip ? h - 1 - y : y;
+        return y * w + x;
+    };
+
+    PixelWalk walk;
+    bool      transposed = rotateDegree == 90 || rotateDegree == 270;
+    walk.base            = srcOffset(0, 0);
+    walk.colStep         = srcOffset(1, 0) - walk.base;
+    walk.rowStep         = srcOffset(0, 1) - walk.base;
+    walk.outWidth        = transposed ? height : width;
+    walk.outHeight       = transposed ? width : height;
+    return walk;
+}
+
+template <typename T> void transformRow(const T *src, int64_t step, T *dst, uint32_t count, const ValueOps &ops) {
+    for(uint32_t i = 0; i < count; i++) {
+        dst[i] = transformValue(*src, ops);
+        src += step;
+    }
+}
+
+template <typename T> void transformTile(const T *src, const PixelWalk &walk, T *dst, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1, const ValueOps &ops) {
+    for(uint32_t y = y0; y < y1; y++) {
+        transformRow(src + walk.base + x0 * walk.colStep + y * walk.rowStep, walk.colStep, dst + static_cast<size_t>(y) * walk.outWidth + x0, x1 - x0, ops);
+    }
+}
+
+#ifdef DEPTH_TRANSFORM_SIMD
+class SimdValueOps {
+public:
+    explicit SimdValueOps(const ValueOps &ops)
+        : ops_(ops),
+          sign_(_mm_set1_epi16(static_cast<int16_t>(0x8000))),
+          min_(_mm_set1_epi16(static_cast<int16_t>(std::min<uint32_t>(ops.min, 0xFFFF) ^ 0x8000))),
+          max_(_mm_set1_epi16(static_cast<int16_t>(std::min<uint32_t>(ops.max, 0xFFFF) ^ 0x8000))),
+          scale_(_mm_set1_ps(ops.scaleValue)),
+          shift_(_mm_cvtsi32_si128(ops.offset > 0 ? ops.offset : -ops.offset)) {}
+
+    // 8 values of 16 bits
+    inline __m128i apply(__m128i value) const {
+        if(ops_.threshold) {
+            // the unsigned comparison is a signed one with the sign bits flipped
+            auto biased  = _mm_xor_si128(value, sign_);
+            auto outside = _mm_or_si128(_mm_cmplt_epi16(biased, min_), _mm_cmpgt_epi16(biased, max_));
+            value        = _mm_andnot_si128(outside, value);
+        }
+        if(ops_.scale) {
+            auto zero = _mm_setzero_si128();
+            auto lo   = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(value, zero)), scale_));
+            auto hi   = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(value, zero)), scale_));
+            // keep the low 16 bits like the scalar path: sign extended, the signed saturation of the pack leaves them unchanged
+            lo    = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+            hi    = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+            value = _mm_packs_epi32(lo, hi);
+        }
+        if(ops_.offset > 0) {
+            value = _mm_srl_epi16(value, shift_);
+        }
+        else if(ops_.offset < 0) {
+            value = _mm_sll_epi16(value, shift_);
+        }
+        return value;
+    }
+
+private:
+    ValueOps ops_;
+    __m128i  sign_;
+    __m128i  min_;
+    __m128i  max_;
+    __m128   scale_;
+    __m128i  shift_;
+};
+
+inline __m128i reverse8x16(__m128i value) {
+    const __m128i reverse = _mm_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+    return _mm_shuffle_epi8(value, reverse);
+}
+
+// 8 source pixels from src, forward (step 1) or backward (step -1)
+inline __m128i load8x16(const uint16_t *src, int64_t step) {
+    if(step > 0) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    }
+    return reverse8x16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src - 7)));
+}
+
+void transformRowSimd(const uint16_t *src, int64_t step, uint16_t *dst, uint32_t count, const SimdValueOps &simdOps, const ValueOps &ops) {
+    uint32_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), simdOps.apply(load8x16(src, step)));
+        src += 8 * step;
+    }
+    transformRow(src, step, dst + i, count - i, ops);
+}
+
+// the output tile of 8x8 pixels at (x, y) of a rotated walk: every output column is 8 contiguous source pixels, transposed in registers
+void transformTileSimd(const uint16_t *src, const PixelWalk &walk, uint16_t *dst, uint32_t x, uint32_t y, const SimdValueOps &simdOps) {
+    __m128i col[8];
+    for(uint32_t k = 0; k < 8; k++) {
+        col[k] = simdOps.apply(load8x16(src + walk.base + (x + k) * walk.colStep + y * walk.rowStep, walk.rowStep));
+    }
+
+    auto a0 = _mm_unpacklo_epi16(col[0], col[1]);
+    auto a1 = _mm_unpackhi_epi16(col[0], col[1]);
+    auto a2 = _mm_unpacklo_epi16(col[2], col[3]);
+    auto a3 = _mm_unpackhi_epi16(col[2], col[3]);
+    auto a4 = _mm_unpacklo_epi16(col[4], col[5]);
+    auto a5 = _mm_unpackhi_epi16(col[4], col[5]);
+    auto a6 = _mm_unpacklo_epi16(col[6], col[7]);
+    auto a7 = _mm_unpackhi_epi16(col[6], col[7]);
+    auto b0 = _mm_unpacklo_epi32(a0, a2);
+    auto b1 = _mm_unpackhi_epi32(a0, a2);
+    auto b2 = _mm_unpacklo_epi32(a1, a3);
+    auto b3 = _mm_unpackhi_epi32(a1, a3);
+    auto b4 = _mm_unpacklo_epi32(a4, a6);
+    auto b5 = _mm_unpackhi_epi32(a4, a6);
+    auto b6 = _mm_unpacklo_epi32(a5, a7);
+    auto b7 = _mm_unpackhi_epi32(a5, a7);
+
+    __m128i row[8] = {
+        _mm_unpacklo_epi64(b0, b4), _mm_unpackhi_epi64(b0, b4), _mm_unpacklo_epi64(b1, b5), _mm_unpackhi_epi64(b1, b5),
+        _mm_unpacklo_epi64(b2, b6), _mm_unpackhi_epi64(b2, b6), _mm_unpacklo_epi64(b3, b7), _mm_unpackhi_epi64(b3, b7),
+    };
+    for(uint32_t k = 0; k < 8; k++) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + static_cast<size_t>(y + k) * walk.outWidth + x), row[k]);
+    }
+}
+#endif
+
+const uint32_t TILE_SIZE  = 8;
+const uint32_t BLOCK_SIZE = 64;  // 64x64 output pixels, the source lines of a block stay in the cache while it is written
+
+template <typename T> void transformImage(const T *src, T *dst, const PixelWalk &walk, const ValueOps &ops) {
+    if(walk.colStep == 1 || walk.colStep == -1) {
+        // no rotation or 180 degrees: the output rows are source rows, read forward or backward
+        for(uint32_t y = 0; y < walk.outHeight; y++) {
+            transformRow(src + walk.base + y * walk.rowStep, walk.colStep, dst + static_cast<size_t>(y) * walk.outWidth, walk.outWidth, ops);
+        }
+        return;
+    }
+
+    for(uint32_t by = 0; by < walk.outHeight; by += BLOCK_SIZE) {
+        for(uint32_t bx = 0; bx < walk.outWidth; bx += BLOCK_SIZE) {
+            transformTile(src, walk, dst, bx, by, std::min(bx + BLOCK_SIZE, walk.outWidth), std::min(by + BLOCK_SIZE, walk.outHeight), ops);
+        }
+    }
+}
+
+template <> void transformImage<uint16_t>(const uint16_t *src, uint16_t *dst, const PixelWalk &walk, const ValueOps &ops) {
+#ifdef DEPTH_TRANSFORM_SIMD
+    SimdValueOps simdOps(ops);
+    if(walk.colStep == 1 || walk.colStep == -1) {
+        for(uint32_t y = 0; y < walk.outHeight; y++) {
+            transformRowSimd(src + walk.base + y * walk.rowStep, walk.colStep, dst + static_cast<size_t>(y) * walk.outWidth, walk.outWidth, simdOps, ops);
+        }
+        return;
+    }
+
+    for(uint32_t by = 0; by < walk.outHeight; by += BLOCK_SIZE) {
+        for(uint32_t bx = 0; bx < walk.outWidth; bx += BLOCK_SIZE) {
+            auto blockEndX = std::min(bx + BLOCK_SIZE, walk.outWidth);
+            auto blockEndY = std::min(by + BLOCK_SIZE, walk.outHeight);
+            for(uint32_t y = by; y < blockEndY; y += TILE_SIZE) {
+                for(uint32_t x = bx; x < blockEndX; x += TILE_SIZE) {
+                    if(x + TILE_SIZE <= blockEndX && y + TILE_SIZE <= blockEndY) {
+                        transformTileSimd(src, walk, dst, x, y, simdOps);
+                    }
+                    else {
+                        transformTile(src, walk, dst, x, y, std::min(x + TILE_SIZE, blockEndX), std::min(y + TILE_SIZE, blockEndY), ops);
+                    }
+                }
+            }
+        }
+    }
+#else
+    if(walk.colStep == 1 || walk.colStep == -1) {
+        for(uint32_t y = 0; y < walk.outHeight; y++) {
+            transformRow(src + walk.base + y * walk.rowStep, walk.colStep, dst + static_cast<size_t>(y) * walk.outWidth, walk.outWidth, ops);
+        }
+        return;
+    }
+
+    for(uint32_t by = 0; by < walk.outHeight; by += BLOCK_SIZE) {
+        for(uint32_t bx = 0; bx < walk.outWidth; bx += BLOCK_SIZE) {
+            transformTile(src, walk, dst, bx, by, std::min(bx + BLOCK_SIZE, walk.outWidth), std::min(by + BLOCK_SIZE, walk.outHeight), ops);
+        }
+    }
+#endif
+}
+
+// the extrinsic from the output to the source of the rotation, see FrameRotate
+OBExtrinsic rotationExtrinsic(uint32_t rotateDegree) {
+    if(rotateDegree == 90) {
+        return { { 0, 1, 0, -1, 0, 0, 0, 0, 1 }, { 0, 0, 0 } };
+    }
+    else if(rotateDegree == 180) {
+        return { { -1, 0, 0, 0, -1, 0, 0, 0, 1 }, { 0, 0, 0 } };
+    }
+    else if(rotateDegree == 270) {
+        return { { 0, -1, 0, 1, 0, 0, 0, 0, 1 }, { 0, 0, 0 } };
+    }
+    return { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0, 0, 0 } };
+}
+
+OBExtrinsic multiplyRotation(const OBExtrinsic &l, const OBExtrinsic &r) {
+    OBExtrinsic result = { { 0 }, { 0, 0, 0 } };
+    for(int i = 0; i < 3; i++) {
+        for(int j = 0; j < 3; j++) {
+            for(int k = 0; k < 3; k++) {
+                result.rot[i * 3 + j] += l.rot[i * 3 + k] * r.rot[k * 3 + j];
+            }
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+DepthTransformFilter::DepthTransformFilter() : config_{ 0, 16000, 1.0f, 0, false, false, 0 }, rstMirror_(false), rstFlip_(false), rstRotateDegree_(0) {}
+DepthTransformFilter::~DepthTransformFilter() noexcept {}
+
+void DepthTransformFilter::updateConfig(std::vector<std::string> &params) {
+    // min, max: the config of ThresholdFilter; or all the config items
+    if(params.size() != 2 && params.size() != 7) {
+        THROW_INVALID_PARAM_EXCEPTION("DepthTransformFilter config error: params size not match");
+    }
+    try {
+        std::lock_guard<std::mutex> configLock(mtx_);
+        auto                        config = config_;
+        int                         min    = std::stoi(params[0]);
+        if(min >= 0 && min <= 16000) {
+            config.min = min;
+        }
+        int max = std::stoi(params[1]);
+        if(max >= 0 && max <= 16000) {
+            config.max = max;
+        }
+
+        if(params.size() == 7) {
+            config.scale  = std::stof(params[2]);
+            config.offset = static_cast<int8_t>(std::stoi(params[3]));
+            if(!utils::string::cvt2Boolean(params[4], config.mirror) || !utils::string::cvt2Boolean(params[5], config.flip)) {
+                THROW_INVALID_PARAM_EXCEPTION("DepthTransformFilter config error: invalid mirror or flip value");
+            }
+            int rotateDegree = std::stoi(params[6]);
+            if(rotateDegree != 0 && rotateDegree != 90 && rotateDegree != 180 && rotateDegree != 270) {
+                THROW_INVALID_PARAM_EXCEPTION("DepthTransformFilter config error: the rotation must be 0, 90, 180 or 270 degrees");
+            }
+            config.rotateDegree = static_cast<uint32_t>(rotateDegree);
+        }
+        config_ = config;
+    }
+    catch(const libobsensor_exception &) {
+        throw;
+    }
+    catch(const std::exception &e) {
+        THROW_INVALID_PARAM_EXCEPTION("DepthTransformFilter config error: " + std::string(e.what()));
+    }
+}
+
+void DepthTransformFilter::setConfigData(void *data, uint32_t size) {
+    utils::unusedVar(data);
+    utils::unusedVar(size);
+}
+
+const std::string &DepthTransformFilter::getConfigSchema() const {
+    // csv format: name，type， min，max，step，default，description
+    static const std::string schema = "min, int, 0, 16000, 1, 0, min depth range\n"
+                                      "max, int, 0, 16000, 1, 16000, max depth range\n"
+                                      "scale, float, 0.01, 100.0, 0.01, 1.0, value scale factor\n"
+                                      "offset, int, -16, 16, 1, 0, value offset factor\n"
+                                      "mirror, bool, 0, 1, 1, 0, mirror the frame image\n"
+                                      "flip, bool, 0, 1, 1, 0, flip the frame image\n"
+                                      "rotate, int, 0, 270, 90, 0, frame image rotation angle after mirror and flip";
+    return schema;
+}
+
+void DepthTransformFilter::reset() {
+    srcStreamProfile_.reset();
+    rstStreamProfile_.reset();
+}
+
+std::shared_ptr<Frame> DepthTransformFilter::process(std::shared_ptr<const Frame> frame) {
+    if(!frame) {
+        return nullptr;
+    }
+
+    Config config;
+    {
+        std::lock_guard<std::mutex> configLock(mtx_);
+        config = config_;
+    }
+
+    if(!frame->is<FrameSet>()) {
+        if(!frame->is<DepthFrame>()) {
+            LOG_WARN_INTVL("DepthTransformFilter unsupported to process this frame type: {}", frame->getType());
+            return FrameFactory::createFrameView(frame);
+        }
+        return transformDepthFrame(frame, config);
+    }
+
+    auto depth = frame->as<FrameSet>()->getFrame(OB_FRAME_DEPTH);
+    if(!depth) {
+        LOG_WARN_INTVL("Invalid input frame, not depth frame found!");
+        return FrameFactory::createFrameView(frame);
+    }
+    auto frameSet = FrameFactory::createFrameFromOtherFrame(frame);
+    frameSet->as<FrameSet>()->pushFrame(transformDepthFrame(depth, config));
+    return frameSet;
+}
+
+std::shared_ptr<Frame> DepthTransformFilter::transformDepthFrame(std::shared_ptr<const Frame> depth, const Config &config) {
+    auto format = depth->getFormat();
+    if(format != OB_FORMAT_Y16 && format != OB_FORMAT_Y8) {
+        LOG_WARN_INTVL("DepthTransformFilter unsupported to process this format: {}", format);
+        return FrameFactory::createFrameView(depth);
+    }
+
+    auto     depthFrame = depth->as<DepthFrame>();
+    auto     valueScale = depthFrame->getValueScale();
+    ValueOps ops;
+    ops.threshold  = true;
+    ops.min        = static_cast<uint32_t>(config.min / valueScale);
+    ops.max        = static_cast<uint32_t>(config.max / valueScale);
+    ops.scale      = config.scale != 1.0f;
+    ops.scaleValue = config.scale;
+    ops.offset     = config.offset;
+    if(ops.min >= ops.max) {
+        // every value is out of range, as in ThresholdFilter
+        ops.min = 1;
+        ops.max = 0;
+    }
+
+    auto walk     = makePixelWalk(depthFrame->getWidth(), depthFrame->getHeight(), config.mirror, config.flip, config.rotateDegree);
+    auto outFrame = FrameFactory::createFrameFromOtherFrame(depth);
+    if(format == OB_FORMAT_Y16) {
+        transformImage(reinterpret_cast<const uint16_t *>(depth->getData()), reinterpret_cast<uint16_t *>(outFrame->getDataMutable()), walk, ops);
+    }
+    else {
+        transformImage(depth->getData(), outFrame->getDataMutable(), walk, ops);
+    }
+
+    auto outDepthFrame = outFrame->as<DepthFrame>();
+    if(ops.scale) {
+        outDepthFrame->setValueScale(valueScale * config.scale);
+    }
+    if(ops.offset != 0) {
+        outDepthFrame->setPixelAvailableBitSize(static_cast<uint8_t>(depthFrame->getPixelAvailableBitSize() - ops.offset));
+    }
+
+    if((config.mirror || config.flip || config.rotateDegree != 0) && depth->getStreamProfile()) {
+        try {
+            updateOutputProfile(depth->getStreamProfile(), config);
+            outFrame->setStreamProfile(rstStreamProfile_);
+        }
+        catch(libobsensor_exception &error) {
+            LOG_WARN_INTVL("DepthTransformFilter camera intrinsic conversion failed{0}, exception type: {1}", error.getMessage(), error.getExceptionType());
+        }
+    }
+    return outFrame;
+}
+
+void DepthTransformFilter::updateOutputProfile(std::shared_ptr<const StreamProfile> srcProfile, const Config &config) {
+    if(rstStreamProfile_ && srcStreamProfile_ == srcProfile && rstMirror_ == config.mirror && rstFlip_ == config.flip
+       && rstRotateDegree_ == config.rotateDegree) {
+        return;
+    }
+
+    auto srcVideoStreamProfile = srcProfile->as<VideoStreamProfile>();
+    auto intrinsic             = srcVideoStreamProfile->getIntrinsic();
+    auto distortion            = srcVideoStreamProfile->getDistortion();
+    // the extrinsic from the output to the source: mirror * flip * rotation
+    OBExtrinsic extrinsic = rotationExtrinsic(0);
+    if(config.mirror) {
+        CameraParamProcessor::cameraIntrinsicParamsMirror(&intrinsic);
+        CameraParamProcessor::distortionParamMirror(&distortion);
+        extrinsic = multiplyRotation(extrinsic, { { -1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0, 0, 0 } });
+    }
+    if(config.flip) {
+        CameraParamProcessor::cameraIntrinsicParamsFlip(&intrinsic);
+        CameraParamProcessor::distortionParamFlip(&distortion);
+        extrinsic = multiplyRotation(extrinsic, { { 1, 0, 0, 0, -1, 0, 0, 0, 1 }, { 0, 0, 0 } });
+    }
+    if(config.rotateDegree == 90) {
+        CameraParamProcessor::cameraIntrinsicParamsRotate90(&intrinsic);
+        CameraParamProcessor::distortionParamRotate90(&distortion);
+    }
+    else if(config.rotateDegree == 180) {
+        CameraParamProcessor::cameraIntrinsicParamsRotate180(&intrinsic);
+        CameraParamProcessor::distortionParamRotate180(&distortion);
+    }
+    else if(config.rotateDegree == 270) {
+        CameraParamProcessor::cameraIntrinsicParamsRotate270(&intrinsic);
+        CameraParamProcessor::distortionParamRotate270(&distortion);
+    }
+    extrinsic = multiplyRotation(extrinsic, rotationExtrinsic(config.rotateDegree));
+
+    auto rstProfile = srcVideoStreamProfile->clone()->as<VideoStreamProfile>();
+    rstProfile->bindIntrinsic(intrinsic);
+    rstProfile->bindDistortion(distortion);
+    rstProfile->bindExtrinsicTo(srcProfile, extrinsic);
+    if(config.rotateDegree == 90 || config.rotateDegree == 270) {
+        rstProfile->setWidth(srcVideoStreamProfile->getHeight());
+        rstProfile->setHeight(srcVideoStreamProfile->getWidth());
+    }
+
+    srcStreamProfile_ = srcProfile;
+    rstStreamProfile_ = rstProfile;
+    rstMirror_        = config.mirror;
+    rstFlip_          = config.flip;
+    rstRotateDegree_  = config.rotateDegree;
+}
+
+}  // namespace libobsensor
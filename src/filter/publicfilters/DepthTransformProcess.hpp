@@ -0,0 +1,53 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#pragma once
+#include "IFilter.hpp"
+#include "stream/StreamProfile.hpp"
+#include <mutex>
+
+namespace libobsensor {
+
+// Threshold, value scale, value offset, mirror, flip and rotation of the depth frames in a single pass over the image, writing one output frame.
+// Same results as ThresholdFilter, PixelValueScaler, PixelValueOffset, FrameMirror, FrameFlip and FrameRotate applied in this order. The first
+// two config items are those of ThresholdFilter, so it can take its place in the recommended filter list.
+// The scaled values wrap like (T)(value * scale) in PixelValueScaler. Unlike PixelValueScaler, which only processes Y16, the Y8 frames are
+// scaled too.
+class DepthTransformFilter : public IFilterBase {
+public:
+    DepthTransformFilter();
+    virtual ~DepthTransformFilter() noexcept override;
+
+    void               updateConfig(std::vector<std::string> &params) override;
+    void               setConfigData(void *data, uint32_t size) override;
+    const std::string &getConfigSchema() const override;
+    void               reset() override;
+
+private:
+    struct Config {
+        uint32_t min;
+        uint32_t max;
+        float    scale;
+        int8_t   offset;
+        bool     mirror;
+        bool     flip;
+        uint32_t rotateDegree;
+    };
+
+    std::shared_ptr<Frame> process(std::shared_ptr<const Frame> frame) override;
+
+    std::shared_ptr<Frame> transformDepthFrame(std::shared_ptr<const Frame> depth, const Config &config);
+    void                   updateOutputProfile(std::shared_ptr<const StreamProfile> srcProfile, const Config &config);
+
+protected:
+    std::mutex mtx_;
+    Config     config_;
+
+    std::shared_ptr<const StreamProfile> srcStreamProfile_;
+    std::shared_ptr<VideoStreamProfile>  rstStreamProfile_;
+    bool                                 rstMirror_;
+    bool                                 rstFlip_;
+    uint32_t                             rstRotateDegree_;
+};
+
+}  // namespace libobsensor
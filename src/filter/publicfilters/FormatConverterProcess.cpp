@@ -17,8 +17,33 @@
 #include <unistd.h>
 #endif
 
+#if defined(__ARM_NEON__) || defined(__NEON__) || defined(__SSSE3__)
+#if(defined(__ARM_NEON__) || defined(__aarch64__) || defined(__arm__))
+#include "SSE2NEON.h"
+#else
+#include <tmmintrin.h>
+#endif
+#define FORMAT_CONVERTER_SIMD
+#endif
+
 namespace libobsensor {
 
+namespace {
+
+#ifdef FORMAT_CONVERTER_SIMD
+// Expands 16 gray pixels to 48 bytes of RGB
+inline void storeGrayAsRgb(__m128i gray, uint8_t *target) {
+    const __m128i shuffle0 = _mm_setr_epi8(0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5);
+    const __m128i shuffle1 = _mm_setr_epi8(5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10);
+    const __m128i shuffle2 = _mm_setr_epi8(10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(target), _mm_shuffle_epi8(gray, shuffle0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(target + 16), _mm_shuffle_epi8(gray, shuffle1));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(target + 32), _mm_shuffle_epi8(gray, shuffle2));
+}
+#endif
+
+}  // namespace
+
 FormatConverter::FormatConverter() : convertType_(FORMAT_YUYV_TO_RGB) {}
 FormatConverter::~FormatConverter() noexcept {
     clearTempDataBuf();
@@ -185,7 +210,7 @@ std::shared_ptr<Frame> FormatConverter::process(std::shared_ptr<const Frame> fra
         break;
     default:
         LOG_WARN_INTVL("Unsupported data format conversion.");
-        return FrameFactory::createFrameFromOtherFrame(frame, true);
+        return FrameFactory::createFrameView(frame);
         break;
     }
     return tarFrame;
@@ -232,37 +257,23 @@ void FormatConverter::yuyvToBgra(uint8_t *src, uint8_t *target, uint32_t width,
 }
 
 void FormatConverter::yuyvToy16(uint8_t *src, uint8_t *target, uint32_t width, uint32_t height) {
-    auto size = width * height;
-    for(uint32_t i = 0; i < size; i += 16) {
-        uint8_t tarArray[32] = {
-            0, src[i * 2],      0, src[i * 2 + 2],  0, src[i * 2 + 4],  0, src[i * 2 + 6],  0, src[i * 2 + 8],  0, src[i * 2 + 10],
-            0, src[i * 2 + 12], 0, src[i * 2 + 14], 0, src[i * 2 + 16], 0, src[i * 2 + 18], 0, src[i * 2 + 20], 0, src[i * 2 + 22],
-            0, src[i * 2 + 24], 0, src[i * 2 + 26], 0, src[i * 2 + 28], 0, src[i * 2 + 30],
-        };
-        memcpy(target + i * 2, tarArray, 32);
+    // the Y of every pixel goes to the high byte, the U/V byte is cleared
+    const uint32_t size = width * height;
+    uint32_t       i    = 0;
+#ifdef FORMAT_CONVERTER_SIMD
+    for(; i + 8 <= size; i += 8) {
+        __m128i yuyv = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 2));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(target + i * 2), _mm_slli_epi16(yuyv, 8));
+    }
+#endif
+    for(; i < size; i++) {
+        target[i * 2]     = 0;
+        target[i * 2 + 1] = src[i * 2];
     }
 }
 
 void FormatConverter::yuyvToy8(uint8_t *src, uint8_t *target, uint32_t width, uint32_t height) {
-    auto size = width * height;
-    for(uint32_t i = 0; i < size; i += 16) {
-        target[i]      = src[i * 2];
-        target[i + 1]  = src[i * 2 + 2];
-        target[i + 2]  = src[i * 2 + 4];
-        target[i + 3]  = src[i * 2 + 6];
-        target[i + 4]  = src[i * 2 + 8];
-        target[i + 5]  = src[i * 2 + 10];
-        target[i + 6]  = src[i * 2 + 12];
-        target[i + 7]  = src[i * 2 + 14];
-        target[i + 8]  = src[i * 2 + 16];
-        target[i + 9]  = src[i * 2 + 18];
-        target[i + 10] = src[i * 2 + 20];
-        target[i + 11] = src[i * 2 + 22];
-        target[i + 12] = src[i * 2 + 24];
-        target[i + 13] = src[i * 2 + 26];
-        target[i + 14] = src[i * 2 + 28];
-        target[i + 15] = src[i * 2 + 30];
-    }
+    libyuv::YUY2ToY(src, width * 2, target, width, width, height);
 }
 
 void FormatConverter::uyvyToRgb(uint8_t *src, uint8_t *target, uint32_t width, uint32_t height) {
@@ -335,32 +346,18 @@ void FormatConverter::mjpgToNv12(uint8_t *src, uint32_t src_len, uint8_t *target
 }
 
 bool FormatConverter::mjpgToRgb(uint8_t *src, uint32_t src_len, uint8_t *target, uint32_t width, uint32_t height) {
-    tjhandle tjHandle;
-    tjHandle = tjInitDecompress();
-    if(tjDecompress2(tjHandle, src, src_len, target, width,
-                     0,  // pitch
-                     height, TJPF_RGB, TJFLAG_FASTDCT | TJFLAG_FASTUPSAMPLE)
-       != 0) {
-        LOG_WARN_INTVL("Failed to decode mjpeg frame to rgb! {}", tjGetErrorStr2(tjHandle));
-        tjDestroy(tjHandle);
+    if(!mjpegDecoder_.decode(src, src_len, target, width, 0, height, TJPF_RGB, TJFLAG_FASTDCT | TJFLAG_FASTUPSAMPLE)) {
+        LOG_WARN_INTVL("Failed to decode mjpeg frame to rgb! {}", mjpegDecoder_.getLastError());
         return false;
     }
-    tjDestroy(tjHandle);
     return true;
 }
 
 bool FormatConverter::mjpgToBgr(uint8_t *src, uint32_t src_len, uint8_t *target, uint32_t width, uint32_t height) {
-    tjhandle tjHandle;
-    tjHandle = tjInitDecompress();
-    if(tjDecompress2(tjHandle, src, src_len, target, width,
-                     0,  // pitch
-                     height, TJPF_BGR, TJFLAG_FASTDCT | TJFLAG_FASTUPSAMPLE)
-       != 0) {
-        LOG_WARN_INTVL("Failed to decode mjpeg frame to bgr! {}", tjGetErrorStr2(tjHandle));
-        tjDestroy(tjHandle);
+    if(!mjpegDecoder_.decode(src, src_len, target, width, 0, height, TJPF_BGR, TJFLAG_FASTDCT | TJFLAG_FASTUPSAMPLE)) {
+        LOG_WARN_INTVL("Failed to decode mjpeg frame to bgr! {}", mjpegDecoder_.getLastError());
         return false;
     }
-    tjDestroy(tjHandle);
     return true;
 }
 
@@ -368,6 +365,11 @@ void FormatConverter::exchangeRAndB(uint8_t *pucRgb, uint8_t *target, uint32_t w
     if(pucRgb == nullptr || target == nullptr) {
         return;
     }
+    if(pixelSize == 3) {
+        // RAW and RGB24 only differ in the order of R and B, the conversion swaps them either way
+        libyuv::RAWToRGB24(pucRgb, width * 3, target, width * 3, width, height);
+        return;
+    }
     for(uint32_t i = 0; i < height; i++) {
         for(uint32_t j = 0; j < width; j++) {
             uint8_t tmp1                                      = pucRgb[i * width * pixelSize + j * pixelSize];
@@ -379,15 +381,9 @@ void FormatConverter::exchangeRAndB(uint8_t *pucRgb, uint8_t *target, uint32_t w
 }
 
 void FormatConverter::mjpegToBgra(uint8_t *src, uint32_t src_len, uint8_t *target, uint32_t width, uint32_t height) {
-    tjhandle tjHandle;
-    tjHandle = tjInitDecompress();
-    if(tjDecompress2(tjHandle, src, src_len, target, width,
-                     0,  // pitch
-                     height, TJPF_BGRA, TJFLAG_FASTDCT | TJFLAG_FASTUPSAMPLE)
-       != 0) {
+    if(!mjpegDecoder_.decode(src, src_len, target, width, 0, height, TJPF_BGRA, TJFLAG_FASTDCT | TJFLAG_FASTUPSAMPLE)) {
         LOG_WARN_INTVL("Failed to decompress color frame");
     }
-    tjDestroy(tjHandle);
 }
 
 void FormatConverter::rgbaToRgb(uint8_t *src, uint32_t src_len, uint8_t *target, uint32_t width, uint32_t height) {
@@ -398,11 +394,8 @@ void FormatConverter::rgbaToRgb(uint8_t *src, uint32_t src_len, uint8_t *target,
     if(src_len < expected_rgba_len)
         return;
 
-    for(uint32_t i = 0; i < width * height; ++i) {
-        target[i * 3]     = src[i * 4];      // R
-        target[i * 3 + 1] = src[i * 4 + 1];  // G
-        target[i * 3 + 2] = src[i * 4 + 2];  // B
-    }
+    // drops the 4th byte of every pixel, whatever the channel order
+    libyuv::ARGBToRGB24(src, width * 4, target, width * 3, width, height);
 }
 
 void FormatConverter::bgraToBgr(uint8_t *src, uint32_t src_len, uint8_t *target, uint32_t width, uint32_t height) {
@@ -413,11 +406,7 @@ void FormatConverter::bgraToBgr(uint8_t *src, uint32_t src_len, uint8_t *target,
     if(src_len < expected_bgra_len)
         return;
 
-    for(uint32_t i = 0; i < width * height; ++i) {
-        target[i * 3]     = src[i * 4];      // B
-        target[i * 3 + 1] = src[i * 4 + 1];  // G
-        target[i * 3 + 2] = src[i * 4 + 2];  // R
-    }
+    libyuv::ARGBToRGB24(src, width * 4, target, width * 3, width, height);
 }
 
 void FormatConverter::y16ToRgb(uint8_t *src, uint32_t src_len, uint8_t *target, uint32_t width, uint32_t height) {
@@ -431,7 +420,15 @@ void FormatConverter::y16ToRgb(uint8_t *src, uint32_t src_len, uint8_t *target,
 
     const uint16_t *y16_data = reinterpret_cast<const uint16_t *>(src);
 
-    for(uint32_t i = 0; i < pixel_count; ++i) {
+    uint32_t i = 0;
+#ifdef FORMAT_CONVERTER_SIMD
+    for(; i + 16 <= pixel_count; i += 16) {
+        __m128i low  = _mm_srli_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(y16_data + i)), 8);
+        __m128i high = _mm_srli_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(y16_data + i + 8)), 8);
+        storeGrayAsRgb(_mm_packus_epi16(low, high), target + i * 3);
+    }
+#endif
+    for(; i < pixel_count; ++i) {
         uint8_t y8 = y16_data[i] >> 8;
 
         target[i * 3]     = y8;  // R
@@ -448,7 +445,13 @@ void FormatConverter::y8ToRgb(uint8_t *src, uint32_t src_len, uint8_t *target, u
     if(src_len < pixel_count)
         return;
 
-    for(uint32_t i = 0; i < pixel_count; ++i) {
+    uint32_t i = 0;
+#ifdef FORMAT_CONVERTER_SIMD
+    for(; i + 16 <= pixel_count; i += 16) {
+        storeGrayAsRgb(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)), target + i * 3);
+    }
+#endif
+    for(; i < pixel_count; ++i) {
         const uint8_t y = src[i];
 
         target[i * 3]     = y;  // R
@@ -3,6 +3,7 @@
 
 #pragma once
 #include "IFilter.hpp"
+#include "MjpegDecoder.hpp"
 #include <mutex>
 
 namespace libobsensor {
@@ -51,6 +52,7 @@ protected:
     OBConvertFormat                      convertType_;
     uint8_t                             *tempDataBuf_     = nullptr;
     size_t                               tempDataBufSize_ = 0;
+    MjpegDecoder                         mjpegDecoder_;
 };
 
 }  // namespace libobsensor
@@ -10,73 +10,327 @@
 #include <libyuv.h>
 #include <turbojpeg.h>
 
+#if defined(__ARM_NEON__) || defined(__NEON__) || defined(__SSSE3__)
+#if(defined(__ARM_NEON__) || defined(__aarch64__) || defined(__arm__))
+#include "SSE2NEON.h"
+#else
+#include <tmmintrin.h>
+#endif
+#define GEOMETRIC_TRANSFORM_SIMD
+#endif
+
 namespace libobsensor {
-void mirrorRGBImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height) {
-    const uint8_t *srcPixel;
-    uint8_t       *dstPixel = dst;
-    for(uint32_t h = 0; h < height; h++) {
-        srcPixel = src + (h + 1) * width * 3 - 3;
-        for(uint32_t w = 0; w < width; w++) {
-            // mirror row for each RGB component
-            for(int i = 0; i < 3; i++) {
-                dstPixel[i] = srcPixel[i];
+
+namespace {
+
+const uint32_t TILE_SIZE  = 8;    // the 16 bit transposes are done on 8x8 tiles in registers
+const uint32_t BLOCK_SIZE = 128;  // the rotations are done per 128x128 block of the output
+
+bool toRotationMode(uint32_t rotateDegree, libyuv::RotationMode &rotationMode) {
+    switch(rotateDegree) {
+    case 90:
+        rotationMode = libyuv::kRotate90;
+        return true;
+    case 180:
+        rotationMode = libyuv::kRotate180;
+        return true;
+    case 270:
+        rotationMode = libyuv::kRotate270;
+        return true;
+    default:
+        LOG_WARN_INTVL_THREAD("Unsupported rotate degree!");
+        return false;
+    }
+}
+
+#ifdef GEOMETRIC_TRANSFORM_SIMD
+inline __m128i reverse8x16(__m128i value) {
+    const __m128i reverse = _mm_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+    return _mm_shuffle_epi8(value, reverse);
+}
+
+// in place transpose of 8 vectors of 8 16 bit values
+inline void transpose8x16(__m128i *v) {
+    auto a0 = _mm_unpacklo_epi16(v[0], v[1]);
+    auto a1 = _mm_unpackhi_epi16(v[0], v[1]);
+    auto a2 = _mm_unpacklo_epi16(v[2], v[3]);
+    auto a3 = _mm_unpackhi_epi16(v[2], v[3]);
+    auto a4 = _mm_unpacklo_epi16(v[4], v[5]);
+    auto a5 = _mm_unpackhi_epi16(v[4], v[5]);
+    auto a6 = _mm_unpacklo_epi16(v[6], v[7]);
+    auto a7 = _mm_unpackhi_epi16(v[6], v[7]);
+    auto b0 = _mm_unpacklo_epi32(a0, a2);
+    auto b1 = _mm_unpackhi_epi32(a0, a2);
+    auto b2 = _mm_unpacklo_epi32(a1, a3);
+    auto b3 = _mm_unpackhi_epi32(a1, a3);
+    auto b4 = _mm_unpacklo_epi32(a4, a6);
+    auto b5 = _mm_unpackhi_epi32(a4, a6);
+    auto b6 = _mm_unpacklo_epi32(a5, a7);
+    auto b7 = _mm_unpackhi_epi32(a5, a7);
+    v[0]    = _mm_unpacklo_epi64(b0, b4);
+    v[1]    = _mm_unpackhi_epi64(b0, b4);
+    v[2]    = _mm_unpacklo_epi64(b1, b5);
+    v[3]    = _mm_unpackhi_epi64(b1, b5);
+    v[4]    = _mm_unpacklo_epi64(b2, b6);
+    v[5]    = _mm_unpackhi_epi64(b2, b6);
+    v[6]    = _mm_unpacklo_epi64(b3, b7);
+    v[7]    = _mm_unpackhi_epi64(b3, b7);
+}
+#endif
+
+// dst[i] = src[width - 1 - i]
+void reverseRow16(const uint16_t *src, uint16_t *dst, uint32_t width) {
+    uint32_t i = 0;
+#ifdef GEOMETRIC_TRANSFORM_SIMD
+    for(; i + 8 <= width; i += 8) {
+        auto value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + width - 8 - i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), reverse8x16(value));
+    }
+#endif
+    for(; i < width; i++) {
+        dst[i] = src[width - 1 - i];
+    }
+}
+
+// the source pixel of the output pixel (x, y) of a 90 (clockwise) or 270 degree rotation
+inline size_t rotatedSourceIndex(uint32_t x, uint32_t y, uint32_t width, uint32_t height, bool rotate90) {
+    return rotate90 ? static_cast<size_t>(height - 1 - x) * width + y : static_cast<size_t>(x) * width + (width - 1 - y);
+}
+
+// the output pixels [x0, x1) x [y0, y1) of a 90 or 270 degree rotation, dstWidth is the source height
+template <typename T>
+void rotateTile(const T *src, T *dst, uint32_t width, uint32_t height, bool rotate90, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1) {
+    for(uint32_t y = y0; y < y1; y++) {
+        T *dstPixel = dst + static_cast<size_t>(y) * height + x0;
+        for(uint32_t x = x0; x < x1; x++) {
+            *dstPixel++ = src[rotatedSourceIndex(x, y, width, height, rotate90)];
+        }
+    }
+}
+
+#ifdef GEOMETRIC_TRANSFORM_SIMD
+// the 8x8 output tile at (x, y): every output column is 8 adjacent pixels of a source row, forward for 90 degrees and backward for 270
+void rotateTile16Simd(const uint16_t *src, uint16_t *dst, uint32_t width, uint32_t height, bool rotate90, uint32_t x, uint32_t y) {
+    __m128i v[8];
+    for(uint32_t k = 0; k < 8; k++) {
+        if(rotate90) {
+            v[k] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + rotatedSourceIndex(x + k, y, width, height, true)));
+        }
+        else {
+            v[k] = reverse8x16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + rotatedSourceIndex(x + k, y + 7, width, height, false))));
+        }
+    }
+    transpose8x16(v);
+    for(uint32_t k = 0; k < 8; k++) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + static_cast<size_t>(y + k) * height + x), v[k]);
+    }
+}
+#endif
+
+void rotatePlane16(const uint16_t *src, uint16_t *dst, uint32_t width, uint32_t height, bool rotate90) {
+    const uint32_t dstWidth  = height;
+    const uint32_t dstHeight = width;
+    for(uint32_t by = 0; by < dstHeight; by += BLOCK_SIZE) {
+        for(uint32_t bx = 0; bx < dstWidth; bx += BLOCK_SIZE) {
+            auto blockEndX = std::min(bx + BLOCK_SIZE, dstWidth);
+            auto blockEndY = std::min(by + BLOCK_SIZE, dstHeight);
+#ifdef GEOMETRIC_TRANSFORM_SIMD
+            for(uint32_t y = by; y < blockEndY; y += TILE_SIZE) {
+                for(uint32_t x = bx; x < blockEndX; x += TILE_SIZE) {
+                    if(x + TILE_SIZE <= blockEndX && y + TILE_SIZE <= blockEndY) {
+                        rotateTile16Simd(src, dst, width, height, rotate90, x, y);
+                    }
+                    else {
+                        rotateTile(src, dst, width, height, rotate90, x, y, std::min(x + TILE_SIZE, blockEndX), std::min(y + TILE_SIZE, blockEndY));
+                    }
+                }
             }
-            srcPixel -= 3;
-            dstPixel += 3;
+#else
+            rotateTile(src, dst, width, height, rotate90, bx, by, blockEndX, blockEndY);
+#endif
         }
     }
 }
 
-void mirrorRGBAImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height) {
-    const uint8_t *srcPixel;
-    uint8_t       *dstPixel = dst;
+// RGB pixels of 3 bytes, copied per output block
+void rotateRGB24(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, bool rotate90) {
+    const uint32_t dstWidth  = height;
+    const uint32_t dstHeight = width;
+    // the next pixel of an output row is the pixel above (90 degrees) or below (270 degrees) in the source
+    const int64_t srcStep = rotate90 ? -static_cast<int64_t>(width) * 3 : static_cast<int64_t>(width) * 3;
+    for(uint32_t by = 0; by < dstHeight; by += BLOCK_SIZE) {
+        for(uint32_t bx = 0; bx < dstWidth; bx += BLOCK_SIZE) {
+            auto blockEndX = std::min(bx + BLOCK_SIZE, dstWidth);
+            auto blockEndY = std::min(by + BLOCK_SIZE, dstHeight);
+            for(uint32_t y = by; y < blockEndY; y++) {
+                const uint8_t *srcPixel = src + rotatedSourceIndex(bx, y, width, height, rotate90) * 3;
+                uint8_t       *dstPixel = dst + (static_cast<size_t>(y) * dstWidth + bx) * 3;
+                uint8_t       *dstEnd   = dst + (static_cast<size_t>(y) * dstWidth + blockEndX) * 3;
+                for(; dstPixel < dstEnd; dstPixel += 3) {
+                    dstPixel[0] = srcPixel[0];
+                    dstPixel[1] = srcPixel[1];
+                    dstPixel[2] = srcPixel[2];
+                    srcPixel += srcStep;
+                }
+            }
+        }
+    }
+}
+
+// Mirror of the packed YUV formats: the macro pixels of 4 bytes are reversed, and the bytes of each are reordered by order to swap the 2 luma
+// samples.
+void mirrorPackedYUVImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, const uint8_t order[4]) {
+    const uint32_t groups = width / 2;
+#ifdef GEOMETRIC_TRANSFORM_SIMD
+    // 4 macro pixels per vector: the output group i is the input group 3 - i
+    const __m128i shuffle = _mm_setr_epi8(static_cast<char>(12 + order[0]), static_cast<char>(12 + order[1]), static_cast<char>(12 + order[2]),
+                                          static_cast<char>(12 + order[3]), static_cast<char>(8 + order[0]), static_cast<char>(8 + order[1]),
+                                          static_cast<char>(8 + order[2]), static_cast<char>(8 + order[3]), static_cast<char>(4 + order[0]),
+                                          static_cast<char>(4 + order[1]), static_cast<char>(4 + order[2]), static_cast<char>(4 + order[3]),
+                                          static_cast<char>(order[0]), static_cast<char>(order[1]), static_cast<char>(order[2]), static_cast<char>(order[3]));
+#endif
     for(uint32_t h = 0; h < height; h++) {
-        srcPixel = src + (h + 1) * width * 4 - 4;
-        for(uint32_t w = 0; w < width; w++) {
-            // mirror row for each RGB component
+        const uint8_t *srcRow = src + static_cast<size_t>(h) * width * 2;
+        uint8_t       *dstRow = dst + static_cast<size_t>(h) * width * 2;
+        uint32_t       g      = 0;
+#ifdef GEOMETRIC_TRANSFORM_SIMD
+        for(; g + 4 <= groups; g += 4) {
+            auto value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcRow + (groups - 4 - g) * 4));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dstRow + g * 4), _mm_shuffle_epi8(value, shuffle));
+        }
+#endif
+        for(; g < groups; g++) {
+            const uint8_t *srcPixel = srcRow + (groups - 1 - g) * 4;
+            uint8_t       *dstPixel = dstRow + g * 4;
             for(int i = 0; i < 4; i++) {
-                dstPixel[i] = srcPixel[i];
+                dstPixel[i] = srcPixel[order[i]];
             }
-            srcPixel -= 4;
-            dstPixel += 4;
         }
     }
 }
 
-void mirrorYUYVImage(uint8_t *src, uint8_t *dst, int width, int height) {
-    uint8_t *dstPixel = dst;
-    for(int h = 0; h < height; h++) {
-        uint8_t *srcPixel = src + width * 2 * (h + 1) - 4;
-        for(int w = 0; w < width / 2; w++) {
-            *dstPixel       = *(srcPixel + 2);
-            *(dstPixel + 1) = *(srcPixel + 1);
-            *(dstPixel + 2) = *srcPixel;
-            *(dstPixel + 3) = *(srcPixel + 3);
+// YUYV or UYVY through I420, since only the planar formats can be rotated; the chroma is subsampled vertically on the way.
+void packedYUVImageRotate(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree, std::vector<uint8_t> &buffer,
+                          bool uyvy) {
+    libyuv::RotationMode rotationMode;
+    if(!toRotationMode(rotateDegree, rotationMode)) {
+        return;
+    }
 
-            srcPixel -= 4;
-            dstPixel += 4;
-        }
+    // 1. packed YUV to I420, in the output frame which is large enough
+    const uint32_t planeSize = width * height;
+    buffer.resize(planeSize + planeSize / 2);
+    uint8_t *srcY = dst;
+    uint8_t *srcU = srcY + planeSize;
+    uint8_t *srcV = srcU + planeSize / 4;
+    int      w    = static_cast<int>(width);
+    int      h    = static_cast<int>(height);
+    if(uyvy) {
+        libyuv::UYVYToI420(src, w * 2, srcY, w, srcU, w / 2, srcV, w / 2, w, h);
+    }
+    else {
+        libyuv::YUY2ToI420(src, w * 2, srcY, w, srcU, w / 2, srcV, w / 2, w, h);
+    }
+
+    // 2. rotate
+    int      dstWidth  = rotationMode == libyuv::kRotate180 ? w : h;
+    int      dstHeight = rotationMode == libyuv::kRotate180 ? h : w;
+    uint8_t *dstY      = buffer.data();
+    uint8_t *dstU      = dstY + planeSize;
+    uint8_t *dstV      = dstU + planeSize / 4;
+    libyuv::I420Rotate(srcY, w, srcU, w / 2, srcV, w / 2, dstY, dstWidth, dstU, dstWidth / 2, dstV, dstWidth / 2, w, h, rotationMode);
+
+    // 3. I420 to packed YUV
+    if(uyvy) {
+        libyuv::I420ToUYVY(dstY, dstWidth, dstU, dstWidth / 2, dstV, dstWidth / 2, dst, dstWidth * 2, dstWidth, dstHeight);
+    }
+    else {
+        libyuv::I420ToYUY2(dstY, dstWidth, dstU, dstWidth / 2, dstV, dstWidth / 2, dst, dstWidth * 2, dstWidth, dstHeight);
     }
 }
 
-void mirrorUYVYImage(uint8_t *src, uint8_t *dst, int width, int height) {
-    uint8_t *dstPixel = dst;
-    for(int h = 0; h < height; h++) {
-        uint8_t *srcPixel = src + width * 2 * (h + 1) - 4;
-        for(int w = 0; w < width / 2; w++) {
-            dstPixel[0] = srcPixel[0];  // U
-            dstPixel[1] = srcPixel[3];  // Y1
-            dstPixel[2] = srcPixel[2];  // V
-            dstPixel[3] = srcPixel[1];  // Y0
+// bytes per pixel of the packed formats FrameCrop supports, 0 for the other formats
+uint32_t packedPixelSize(OBFormat format) {
+    switch(format) {
+    case OB_FORMAT_Y8:
+        return 1;
+    case OB_FORMAT_Y16:
+    case OB_FORMAT_Z16:
+    case OB_FORMAT_Y12C4:
+    case OB_FORMAT_YUYV:
+    case OB_FORMAT_UYVY:
+        return 2;
+    case OB_FORMAT_RGB:
+    case OB_FORMAT_BGR:
+        return 3;
+    case OB_FORMAT_RGBA:
+    case OB_FORMAT_BGRA:
+        return 4;
+    default:
+        return 0;
+    }
+}
 
-            srcPixel -= 4;
-            dstPixel += 4;
-        }
+bool isPlanarYUV(OBFormat format) {
+    return format == OB_FORMAT_NV12 || format == OB_FORMAT_NV21 || format == OB_FORMAT_I420;
+}
+
+// Copies the region of the image to dst, row by row, so the cost follows the region size. srcStride is the one of the luma plane for the planar
+// YUV formats, whose region is on even coordinates.
+void cropImage(OBFormat format, const uint8_t *src, uint32_t srcStride, uint32_t srcHeight, uint8_t *dst, const OBRect &region) {
+    int x = static_cast<int>(region.x);
+    int y = static_cast<int>(region.y);
+    int w = static_cast<int>(region.width);
+    int h = static_cast<int>(region.height);
+    int s = static_cast<int>(srcStride);
+    switch(format) {
+    case OB_FORMAT_NV12:
+    case OB_FORMAT_NV21: {
+        // the interleaved chroma plane has the row size of the luma plane and half its rows
+        const uint8_t *srcUV = src + srcStride * srcHeight;
+        libyuv::CopyPlane(src + y * s + x, s, dst, w, w, h);
+        libyuv::CopyPlane(srcUV + y / 2 * s + x, s, dst + w * h, w, w, h / 2);
+        break;
     }
+    case OB_FORMAT_I420: {
+        const uint8_t *srcU = src + srcStride * srcHeight;
+        const uint8_t *srcV = srcU + srcStride / 2 * srcHeight / 2;
+        uint8_t       *dstU = dst + w * h;
+        uint8_t       *dstV = dstU + w / 2 * h / 2;
+        libyuv::CopyPlane(src + y * s + x, s, dst, w, w, h);
+        libyuv::CopyPlane(srcU + y / 2 * (s / 2) + x / 2, s / 2, dstU, w / 2, w / 2, h / 2);
+        libyuv::CopyPlane(srcV + y / 2 * (s / 2) + x / 2, s / 2, dstV, w / 2, w / 2, h / 2);
+        break;
+    }
+    default: {
+        int pixelSize = static_cast<int>(packedPixelSize(format));
+        libyuv::CopyPlane(src + y * s + x * pixelSize, s, dst, w * pixelSize, w * pixelSize, h);
+        break;
+    }
+    }
+}
+
+}  // namespace
+
+void mirrorRGBImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height) {
+    libyuv::RGB24Mirror(src, static_cast<int>(width * 3), dst, static_cast<int>(width * 3), static_cast<int>(width), static_cast<int>(height));
+}
+
+void mirrorRGBAImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height) {
+    libyuv::ARGBMirror(src, static_cast<int>(width * 4), dst, static_cast<int>(width * 4), static_cast<int>(width), static_cast<int>(height));
+}
+
+void mirrorYUYVImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height) {
+    static const uint8_t order[4] = { 2, 1, 0, 3 };  // Y1 U Y0 V
+    mirrorPackedYUVImage(src, dst, width, height, order);
+}
+
+void mirrorUYVYImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height) {
+    static const uint8_t order[4] = { 0, 3, 2, 1 };  // U Y1 V Y0
+    mirrorPackedYUVImage(src, dst, width, height, order);
 }
 
 void flipRGBImage(int pixelSize, const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height) {
-    // const uint32_t pixelSize = 3;  // RGB888 format occupies 3 bytes per pixel
     const uint32_t rowSize = width * static_cast<uint32_t>(pixelSize);
 
     for(uint32_t h = 0; h < height; h++) {
@@ -86,132 +340,75 @@ void flipRGBImage(int pixelSize, const uint8_t *src, uint8_t *dst, uint32_t widt
     }
 }
 
-void yuyvImageRotate(uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree) {
-    libyuv::RotationMode rotationMode;
-    switch(rotateDegree) {
-    case 90:
-        rotationMode = libyuv::kRotate90;
-        break;
-    case 180:
-        rotationMode = libyuv::kRotate180;
-        break;
-    case 270:
-        rotationMode = libyuv::kRotate270;
-        break;
-    default:
-        LOG_WARN_INTVL_THREAD("Unsupported rotate degree!");
-        return;
+void yuyvImageRotate(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree, std::vector<uint8_t> &buffer) {
+    packedYUVImageRotate(src, dst, width, height, rotateDegree, buffer, false);
+}
+
+void uyvyImageRotate(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree, std::vector<uint8_t> &buffer) {
+    packedYUVImageRotate(src, dst, width, height, rotateDegree, buffer, true);
+}
+
+void imageMirror(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height) {
+    libyuv::MirrorPlane(src, static_cast<int>(width), dst, static_cast<int>(width), static_cast<int>(width), static_cast<int>(height));
+}
+
+void imageMirror(const uint16_t *src, uint16_t *dst, uint32_t width, uint32_t height) {
+    for(uint32_t h = 0; h < height; h++) {
+        reverseRow16(src + static_cast<size_t>(h) * width, dst + static_cast<size_t>(h) * width, width);
     }
+}
 
-    // 1. yuyv to I420, since yuyv is a packed format, only plane format can be rotated; there will be data loss when rotating to plane.
-    uint32_t dst_width    = width;
-    uint32_t dst_height   = height;
-    uint8_t *dst_y        = dst;
-    uint32_t dst_stride_y = dst_width;
-    uint8_t *dst_u        = dst + dst_width * dst_height;
-    uint32_t dst_stride_u = dst_width / 2;
-    uint8_t *dst_v        = dst + dst_width * dst_height + (dst_width * dst_height) / 4;
-    uint32_t dst_stride_v = dst_width / 2;
-    libyuv::YUY2ToI420(src, static_cast<int>(width * 2), dst_y, static_cast<int>(dst_stride_y), dst_u, static_cast<int>(dst_stride_u), dst_v,
-                       static_cast<int>(dst_stride_v), static_cast<int>(dst_width), static_cast<int>(dst_height));
+void imageMirror(const uint32_t *src, uint32_t *dst, uint32_t width, uint32_t height) {
+    // the 4 byte pixels are reversed as ARGB ones
+    libyuv::ARGBMirror(reinterpret_cast<const uint8_t *>(src), static_cast<int>(width * 4), reinterpret_cast<uint8_t *>(dst), static_cast<int>(width * 4),
+                       static_cast<int>(width), static_cast<int>(height));
+}
 
-    // 2. rotate
-    uint8_t *src_y        = dst_y;
-    uint32_t src_stride_y = dst_stride_y;
-    uint8_t *src_u        = dst_u;
-    uint32_t src_stride_u = dst_stride_u;
-    uint8_t *src_v        = dst_v;
-    uint32_t src_stride_v = dst_stride_v;
-    if(rotationMode != libyuv::kRotate180) {
-        dst_width  = height;
-        dst_height = width;
-    }
-    std::swap(src, dst);
-    dst_y        = dst;
-    dst_stride_y = dst_width;
-    dst_u        = dst + dst_width * dst_height;
-    dst_stride_u = dst_width / 2;
-    dst_v        = dst + dst_width * dst_height + (dst_width * dst_height) / 4;
-    dst_stride_v = dst_width / 2;
-    libyuv::I420Rotate(src_y, static_cast<int>(src_stride_y), src_u, static_cast<int>(src_stride_u), src_v, static_cast<int>(src_stride_v), dst_y,
-                       static_cast<int>(dst_stride_y), dst_u, static_cast<int>(dst_stride_u), dst_v, static_cast<int>(dst_stride_v), static_cast<int>(width),
-                       static_cast<int>(height), rotationMode);
-
-    // 3.I420 to yuyv
-    src_y        = dst_y;
-    src_stride_y = dst_stride_y;
-    src_u        = dst_u;
-    src_stride_u = dst_stride_u;
-    src_v        = dst_v;
-    src_stride_v = dst_stride_v;
-    std::swap(src, dst);
-    uint8_t *dst_yuy2        = dst;
-    uint32_t dst_stride_yuy2 = dst_width * 2;
-    libyuv::I420ToYUY2(src_y, src_stride_y, src_u, src_stride_u, src_v, src_stride_v, dst_yuy2, dst_stride_yuy2, dst_width, dst_height);
-}
-
-void uyvyImageRotate(uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree) {
+void imageRotate(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree) {
     libyuv::RotationMode rotationMode;
+    if(!toRotationMode(rotateDegree, rotationMode)) {
+        return;
+    }
+    int dstStride = static_cast<int>(rotateDegree == 180 ? width : height);
+    libyuv::RotatePlane(src, static_cast<int>(width), dst, dstStride, static_cast<int>(width), static_cast<int>(height), rotationMode);
+}
+
+void imageRotate(const uint16_t *src, uint16_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree) {
     switch(rotateDegree) {
     case 90:
-        rotationMode = libyuv::kRotate90;
+    case 270:
+        rotatePlane16(src, dst, width, height, rotateDegree == 90);
         break;
     case 180:
-        rotationMode = libyuv::kRotate180;
-        break;
-    case 270:
-        rotationMode = libyuv::kRotate270;
+        for(uint32_t h = 0; h < height; h++) {
+            reverseRow16(src + static_cast<size_t>(height - 1 - h) * width, dst + static_cast<size_t>(h) * width, width);
+        }
         break;
     default:
         LOG_WARN_INTVL_THREAD("Unsupported rotate degree!");
-        return;
+        break;
     }
+}
 
-    // 1. uyvy to I420, since uyvy is a packed format, only plane format can be rotated; there will be data loss when rotating to plane.
-    uint32_t dst_width    = width;
-    uint32_t dst_height   = height;
-    uint8_t *dst_y        = dst;
-    uint32_t dst_stride_y = dst_width;
-    uint8_t *dst_u        = dst + dst_width * dst_height;
-    uint32_t dst_stride_u = dst_width / 2;
-    uint8_t *dst_v        = dst + dst_width * dst_height + (dst_width * dst_height) / 4;
-    uint32_t dst_stride_v = dst_width / 2;
-    libyuv::UYVYToI420(src, static_cast<int>(width * 2), dst_y, static_cast<int>(dst_stride_y), dst_u, static_cast<int>(dst_stride_u), dst_v,
-                       static_cast<int>(dst_stride_v), static_cast<int>(dst_width), static_cast<int>(dst_height));
+void rotateRGBImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree, uint32_t pixelSize) {
+    libyuv::RotationMode rotationMode;
+    if(!toRotationMode(rotateDegree, rotationMode)) {
+        return;
+    }
 
-    // 2. rotate
-    uint8_t *src_y        = dst_y;
-    uint32_t src_stride_y = dst_stride_y;
-    uint8_t *src_u        = dst_u;
-    uint32_t src_stride_u = dst_stride_u;
-    uint8_t *src_v        = dst_v;
-    uint32_t src_stride_v = dst_stride_v;
-    if(rotationMode != libyuv::kRotate180) {
-        dst_width  = height;
-        dst_height = width;
-    }
-    std::swap(src, dst);
-    dst_y        = dst;
-    dst_stride_y = dst_width;
-    dst_u        = dst + dst_width * dst_height;
-    dst_stride_u = dst_width / 2;
-    dst_v        = dst + dst_width * dst_height + (dst_width * dst_height) / 4;
-    dst_stride_v = dst_width / 2;
-    libyuv::I420Rotate(src_y, static_cast<int>(src_stride_y), src_u, static_cast<int>(src_stride_u), src_v, static_cast<int>(src_stride_v), dst_y,
-                       static_cast<int>(dst_stride_y), dst_u, static_cast<int>(dst_stride_u), dst_v, static_cast<int>(dst_stride_v), static_cast<int>(width),
-                       static_cast<int>(height), rotationMode);
-
-    // 3. I420 to uyvy
-    src_y        = dst_y;
-    src_stride_y = dst_stride_y;
-    src_u        = dst_u;
-    src_stride_u = dst_stride_u;
-    src_v        = dst_v;
-    src_stride_v = dst_stride_v;
-    std::swap(src, dst);
-    uint8_t *dst_uyvy        = dst;
-    uint32_t dst_stride_uyvy = dst_width * 2;
-    libyuv::I420ToUYVY(src_y, src_stride_y, src_u, src_stride_u, src_v, src_stride_v, dst_uyvy, dst_stride_uyvy, dst_width, dst_height);
+    int w = static_cast<int>(width);
+    int h = static_cast<int>(height);
+    if(pixelSize == 4) {
+        int dstWidth = rotateDegree == 180 ? w : h;
+        libyuv::ARGBRotate(src, w * 4, dst, dstWidth * 4, w, h, rotationMode);
+    }
+    else if(rotateDegree == 180) {
+        // a mirror of the image read bottom up, libyuv reads the source upside down for a negative height
+        libyuv::RGB24Mirror(src, w * 3, dst, w * 3, w, -h);
+    }
+    else {
+        rotateRGB24(src, dst, width, height, rotateDegree == 90);
+    }
 }
 
 FrameMirror::FrameMirror() {}
@@ -251,7 +448,7 @@ std::shared_ptr<Frame> FrameMirror::process(std::shared_ptr<const Frame> frame)
     }
 
     if(frame->is<FrameSet>()) {
-        auto outFrame = FrameFactory::createFrameFromOtherFrame(frame, true);
+        auto outFrame = FrameFactory::createFrameView(frame);
         return outFrame;
     }
 
@@ -261,32 +458,34 @@ std::shared_ptr<Frame> FrameMirror::process(std::shared_ptr<const Frame> frame)
     auto frameType       = frame->getType();
     switch(frame->getFormat()) {
     case OB_FORMAT_Y8:
-        imageMirror<uint8_t>((uint8_t *)videoFrame->getData(), (uint8_t *)outFrame->getData(), videoFrame->getWidth(), videoFrame->getHeight());
+        imageMirror(videoFrame->getData(), outFrame->getDataMutable(), videoFrame->getWidth(), videoFrame->getHeight());
         break;
     case OB_FORMAT_Y12C4:
     case OB_FORMAT_Y16:
-        imageMirror<uint16_t>((uint16_t *)videoFrame->getData(), (uint16_t *)outFrame->getData(), videoFrame->getWidth(), videoFrame->getHeight());
+        imageMirror(reinterpret_cast<const uint16_t *>(videoFrame->getData()), reinterpret_cast<uint16_t *>(outFrame->getDataMutable()),
+                    videoFrame->getWidth(), videoFrame->getHeight());
         break;
     case OB_FORMAT_YUYV:
         if(is_color_frame(frameType)) {
-            mirrorYUYVImage((uint8_t *)videoFrame->getData(), (uint8_t *)outFrame->getData(), videoFrame->getWidth(), videoFrame->getHeight());
+            mirrorYUYVImage(videoFrame->getData(), outFrame->getDataMutable(), videoFrame->getWidth(), videoFrame->getHeight());
         }
         else {
-            imageMirror<uint32_t>((uint32_t *)videoFrame->getData(), (uint32_t *)outFrame->getData(), videoFrame->getWidth() / 2, videoFrame->getHeight());
+            imageMirror(reinterpret_cast<const uint32_t *>(videoFrame->getData()), reinterpret_cast<uint32_t *>(outFrame->getDataMutable()),
+                        videoFrame->getWidth() / 2, videoFrame->getHeight());
         }
         break;
     case OB_FORMAT_UYVY:
         if(is_color_frame(frameType)) {
-            mirrorUYVYImage((uint8_t *)videoFrame->getData(), (uint8_t *)outFrame->getData(), videoFrame->getWidth(), videoFrame->getHeight());
+            mirrorUYVYImage(videoFrame->getData(), outFrame->getDataMutable(), videoFrame->getWidth(), videoFrame->getHeight());
         }
         break;
     case OB_FORMAT_RGB:
     case OB_FORMAT_BGR:
-        mirrorRGBImage((uint8_t *)videoFrame->getData(), (uint8_t *)outFrame->getData(), videoFrame->getWidth(), videoFrame->getHeight());
+        mirrorRGBImage(videoFrame->getData(), outFrame->getDataMutable(), videoFrame->getWidth(), videoFrame->getHeight());
         break;
     case OB_FORMAT_RGBA:
     case OB_FORMAT_BGRA:
-        mirrorRGBAImage((uint8_t *)videoFrame->getData(), (uint8_t *)outFrame->getData(), videoFrame->getWidth(), videoFrame->getHeight());
+        mirrorRGBAImage(videoFrame->getData(), outFrame->getDataMutable(), videoFrame->getWidth(), videoFrame->getHeight());
         break;
     default:
         isMirrorSupport = false;
@@ -380,11 +579,11 @@ std::shared_ptr<Frame> FrameFlip::process(std::shared_ptr<const Frame> frame) {
     }
 
     if(frame->is<FrameSet>()) {
-        auto outFrame = FrameFactory::createFrameFromOtherFrame(frame, true);
+        auto outFrame = FrameFactory::createFrameView(frame);
         return outFrame;
     }
 
-    auto outFrame = FrameFactory::createFrameFromOtherFrame(frame, true);
+    auto outFrame = FrameFactory::createFrameFromOtherFrame(frame);
 
     bool isSupportFlip = true;
     auto videoFrame    = frame->as<VideoFrame>();
@@ -493,7 +692,7 @@ std::shared_ptr<Frame> FrameRotate::process(std::shared_ptr<const Frame> frame)
     }
 
     if(frame->is<FrameSet>()) {
-        auto outFrame = FrameFactory::createFrameFromOtherFrame(frame, true);
+        auto outFrame = FrameFactory::createFrameView(frame);
         return outFrame;
     }
 
@@ -515,29 +714,26 @@ std::shared_ptr<Frame> FrameRotate::process(std::shared_ptr<const Frame> frame)
     auto                        videoFrame      = frame->as<VideoFrame>();
     switch(frame->getFormat()) {
     case OB_FORMAT_Y8:
-        imageRotate<uint8_t>((uint8_t *)videoFrame->getData(), (uint8_t *)outFrame->getData(), videoFrame->getWidth(), videoFrame->getHeight(), rotateDegree_);
+        imageRotate(videoFrame->getData(), outFrame->getDataMutable(), videoFrame->getWidth(), videoFrame->getHeight(), rotateDegree_);
         break;
     case OB_FORMAT_Y12C4:
     case OB_FORMAT_Y16:
-        imageRotate<uint16_t>((uint16_t *)videoFrame->getData(), (uint16_t *)outFrame->getData(), videoFrame->getWidth(), videoFrame->getHeight(),
-                              rotateDegree_);
+        imageRotate(reinterpret_cast<const uint16_t *>(videoFrame->getData()), reinterpret_cast<uint16_t *>(outFrame->getDataMutable()),
+                    videoFrame->getWidth(), videoFrame->getHeight(), rotateDegree_);
         break;
     case OB_FORMAT_YUYV:
-        // Note: This operation will also modify the data content of the original data frame.
-        yuyvImageRotate((uint8_t *)videoFrame->getData(), (uint8_t *)outFrame->getData(), videoFrame->getWidth(), videoFrame->getHeight(), rotateDegree_);
+        yuyvImageRotate(videoFrame->getData(), outFrame->getDataMutable(), videoFrame->getWidth(), videoFrame->getHeight(), rotateDegree_, yuvBuffer_);
         break;
     case OB_FORMAT_UYVY:
-        uyvyImageRotate((uint8_t *)videoFrame->getData(), (uint8_t *)outFrame->getData(), videoFrame->getWidth(), videoFrame->getHeight(), rotateDegree_);
+        uyvyImageRotate(videoFrame->getData(), outFrame->getDataMutable(), videoFrame->getWidth(), videoFrame->getHeight(), rotateDegree_, yuvBuffer_);
         break;
     case OB_FORMAT_RGB:
     case OB_FORMAT_BGR:
-        rotateRGBImage<uint8_t>((uint8_t *)videoFrame->getData(), (uint8_t *)outFrame->getData(), videoFrame->getWidth(), videoFrame->getHeight(),
-                                rotateDegree_, 3);
+        rotateRGBImage(videoFrame->getData(), outFrame->getDataMutable(), videoFrame->getWidth(), videoFrame->getHeight(), rotateDegree_, 3);
         break;
     case OB_FORMAT_RGBA:
     case OB_FORMAT_BGRA:
-        rotateRGBImage<uint8_t>((uint8_t *)videoFrame->getData(), (uint8_t *)outFrame->getData(), videoFrame->getWidth(), videoFrame->getHeight(),
-                                rotateDegree_, 4);
+        rotateRGBImage(videoFrame->getData(), outFrame->getDataMutable(), videoFrame->getWidth(), videoFrame->getHeight(), rotateDegree_, 4);
         break;
     default:
         isSupportRotate = false;
@@ -620,4 +816,131 @@ OBExtrinsic FrameRotate::rotateOBExtrinsic(uint32_t rotateDegree) {
     return { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0, 0, 0 } };
 }
 
+FrameCrop::FrameCrop() {}
+FrameCrop::~FrameCrop() noexcept {}
+
+void FrameCrop::updateConfig(std::vector<std::string> &params) {
+    if(params.size() != 4) {
+        THROW_INVALID_PARAM_EXCEPTION("Frame crop config error: params size not match");
+    }
+    try {
+        int x      = std::stoi(params[0]);
+        int y      = std::stoi(params[1]);
+        int width  = std::stoi(params[2]);
+        int height = std::stoi(params[3]);
+        if(x < 0 || y < 0 || width < 0 || height < 0) {
+            THROW_INVALID_PARAM_EXCEPTION("Frame crop config error: the region can not be negative");
+        }
+        std::lock_guard<std::mutex> cropLock(mtx_);
+        region_ = { static_cast<uint32_t>(x), static_cast<uint32_t>(y), static_cast<uint32_t>(width), static_cast<uint32_t>(height) };
+    }
+    catch(const libobsensor_exception &) {
+        throw;
+    }
+    catch(const std::exception &e) {
+        THROW_INVALID_PARAM_EXCEPTION("Frame crop config error: " + std::string(e.what()));
+    }
+}
+
+void FrameCrop::setConfigData(void *data, uint32_t size) {
+    utils::unusedVar(data);
+    utils::unusedVar(size);
+}
+
+const std::string &FrameCrop::getConfigSchema() const {
+    // csv format: name，type， min，max，step，default，description
+    static const std::string schema = "x, integer, 0, 65535, 1, 0, left of the crop region\n"
+                                      "y, integer, 0, 65535, 1, 0, top of the crop region\n"
+                                      "width, integer, 0, 65535, 1, 0, width of the crop region: 0 is up to the right of the frame\n"
+                                      "height, integer, 0, 65535, 1, 0, height of the crop region: 0 is up to the bottom of the frame\n";
+    return schema;
+}
+
+void FrameCrop::reset() {
+    srcStreamProfile_.reset();
+    rstStreamProfile_.reset();
+}
+
+std::shared_ptr<Frame> FrameCrop::process(std::shared_ptr<const Frame> frame) {
+    if(!frame) {
+        return nullptr;
+    }
+
+    if(frame->is<FrameSet>()) {
+        return FrameFactory::createFrameView(frame);
+    }
+
+    auto format = frame->getFormat();
+    if(packedPixelSize(format) == 0 && !isPlanarYUV(format)) {
+        LOG_WARN_INTVL("FrameCrop unsupported to process this format: {}", format);
+        return FrameFactory::createFrameView(frame);
+    }
+
+    std::lock_guard<std::mutex> cropLock(mtx_);
+    auto                        videoFrame = frame->as<VideoFrame>();
+    uint32_t                    width      = videoFrame->getWidth();
+    uint32_t                    height     = videoFrame->getHeight();
+
+    // The chroma of the YUV formats is shared by 2 pixels of a row, and by 2 rows for the planar ones.
+    uint32_t alignX = (format == OB_FORMAT_YUYV || format == OB_FORMAT_UYVY || isPlanarYUV(format)) ? 2 : 1;
+    uint32_t alignY = isPlanarYUV(format) ? 2 : 1;
+    OBRect   region = region_;
+    region.x -= region.x % alignX;
+    region.y -= region.y % alignY;
+    if(region.x >= width || region.y >= height) {
+        LOG_WARN_INTVL("FrameCrop region ({}, {}) is out of the {}x{} frame", region.x, region.y, width, height);
+        return FrameFactory::createFrameView(frame);
+    }
+    region.width  = region.width == 0 ? width - region.x : std::min(region.width, width - region.x);
+    region.height = region.height == 0 ? height - region.y : std::min(region.height, height - region.y);
+    region.width -= region.width % alignX;
+    region.height -= region.height % alignY;
+    if(region.width == 0 || region.height == 0 || (region.width == width && region.height == height)) {
+        return FrameFactory::createFrameView(frame);
+    }
+
+    auto streamProfile = frame->getStreamProfile();
+    if(!rstStreamProfile_ || srcStreamProfile_ != streamProfile || memcmp(&rstRegion_, &region, sizeof(OBRect)) != 0) {
+        srcStreamProfile_          = streamProfile;
+        rstRegion_                 = region;
+        auto srcVideoStreamProfile = srcStreamProfile_->as<VideoStreamProfile>();
+        rstStreamProfile_          = srcVideoStreamProfile->clone()->as<VideoStreamProfile>();
+        rstStreamProfile_->setWidth(region.width);
+        rstStreamProfile_->setHeight(region.height);
+
+        // A crop of a cropped frame is a crop of the frame that one was cropped from.
+        auto srcRegion = srcVideoStreamProfile->getCropRegion();
+        auto rstRegion = region;
+        if(srcRegion.width == width && srcRegion.height == height) {
+            rstRegion.x += srcRegion.x;
+            rstRegion.y += srcRegion.y;
+        }
+        rstStreamProfile_->setCropRegion(rstRegion);
+
+        // The crop does not move the camera, the extrinsics of the clone stay those of the source.
+        try {
+            rstStreamProfile_->bindIntrinsic(cropOBCameraIntrinsic(srcVideoStreamProfile->getIntrinsic(), region));
+        }
+        catch(libobsensor_exception &error) {
+            LOG_WARN_INTVL("Frame crop camera intrinsic conversion failed{0}, exception type: {1}", error.getMessage(), error.getExceptionType());
+        }
+    }
+
+    auto outFrame = FrameFactory::createFrameFromStreamProfile(rstStreamProfile_);
+    outFrame->copyInfoFromOther(frame);
+    outFrame->as<VideoFrame>()->setStride(0);  // the default stride of the region, not the one copied from the source
+    uint32_t srcStride = isPlanarYUV(format) ? width : videoFrame->getStride();
+    cropImage(format, videoFrame->getData(), srcStride, height, outFrame->getDataMutable(), region);
+    return outFrame;
+}
+
+OBCameraIntrinsic FrameCrop::cropOBCameraIntrinsic(const OBCameraIntrinsic &src, const OBRect &region) {
+    auto intrinsic = src;
+    intrinsic.cx -= static_cast<float>(region.x);
+    intrinsic.cy -= static_cast<float>(region.y);
+    intrinsic.width  = static_cast<int16_t>(region.width);
+    intrinsic.height = static_cast<int16_t>(region.height);
+    return intrinsic;
+}
+
 }  // namespace libobsensor
@@ -7,32 +7,27 @@
 #include "logger/LoggerInterval.hpp"
 
 #include <mutex>
+#include <vector>
 #include <thread>
 #include <atomic>
 
 namespace libobsensor {
+// Image kernels of the geometric transforms, the images are packed without padding. The rotations are clockwise; the 90 and 270 degree
+// rotations are done per block of the output, so both the source lines and the output lines of a block stay in the cache.
 void mirrorRGBImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height);
 void mirrorRGBAImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height);
-void mirrorYUYVImage(uint8_t *src, uint8_t *dst, int width, int height);
+void mirrorYUYVImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height);
+void mirrorUYVYImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height);
 void flipRGBImage(int pixelSize, const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height);
-void yuyvImageRotate(uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree);
+// the packed YUV formats are rotated through I420, buffer holds the rotated I420 image
+void yuyvImageRotate(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree, std::vector<uint8_t> &buffer);
+void uyvyImageRotate(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree, std::vector<uint8_t> &buffer);
 
-template <typename T> void imageMirror(const T *src, T *dst, uint32_t width, uint32_t height) {
-    const T *srcPixel;
-    T       *dstPixel = dst;
-    for(uint32_t h = 0; h < height; h++) {
-        srcPixel = src + (h + 1) * width - 1;
-        for(uint32_t w = 0; w < width; w++) {
-            // mirror row
-            *dstPixel = *srcPixel;
-            srcPixel--;
-            dstPixel++;
-        }
-    }
-}
+void imageMirror(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height);
+void imageMirror(const uint16_t *src, uint16_t *dst, uint32_t width, uint32_t height);
+void imageMirror(const uint32_t *src, uint32_t *dst, uint32_t width, uint32_t height);
 
 template <typename T> void imageFlip(const T *src, T *dst, uint32_t width, uint32_t height) {
-
     const T *flipSrc = src + (width * height);
     for(uint32_t h = 0; h < height; h++) {
         flipSrc -= width;
@@ -41,108 +36,9 @@ template <typename T> void imageFlip(const T *src, T *dst, uint32_t width, uint3
     }
 }
 
-// #define imageRotate180 imageFlip
-
-// Rotate 90 degrees clockwise
-template <typename T> void imageRotate90(const T *src, T *dst, uint32_t width, uint32_t height) {
-    const T *srcPixel;
-    T       *dstPixel = dst;
-    for(uint32_t h = 0; h < width; h++) {
-        for(uint32_t w = 0; w < height; w++) {
-            srcPixel  = src + width * (height - w - 1) + h;
-            *dstPixel = *srcPixel;
-            dstPixel++;
-        }
-    }
-}
-
-template <typename T> void imageRotate180(const T *src, T *dst, uint32_t width, uint32_t height) {
-    const T *srcPixel;
-    T       *dstPixel = dst;
-    for(uint32_t h = 0; h < height; h++) {
-        for(uint32_t w = 0; w < width; w++) {
-            srcPixel  = src + width * (height - h - 1) + (width - w - 1);
-            *dstPixel = *srcPixel;
-            dstPixel++;
-        }
-    }
-}
-
-template <typename T> void imageRotate270(const T *src, T *dst, uint32_t width, uint32_t height) {
-    const T *srcPixel;
-    T       *dstPixel = dst;
-    for(uint32_t h = 0; h < width; h++) {
-        for(uint32_t w = 0; w < height; w++) {
-            srcPixel  = src + width * w + (width - h - 1);
-            *dstPixel = *srcPixel;
-            dstPixel++;
-        }
-    }
-}
-
-template <typename T> void imageRotate(const T *src, T *dst, uint32_t width, uint32_t height, uint32_t rotateDegree) {
-    switch(rotateDegree) {
-    case 90:
-        imageRotate90<T>(src, dst, width, height);
-        break;
-    case 180:
-        imageRotate180<T>(src, dst, width, height);
-        break;
-    case 270:
-        imageRotate270<T>(src, dst, width, height);
-        break;
-    default:
-        LOG_WARN_INTVL_THREAD("Unsupported rotate degree!");
-        break;
-    }
-}
-
-template <typename T> void rgbImageRotate90(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t pixelSize) {
-    for(uint32_t h = 0; h < width; h++) {
-        for(uint32_t w = 0; w < height; w++) {
-            const uint8_t *srcPixel = src + (height - w - 1) * width * pixelSize + h * pixelSize;
-            uint8_t       *dstPixel = dst + h * height * pixelSize + w * pixelSize;
-            memcpy(dstPixel, srcPixel, pixelSize);
-        }
-    }
-}
-
-template <typename T> void rgbImageRotate180(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t pixelSize) {
-    for(uint32_t h = 0; h < height; h++) {
-        for(uint32_t w = 0; w < width; w++) {
-            const uint8_t *srcPixel = src + (height - h - 1) * width * pixelSize + (width - w - 1) * pixelSize;
-            uint8_t       *dstPixel = dst + h * width * pixelSize + w * pixelSize;
-            memcpy(dstPixel, srcPixel, pixelSize);
-        }
-    }
-}
-
-template <typename T> void rgbImageRotate270(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t pixelSize) {
-    for(uint32_t h = 0; h < width; h++) {
-        for(uint32_t w = 0; w < height; w++) {
-            const T *srcPixel = src + ((w * width + h) * pixelSize);
-            T       *dstPixel = dst + (((width - h - 1) * height + w) * pixelSize);
-            memcpy(dstPixel, srcPixel, pixelSize * sizeof(T));
-        }
-    }
-}
-
-template <typename T> void rotateRGBImage(const T *src, T *dst, uint32_t width, uint32_t height, uint32_t rotateDegree, uint32_t pixelSize) {
-    switch(rotateDegree) {
-    case 90:
-        rgbImageRotate90<T>(src, dst, width, height, pixelSize);
-        break;
-    case 180:
-        rgbImageRotate180<T>(src, dst, width, height, pixelSize);
-        break;
-    case 270:
-        rgbImageRotate270<T>(src, dst, width, height, pixelSize);
-        break;
-    default:
-        LOG_WARN_INTVL_THREAD("Unsupported rotate degree!");
-        break;
-    }
-}
+void imageRotate(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree);
+void imageRotate(const uint16_t *src, uint16_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree);
+void rotateRGBImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree, uint32_t pixelSize);
 
 class FrameMirror : public IFilterBase {
 public:
@@ -209,5 +105,31 @@ protected:
     std::atomic<bool>                    rotateDegreeUpdated_;
     std::shared_ptr<const StreamProfile> srcStreamProfile_;
     std::shared_ptr<VideoStreamProfile>  rstStreamProfile_;
+    std::vector<uint8_t>                 yuvBuffer_;
+};
+
+// Crops the frames to a region of interest. The intrinsic follows the region and the region is recorded in the stream profile, so the filters after
+// this one (Align, PointCloudFilter, DecimationFilter, FormatConverter, ...) only process the region.
+class FrameCrop : public IFilterBase {
+public:
+    FrameCrop();
+    virtual ~FrameCrop() noexcept override;
+
+    void               updateConfig(std::vector<std::string> &params) override;
+    void               setConfigData(void *data, uint32_t size) override;
+    const std::string &getConfigSchema() const override;
+    void               reset() override;
+
+private:
+    std::shared_ptr<Frame> process(std::shared_ptr<const Frame> frame) override;
+
+    static OBCameraIntrinsic cropOBCameraIntrinsic(const OBCameraIntrinsic &src, const OBRect &region);
+
+protected:
+    std::mutex                           mtx_;
+    OBRect                               region_{ 0, 0, 0, 0 };
+    std::shared_ptr<const StreamProfile> srcStreamProfile_;
+    std::shared_ptr<VideoStreamProfile>  rstStreamProfile_;
+    OBRect                               rstRegion_{ 0, 0, 0, 0 };
 };
 }  // namespace libobsensor
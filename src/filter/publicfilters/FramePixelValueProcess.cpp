@@ -99,7 +99,7 @@ const std::string &PixelValueScaler::getConfigSchema() const {
 std::shared_ptr<Frame> PixelValueScaler::process(std::shared_ptr<const Frame> frame) {
     if(frame->getType() != OB_FRAME_DEPTH) {
         LOG_WARN_INTVL("PixelValueScaler unsupported to process this frame type: {}", frame->getType());
-        return FrameFactory::createFrameFromOtherFrame(frame);
+        return FrameFactory::createFrameView(frame);
     }
 
     std::lock_guard<std::mutex> scaleLock(mtx_);
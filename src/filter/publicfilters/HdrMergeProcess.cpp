@@ -176,14 +176,14 @@ std::shared_ptr<Frame> HDRMerge::process(std::shared_ptr<const Frame> frame) {
 
     if(!depthFrame) {
         LOG_WARN_INTVL("No depth frame found, hdrMerge unsupported to process this frame");
-        std::shared_ptr<Frame> outFrame = FrameFactory::createFrameFromOtherFrame(frame, true);
+        std::shared_ptr<Frame> outFrame = FrameFactory::createFrameView(frame);
         return outFrame;
     }
     try {
         auto depthSeqSize = depthFrame->getMetadataValue(OB_FRAME_METADATA_TYPE_HDR_SEQUENCE_SIZE);
         if(depthSeqSize != 2) {
             LOG_WARN_INTVL("HDRMerge unsupported to process this frame with sequence size: {}", depthSeqSize);
-            std::shared_ptr<Frame> outFrame = FrameFactory::createFrameFromOtherFrame(frame, true);
+            std::shared_ptr<Frame> outFrame = FrameFactory::createFrameView(frame);
             return outFrame;
         }
 
@@ -320,7 +320,7 @@ std::shared_ptr<Frame> HDRMerge::merge(std::shared_ptr<const Frame> first_fs, st
         return newFrame;
     }
 
-    return FrameFactory::createFrameFromOtherFrame(first_fs, true);
+    return FrameFactory::createFrameView(first_fs);
 }
 
 }  // namespace libobsensor
@@ -66,11 +66,12 @@ std::shared_ptr<Frame> IMUCorrector::process(std::shared_ptr<const Frame> frame)
         return nullptr;
     }
 
-    auto newFrame = FrameFactory::createFrameFromOtherFrame(frame, true);
     if(!frame->is<FrameSet>()) {
-        return newFrame;
+        return FrameFactory::createFrameView(frame);
     }
 
+    auto newFrame = FrameFactory::createFrameFromOtherFrame(frame, true);
+
     auto frameSet   = newFrame->as<FrameSet>();
     auto accelFrame = frameSet->getFrame(OB_FRAME_ACCEL);
     if(accelFrame) {
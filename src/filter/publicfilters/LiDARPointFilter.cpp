@@ -8,6 +8,19 @@
 #include "stream/StreamProfile.hpp"
 #include "InternalTypes.hpp"
 #include "utils/Utils.hpp"
+#include "utils/WorkerPool.hpp"
+
+#if defined(__ARM_NEON__) || defined(__NEON__) || defined(__SSSE3__)
+#if(defined(__ARM_NEON__) || defined(__aarch64__) || defined(__arm__))
+#include "SSE2NEON.h"
+#else
+#include <emmintrin.h>
+#endif
+#define LIDAR_POINT_FILTER_SIMD
+#endif
+
+#include <algorithm>
+#include <cmath>
 
 namespace libobsensor {
 
@@ -27,7 +40,7 @@ static std::unordered_map<uint32_t, LiDARFilterThreshold> LIDAR_FILTER_THRESHOLD
     { 5, { 1, 2, 0.0175f } },  // filterLevel_ = 5
 };
 
-LiDARPointFilter::LiDARPointFilter() : filterLevel_(0), kernelSize_(5) {}
+LiDARPointFilter::LiDARPointFilter() : filterLevel_(0), kernelSize_(5), workerPool_(WorkerPool::getInstance()) {}
 
 LiDARPointFilter::~LiDARPointFilter() {
     cacheDistanceTrans_.clear();
@@ -63,6 +76,11 @@ std::shared_ptr<Frame> LiDARPointFilter::process(std::shared_ptr<const Frame> fr
         return nullptr;
     }
 
+    // no filter
+    if(filterLevel_ <= 0) {
+        return FrameFactory::createFrameView(frame);
+    }
+
     auto lidarProfile = frame->getStreamProfile()->as<LiDARStreamProfile>()->getInfo();
     auto outFrame     = FrameFactory::createFrameFromOtherFrame(frame, true);
 
@@ -70,20 +88,106 @@ std::shared_ptr<Frame> LiDARPointFilter::process(std::shared_ptr<const Frame> fr
     auto     spherePointPtr   = reinterpret_cast<OBLiDARSpherePoint *>(outFrame->getDataMutable());
     uint32_t totalPointNumber = lidarProfile.maxDataBlockNum * lidarProfile.pointsNum;
 
-    // no filter
-    if(filterLevel_ <= 0) {
-        return outFrame;
-    }
-
     frameDataFilter(spherePointPtr, pointCount, totalPointNumber);
     return outFrame;
 }
 
-void LiDARPointFilter::frameDataFilter(OBLiDARSpherePoint *pointData, uint32_t pointCount, uint32_t totalPointNumber) {
+namespace {
+
+constexpr float MY_PI     = 3.14159265358979323846f;
+constexpr float DEG_2_RAD = MY_PI / 180.0f;
 
-    constexpr float MY_PI     = 3.14159265358979323846f;
-    constexpr float DEG_2_RAD = MY_PI / 180.0f;
+// phi of the sphere points is converted from 0.01 degree units, so the cosine of every phi in [-90, 90] degrees is computed once
+constexpr int   COS_TABLE_HALF_SIZE = 9000;
+constexpr float PHI_UNIT            = 0.01f;
 
+// below this number of points per segment the filter runs on the calling thread only
+constexpr uint32_t MIN_POINTS_PER_SEGMENT = 8192;
+
+// |sin / diff| < threshold is tested as |sin| < threshold * |diff|. Only products within this relative margin of |sin| can round to the other
+// side of the division, those fall back to the division so the result is the same
+constexpr float COMPARE_MARGIN_LOW  = 1.0f - 1e-5f;
+constexpr float COMPARE_MARGIN_HIGH = 1.0f + 1e-5f;
+
+const std::vector<float> &getCosTable() {
+    static const std::vector<float> table = [] {
+        std::vector<float> values(COS_TABLE_HALF_SIZE * 2 + 1);
+        for(int i = -COS_TABLE_HALF_SIZE; i <= COS_TABLE_HALF_SIZE; i++) {
+            auto phi                        = static_cast<float>(i) * PHI_UNIT;
+            values[i + COS_TABLE_HALF_SIZE] = std::cos(phi * DEG_2_RAD);
+        }
+        return values;
+    }();
+    return table;
+}
+
+inline float cosOfPhi(const std::vector<float> &cosTable, float phi) {
+    if(std::abs(phi) <= COS_TABLE_HALF_SIZE * PHI_UNIT) {
+        // the index is only a guess, it is used when it gives back exactly the same phi
+        auto index = static_cast<int>(phi * (1.0f / PHI_UNIT) + (phi < 0 ? -0.5f : 0.5f));
+        if(static_cast<float>(index) * PHI_UNIT == phi) {
+            return cosTable[index + COS_TABLE_HALF_SIZE];
+        }
+    }
+    return std::cos(phi * DEG_2_RAD);
+}
+
+// distance * cos(phi) of every point, the horizontal distance the kernel works on
+void transformDistances(const OBLiDARSpherePoint *pointData, float *trans, uint32_t pointCount) {
+    auto    &cosTable = getCosTable();
+    uint32_t i        = 0;
+
+#ifdef LIDAR_POINT_FILTER_SIMD
+    const float *cosCenter = cosTable.data() + COS_TABLE_HALF_SIZE;
+    const __m128 signMask  = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128 maxPhi    = _mm_set1_ps(COS_TABLE_HALF_SIZE * PHI_UNIT);
+    const __m128 unit      = _mm_set1_ps(PHI_UNIT);
+    const __m128 invUnit   = _mm_set1_ps(1.0f / PHI_UNIT);
+    for(; i + 4 <= pointCount; i += 4) {
+        const auto *p     = pointData + i;
+        auto        phi   = _mm_set_ps(p[3].phi, p[2].phi, p[1].phi, p[0].phi);
+        auto        index = _mm_cvtps_epi32(_mm_mul_ps(phi, invUnit));
+        auto        exact = _mm_and_ps(_mm_cmple_ps(_mm_and_ps(phi, signMask), maxPhi), _mm_cmpeq_ps(_mm_mul_ps(_mm_cvtepi32_ps(index), unit), phi));
+        if(_mm_movemask_ps(exact) != 0xF) {
+            for(int k = 0; k < 4; k++) {
+                trans[i + k] = p[k].distance * cosOfPhi(cosTable, p[k].phi);
+            }
+            continue;
+        }
+        alignas(16) int32_t indexes[4];
+        _mm_store_si128(reinterpret_cast<__m128i *>(indexes), index);
+        auto cosPhi   = _mm_set_ps(cosCenter[indexes[3]], cosCenter[indexes[2]], cosCenter[indexes[1]], cosCenter[indexes[0]]);
+        auto distance = _mm_set_ps(p[3].distance, p[2].distance, p[1].distance, p[0].distance);
+        _mm_storeu_ps(trans + i, _mm_mul_ps(distance, cosPhi));
+    }
+#endif
+
+    for(; i < pointCount; i++) {
+        trans[i] = pointData[i].distance * cosOfPhi(cosTable, pointData[i].phi);
+    }
+}
+
+inline bool isTanAngleAbnormal(float centerSin, float diff, float tanAngleThreshold) {
+    auto limit  = tanAngleThreshold * std::abs(diff);
+    auto absSin = std::abs(centerSin);
+    if(absSin < limit * COMPARE_MARGIN_LOW) {
+        return true;
+    }
+    if(absSin > limit * COMPARE_MARGIN_HIGH) {
+        return false;
+    }
+    auto tanAngle = centerSin / diff;
+    return (tanAngle < tanAngleThreshold) && (tanAngle > -tanAngleThreshold);
+}
+
+inline bool isAbnormalCount(uint32_t sumLeftAbnormal, uint32_t sumRightAbnormal, uint32_t pointNumThreshold) {
+    // the point is only marked when a neighbor is abnormal, even if the threshold is 0
+    return (sumLeftAbnormal + sumRightAbnormal > 0) && ((sumLeftAbnormal >= pointNumThreshold) || (sumRightAbnormal >= pointNumThreshold));
+}
+
+}  // namespace
+
+void LiDARPointFilter::frameDataFilter(OBLiDARSpherePoint *pointData, uint32_t pointCount, uint32_t totalPointNumber) {
     // TODO: obtain from the lidar device
     const constexpr float       startAngle = 45;
     const constexpr float       stopAngle  = 315;
@@ -91,58 +195,141 @@ void LiDARPointFilter::frameDataFilter(OBLiDARSpherePoint *pointData, uint32_t p
     const LiDARFilterThreshold &threshold  = LIDAR_FILTER_THRESHOLD_MAP[filterLevel_];
 
     const float angleResolution = angleRange / totalPointNumber * DEG_2_RAD;
-    const float angleResSin     = std::sin(angleResolution);
-    const float angleResCos     = std::cos(angleResolution);
+
+    KernelParams params;
+    params.halfKernelSize    = kernelSize_ >> 1;
+    params.pointNumThreshold = threshold.pointNumThreshold;
+    params.tanAngleThreshold = threshold.tanAngleThreshold;
+    params.angleResSin       = std::sin(angleResolution);
+    params.angleResCos       = std::cos(angleResolution);
+
+    if(pointCount <= params.halfKernelSize * 2) {
+        return;
+    }
 
     if(cacheDistanceTrans_.size() < pointCount) {
         cacheDistanceTrans_.resize(pointCount);
+        abnormalFlags_.resize(pointCount);
     }
 
-    for(uint32_t i = 0; i < pointCount; i++) {
-        const auto &centerCosPhi = std::cos(pointData[i].phi * DEG_2_RAD);
-        cacheDistanceTrans_[i]   = pointData[i].distance * centerCosPhi;
-    }
+    transformDistances(pointData, cacheDistanceTrans_.data(), pointCount);
 
-    uint32_t sumLeftAbnormal  = 0;
-    uint32_t sumRightAbnormal = 0;
-    uint32_t halfKernelSize   = kernelSize_ >> 1;
+    // The kernel only reads the cached distances, so the scan is split into segments that are marked in parallel; every segment also
+    // reads the half kernel of points around it. The abnormal points and their neighbors are cleared afterwards.
+    uint32_t begin    = params.halfKernelSize;
+    uint32_t end      = pointCount - params.halfKernelSize;
+    uint32_t segments = std::max(1u, std::min(workerPool_->getConcurrency(), (end - begin) / MIN_POINTS_PER_SEGMENT));
+    uint32_t segSize  = (end - begin + segments - 1) / segments;
+
+    workerPool_->parallelFor(segments, [&](uint32_t seg) {
+        auto segBegin = begin + seg * segSize;
+        auto segEnd   = std::min(end, segBegin + segSize);
+        if(segBegin < segEnd) {
+            markAbnormalPoints(params, segBegin, segEnd);
+        }
+    });
 
-    float pointDistanceCenterCos = 0;
-    float pointDistanceCenterSin = 0;
-    float pointDistanceCmp       = 0;
+    for(uint32_t i = begin; i < end; i++) {
+        if(abnormalFlags_[i]) {
+            for(int num = (-threshold.neighbors); num <= threshold.neighbors; num++) {
+                pointData[i + num].distance = 0.f;
+            }
+        }
+    }
+}
 
-    for(uint32_t i = halfKernelSize; i < (pointCount - halfKernelSize); i++) {
-        sumLeftAbnormal  = 0;
-        sumRightAbnormal = 0;
+void LiDARPointFilter::markAbnormalPoints(const KernelParams &params, uint32_t begin, uint32_t end) {
+    const float *trans = cacheDistanceTrans_.data();
+    uint8_t     *flags = abnormalFlags_.data();
+    uint32_t     half  = params.halfKernelSize;
+    uint32_t     i     = begin;
 
-        pointDistanceCenterCos = cacheDistanceTrans_[i] * angleResCos;
-        pointDistanceCenterSin = cacheDistanceTrans_[i] * angleResSin;
+#ifdef LIDAR_POINT_FILTER_SIMD
+    const __m128  signMask      = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128  eps           = _mm_set1_ps(EPS);
+    const __m128  resCos        = _mm_set1_ps(params.angleResCos);
+    const __m128  resSin        = _mm_set1_ps(params.angleResSin);
+    const __m128  tanThreshold  = _mm_set1_ps(params.tanAngleThreshold);
+    const __m128  marginLow     = _mm_set1_ps(COMPARE_MARGIN_LOW);
+    const __m128  marginHigh    = _mm_set1_ps(COMPARE_MARGIN_HIGH);
+    const __m128i zero          = _mm_setzero_si128();
+    const __m128i countMinusOne = _mm_set1_epi32(static_cast<int32_t>(params.pointNumThreshold) - 1);
 
-        for(uint32_t j = i - halfKernelSize; j < (i + halfKernelSize); j++) {
+    for(; i + 4 <= end; i += 4) {
+        auto center    = _mm_loadu_ps(trans + i);
+        auto valid     = _mm_cmpnlt_ps(_mm_and_ps(center, signMask), eps);  // no filtering for the points with distance 0
+        auto centerCos = _mm_mul_ps(center, resCos);
+        auto centerSin = _mm_mul_ps(center, resSin);
+        auto absSin    = _mm_and_ps(centerSin, signMask);
 
-            // To avoid comparing the point cloud to be detected with itself, no filtering is performed
-            // when the distance of the current point cloud to be detected is 0.
-            if((j == i) || (std::abs(cacheDistanceTrans_[i]) < EPS)) {
+        auto sumLeft  = zero;
+        auto sumRight = zero;
+        for(uint32_t offset = 0; offset < half * 2; offset++) {
+            if(offset == half) {
                 continue;
             }
+            auto diff       = _mm_sub_ps(_mm_loadu_ps(trans + i - half + offset), centerCos);
+            auto limit      = _mm_mul_ps(tanThreshold, _mm_and_ps(diff, signMask));
+            auto abnormal   = _mm_cmplt_ps(absSin, _mm_mul_ps(limit, marginLow));
+            auto unsure     = _mm_andnot_ps(abnormal, _mm_cmpngt_ps(absSin, _mm_mul_ps(limit, marginHigh)));
+            auto unsureMask = _mm_movemask_ps(_mm_and_ps(unsure, valid));
+            if(unsureMask) {
+                alignas(16) float diffs[4];
+                alignas(16) float sins[4];
+                alignas(16) int   results[4];
+                _mm_store_ps(diffs, diff);
+                _mm_store_ps(sins, centerSin);
+                _mm_store_si128(reinterpret_cast<__m128i *>(results), _mm_castps_si128(abnormal));
+                for(int k = 0; k < 4; k++) {
+                    if(unsureMask & (1 << k)) {
+                        results[k] = isTanAngleAbnormal(sins[k], diffs[k], params.tanAngleThreshold) ? -1 : 0;
+                    }
+                }
+                abnormal = _mm_castsi128_ps(_mm_load_si128(reinterpret_cast<const __m128i *>(results)));
+            }
+            // the mask lanes are -1 for abnormal neighbors
+            if(offset < half) {
+                sumLeft = _mm_sub_epi32(sumLeft, _mm_castps_si128(abnormal));
+            }
+            else {
+                sumRight = _mm_sub_epi32(sumRight, _mm_castps_si128(abnormal));
+            }
+        }
 
-            pointDistanceCmp      = cacheDistanceTrans_[j];
-            const float &diff     = pointDistanceCmp - pointDistanceCenterCos;
-            auto         tanAngle = pointDistanceCenterSin / diff;
+        auto reached  = _mm_or_si128(_mm_cmpgt_epi32(sumLeft, countMinusOne), _mm_cmpgt_epi32(sumRight, countMinusOne));
+        auto any      = _mm_cmpgt_epi32(_mm_add_epi32(sumLeft, sumRight), zero);
+        auto flagMask = _mm_movemask_ps(_mm_and_ps(valid, _mm_castsi128_ps(_mm_and_si128(reached, any))));
+        flags[i]      = static_cast<uint8_t>((flagMask >> 0) & 1);
+        flags[i + 1]  = static_cast<uint8_t>((flagMask >> 1) & 1);
+        flags[i + 2]  = static_cast<uint8_t>((flagMask >> 2) & 1);
+        flags[i + 3]  = static_cast<uint8_t>((flagMask >> 3) & 1);
+    }
+#endif
 
-            if((tanAngle < threshold.tanAngleThreshold) && (tanAngle > -threshold.tanAngleThreshold)) {
+    for(; i < end; i++) {
+        flags[i] = 0;
+        // To avoid comparing the point cloud to be detected with itself, no filtering is performed
+        // when the distance of the current point cloud to be detected is 0.
+        if(std::abs(trans[i]) < EPS) {
+            continue;
+        }
+
+        uint32_t sumLeftAbnormal        = 0;
+        uint32_t sumRightAbnormal       = 0;
+        float    pointDistanceCenterCos = trans[i] * params.angleResCos;
+        float    pointDistanceCenterSin = trans[i] * params.angleResSin;
+        for(uint32_t j = i - half; j < (i + half); j++) {
+            if(j == i) {
+                continue;
+            }
+            if(isTanAngleAbnormal(pointDistanceCenterSin, trans[j] - pointDistanceCenterCos, params.tanAngleThreshold)) {
                 if(j < i)
                     sumLeftAbnormal++;
                 else
                     sumRightAbnormal++;
-
-                if((sumLeftAbnormal >= threshold.pointNumThreshold) || (sumRightAbnormal >= threshold.pointNumThreshold)) {
-                    for(int num = (-threshold.neighbors); num <= threshold.neighbors; num++) {
-                        pointData[i + num].distance = 0.f;
-                    }
-                }
             }
         }
+        flags[i] = isAbnormalCount(sumLeftAbnormal, sumRightAbnormal, params.pointNumThreshold) ? 1 : 0;
     }
 }
 
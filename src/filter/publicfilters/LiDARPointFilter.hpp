@@ -6,7 +6,10 @@
 #include "libobsensor/h/ObTypes.h"
 // #include "IProperty.hpp"
 #include "InternalTypes.hpp"
+#include "utils/WorkerPool.hpp"
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace libobsensor {
 
@@ -24,12 +27,25 @@ private:
     std::shared_ptr<Frame> process(std::shared_ptr<const Frame> frame) override;
     void                   frameDataFilter(OBLiDARSpherePoint *pointData, uint32_t pointCount, uint32_t totalPointNumber);
 
+    struct KernelParams {
+        uint32_t halfKernelSize;
+        uint32_t pointNumThreshold;
+        float    tanAngleThreshold;
+        float    angleResSin;
+        float    angleResCos;
+    };
+    // mark the abnormal points with center index in [begin, end), reads the distances of the neighbors outside of the range as well
+    void markAbnormalPoints(const KernelParams &params, uint32_t begin, uint32_t end);
+
 private:
     std::recursive_mutex paramsMutex_;
 
-    uint32_t           filterLevel_;
-    uint32_t           kernelSize_;
-    std::vector<float> cacheDistanceTrans_;
+    uint32_t             filterLevel_;
+    uint32_t             kernelSize_;
+    std::vector<float>   cacheDistanceTrans_;
+    std::vector<uint8_t> abnormalFlags_;
+
+    std::shared_ptr<WorkerPool> workerPool_;  // marks the segments of a scan in parallel
 };
 
 }  // namespace libobsensor
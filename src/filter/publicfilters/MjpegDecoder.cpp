@@ -0,0 +1,285 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#include "MjpegDecoder.hpp"
+#include <turbojpeg.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace libobsensor {
+
+// JPEG markers
+const uint8_t JPEG_MARKER_SOF0 = 0xC0;
+const uint8_t JPEG_MARKER_SOF1 = 0xC1;
+const uint8_t JPEG_MARKER_DHT  = 0xC4;
+const uint8_t JPEG_MARKER_RST0 = 0xD0;
+const uint8_t JPEG_MARKER_RST7 = 0xD7;
+const uint8_t JPEG_MARKER_SOI  = 0xD8;
+const uint8_t JPEG_MARKER_EOI  = 0xD9;
+const uint8_t JPEG_MARKER_SOS  = 0xDA;
+const uint8_t JPEG_MARKER_DRI  = 0xDD;
+
+const uint32_t MAX_DECODE_SLICES       = 4;   // leave some cores to the other streams and filters
+const uint32_t MIN_MCU_ROWS_PER_SLICE  = 16;  // below that the thread hand-off costs more than the decode
+const size_t   MAX_SLICE_HEADER_LENGTH = 64 * 1024;
+
+namespace {
+
+uint16_t readBigEndian16(const uint8_t *data) {
+    return static_cast<uint16_t>((data[0] << 8) | data[1]);
+}
+
+uint32_t greatestCommonDivisor(uint32_t a, uint32_t b) {
+    while(b != 0) {
+        auto t = a % b;
+        a      = b;
+        b      = t;
+    }
+    return a;
+}
+
+}  // namespace
+
+MjpegDecoder::MjpegDecoder() : workerPool_(WorkerPool::getInstance()) {
+    maxSlices_ = std::max(1u, std::min(workerPool_->getConcurrency(), MAX_DECODE_SLICES));
+}
+
+MjpegDecoder::~MjpegDecoder() noexcept {
+    for(auto handle: handles_) {
+        if(handle) {
+            tjDestroy(handle);
+        }
+    }
+}
+
+void MjpegDecoder::setMaxSlices(uint32_t maxSlices) {
+    maxSlices_ = std::max(1u, maxSlices);
+}
+
+const char *MjpegDecoder::getLastError() const {
+    return tjGetErrorStr2(lastErrorHandle_);
+}
+
+void *MjpegDecoder::getHandle(size_t index) {
+    if(handles_.size() <= index) {
+        handles_.resize(index + 1, nullptr);
+    }
+    if(!handles_[index]) {
+        handles_[index] = tjInitDecompress();
+    }
+    return handles_[index];
+}
+
+bool MjpegDecoder::decode(const uint8_t *src, uint32_t srcLen, uint8_t *target, uint32_t width, uint32_t pitch, uint32_t height, int pixelFormat,
+                          int flags) {
+    if(pitch == 0) {
+        pitch = width * tjPixelSize[pixelFormat];
+    }
+
+    if(maxSlices_ > 1 && parseScanLayout(src, srcLen) && layout_.width == width && layout_.height == height
+       && decodeSlices(src, target, pitch, pixelFormat, flags)) {
+        return true;
+    }
+
+    // frames without restart markers or too small to split are decoded as a whole, and so are the frames a slice failed to decode, to report
+    // the error of the whole frame
+    auto handle      = getHandle(0);
+    lastErrorHandle_ = handle;
+    if(!handle) {
+        return false;
+    }
+    return tjDecompress2(handle, src, srcLen, target, static_cast<int>(width), static_cast<int>(pitch), static_cast<int>(height), pixelFormat, flags) == 0;
+}
+
+bool MjpegDecoder::parseScanLayout(const uint8_t *src, size_t srcLen) {
+    auto &layout = layout_;
+    layout.segmentBegins.clear();
+    layout.segmentEnds.clear();
+    layout.sofOffset       = 0;
+    layout.scanOffset      = 0;
+    layout.restartInterval = 0;
+
+    if(srcLen < 4 || src[0] != 0xFF || src[1] != JPEG_MARKER_SOI) {
+        return false;
+    }
+
+    // the marker segments of the header, up to the start of the scan
+    uint32_t componentCount = 0;
+    size_t   pos            = 2;
+    while(layout.scanOffset == 0) {
+        while(pos + 1 < srcLen && src[pos] == 0xFF && src[pos + 1] == 0xFF) {
+            pos++;  // fill bytes
+        }
+        if(pos + 4 > srcLen || src[pos] != 0xFF || pos > MAX_SLICE_HEADER_LENGTH) {
+            return false;
+        }
+        auto   marker = src[pos + 1];
+        size_t length = readBigEndian16(src + pos + 2);
+        if(length < 2 || pos + 2 + length > srcLen) {
+            return false;
+        }
+
+        const uint8_t *segment = src + pos + 4;
+        if(marker == JPEG_MARKER_SOF0 || marker == JPEG_MARKER_SOF1) {
+            if(length < 8) {
+                return false;
+            }
+            layout.sofOffset = pos;
+            layout.height    = readBigEndian16(segment + 1);
+            layout.width     = readBigEndian16(segment + 3);
+            componentCount   = segment[5];
+            if(componentCount == 0 || length < 8 + 3 * componentCount) {
+                return false;
+            }
+            uint32_t maxH = 1;
+            uint32_t maxV = 1;
+            for(uint32_t i = 0; i < componentCount; i++) {
+                maxH = std::max<uint32_t>(maxH, segment[7 + i * 3] >> 4);
+                maxV = std::max<uint32_t>(maxV, segment[7 + i * 3] & 0x0F);
+            }
+            // a single component scan is not interleaved, its MCU is one block
+            layout.mcuWidth  = componentCount == 1 ? 8 : maxH * 8;
+            layout.mcuHeight = componentCount == 1 ? 8 : maxV * 8;
+        }
+        else if(marker >= 0xC2 && marker <= 0xCF && marker != JPEG_MARKER_DHT) {
+            return false;  // progressive, lossless, hierarchical or arithmetic coded frames are decoded as a whole
+        }
+        else if(marker == JPEG_MARKER_DRI) {
+            if(length < 4) {
+                return false;
+            }
+            layout.restartInterval = readBigEndian16(segment);
+        }
+        else if(marker == JPEG_MARKER_SOS) {
+            // only a single scan with all the components can be split
+            if(layout.sofOffset == 0 || segment[0] != componentCount) {
+                return false;
+            }
+            layout.scanOffset = pos + 2 + length;
+        }
+        pos += 2 + length;
+    }
+
+    if(layout.restartInterval == 0 || layout.width == 0 || layout.height == 0) {
+        return false;
+    }
+
+    // the restart markers split the entropy coded data into segments of restartInterval MCUs
+    size_t segmentBegin = layout.scanOffset;
+    pos                 = layout.scanOffset;
+    while(true) {
+        auto marker = static_cast<const uint8_t *>(memchr(src + pos, 0xFF, srcLen - pos));
+        if(marker == nullptr || marker + 1 >= src + srcLen) {
+            return false;  // truncated frame
+        }
+        pos       = marker - src;
+        auto code = marker[1];
+        if(code == 0x00 || code == 0xFF) {
+            pos += code == 0x00 ? 2 : 1;  // stuffed byte or fill byte
+            continue;
+        }
+        layout.segmentBegins.push_back(segmentBegin);
+        layout.segmentEnds.push_back(pos);
+        if(code < JPEG_MARKER_RST0 || code > JPEG_MARKER_RST7) {
+            break;  // EOI, or whatever ends the scan
+        }
+        pos += 2;
+        segmentBegin = pos;
+    }
+
+    uint64_t mcusPerRow = (layout.width + layout.mcuWidth - 1) / layout.mcuWidth;
+    uint64_t mcuCount   = mcusPerRow * ((layout.height + layout.mcuHeight - 1) / layout.mcuHeight);
+    return layout.segmentBegins.size() == (mcuCount + layout.restartInterval - 1) / layout.restartInterval;
+}
+
+void MjpegDecoder::buildSlice(const uint8_t *src, uint32_t sliceHeight, size_t firstSegment, size_t lastSegment, std::vector<uint8_t> &slice) const {
+    auto &layout = layout_;
+
+    size_t dataSize = 0;
+    for(auto i = firstSegment; i < lastSegment; i++) {
+        dataSize += layout.segmentEnds[i] - layout.segmentBegins[i] + 2;
+    }
+    slice.resize(layout.scanOffset + dataSize + 2);
+
+    // the header with the height of the slice
+    auto dst = slice.data();
+    memcpy(dst, src, layout.scanOffset);
+    dst[layout.sofOffset + 5] = static_cast<uint8_t>(sliceHeight >> 8);
+    dst[layout.sofOffset + 6] = static_cast<uint8_t>(sliceHeight & 0xFF);
+    dst += layout.scanOffset;
+
+    // the segments of the slice, the decoder expects the restart markers to count from RST0
+    for(auto i = firstSegment; i < lastSegment; i++) {
+        auto size = layout.segmentEnds[i] - layout.segmentBegins[i];
+        memcpy(dst, src + layout.segmentBegins[i], size);
+        dst += size;
+        if(i + 1 < lastSegment) {
+            *dst++ = 0xFF;
+            *dst++ = static_cast<uint8_t>(JPEG_MARKER_RST0 + ((i - firstSegment) & 0x07));
+        }
+    }
+    *dst++ = 0xFF;
+    *dst++ = JPEG_MARKER_EOI;
+    slice.resize(dst - slice.data());
+}
+
+bool MjpegDecoder::decodeSlices(const uint8_t *src, uint8_t *target, uint32_t pitch, int pixelFormat, int flags) {
+    auto &layout = layout_;
+
+    // the slices must start with a restart interval at the beginning of a MCU row
+    uint32_t mcusPerRow = (layout.width + layout.mcuWidth - 1) / layout.mcuWidth;
+    uint32_t mcuRows    = (layout.height + layout.mcuHeight - 1) / layout.mcuHeight;
+    uint32_t rowStep    = layout.restartInterval / greatestCommonDivisor(layout.restartInterval, mcusPerRow);
+    uint32_t slices     = std::min(maxSlices_, mcuRows / std::max(rowStep, MIN_MCU_ROWS_PER_SLICE));
+    if(slices < 2) {
+        return false;
+    }
+
+    std::vector<uint32_t> sliceRows;  // first MCU row of every slice, and the row count at the end
+    for(uint32_t i = 0; i < slices; i++) {
+        auto row = (static_cast<uint64_t>(mcuRows) * i / slices + rowStep / 2) / rowStep * rowStep;
+        if(row < mcuRows && (sliceRows.empty() || row > sliceRows.back())) {
+            sliceRows.push_back(static_cast<uint32_t>(row));
+        }
+    }
+    sliceRows.push_back(mcuRows);
+    slices = static_cast<uint32_t>(sliceRows.size() - 1);
+
+    if(sliceBuffers_.size() < slices) {
+        sliceBuffers_.resize(slices);
+    }
+    for(uint32_t i = 0; i < slices; i++) {
+        if(!getHandle(i)) {
+            lastErrorHandle_ = nullptr;
+            return false;
+        }
+    }
+
+    std::vector<int> results(slices, -1);
+    auto             decodeSlice = [&](uint32_t index) {
+        auto firstRow     = sliceRows[index];
+        auto lastRow      = sliceRows[index + 1];
+        auto firstSegment = static_cast<size_t>(firstRow) * mcusPerRow / layout.restartInterval;
+        auto lastSegment  = index + 1 == slices ? layout.segmentBegins.size() : static_cast<size_t>(lastRow) * mcusPerRow / layout.restartInterval;
+        auto firstLine    = firstRow * layout.mcuHeight;
+        auto sliceHeight  = std::min(layout.height, lastRow * layout.mcuHeight) - firstLine;
+
+        auto &slice = sliceBuffers_[index];
+        buildSlice(src, sliceHeight, firstSegment, lastSegment, slice);
+        results[index] = tjDecompress2(handles_[index], slice.data(), static_cast<unsigned long>(slice.size()), target + static_cast<size_t>(firstLine) * pitch,
+                                       static_cast<int>(layout.width), static_cast<int>(pitch), static_cast<int>(sliceHeight), pixelFormat, flags);
+    };
+
+    workerPool_->parallelFor(slices, decodeSlice);
+
+    for(uint32_t i = 0; i < slices; i++) {
+        if(results[i] != 0) {
+            lastErrorHandle_ = handles_[i];
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace libobsensor
@@ -0,0 +1,83 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "utils/WorkerPool.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace libobsensor {
+
+/**
+ * @brief Decodes MJPEG frames to packed pixel formats (TJPF_RGB, TJPF_BGR, TJPF_BGRA...) directly into a caller provided buffer
+ * @brief The turbojpeg handles are kept for the lifetime of the decoder instead of being created for every frame. When the frame has restart
+ * markers at MCU row boundaries, it is split into horizontal slices that are decoded on several threads; every slice is rewritten as a
+ * standalone JPEG (same tables, slice height, restart markers renumbered) and decoded into its rows of the target buffer.
+ * @brief Not thread safe, every filter instance owns its decoder.
+ */
+class MjpegDecoder {
+public:
+    MjpegDecoder();
+    ~MjpegDecoder() noexcept;
+
+    MjpegDecoder(const MjpegDecoder &)            = delete;
+    MjpegDecoder &operator=(const MjpegDecoder &) = delete;
+
+    /**
+     * @brief Decode a MJPEG frame
+     *
+     * @param[in] src The compressed data
+     * @param[in] srcLen Size of the compressed data
+     * @param[out] target The decoded image, at least pitch * height bytes
+     * @param[in] width Width of the image, must match the frame
+     * @param[in] pitch Bytes per row of the target, 0 for width * pixel size
+     * @param[in] height Height of the image, must match the frame
+     * @param[in] pixelFormat The turbojpeg pixel format (TJPF_*) of the target
+     * @param[in] flags The turbojpeg decompress flags (TJFLAG_*)
+     * @return true if the frame was decoded without error or warning
+     */
+    bool decode(const uint8_t *src, uint32_t srcLen, uint8_t *target, uint32_t width, uint32_t pitch, uint32_t height, int pixelFormat, int flags);
+
+    /**
+     * @brief The turbojpeg error message of the last failed decode
+     */
+    const char *getLastError() const;
+
+    /**
+     * @brief Limit the number of slices (and threads) a frame is decoded with, 1 decodes every frame as a whole
+     */
+    void setMaxSlices(uint32_t maxSlices);
+
+private:
+    // Position of the entropy coded segments between the restart markers of a baseline JPEG
+    struct ScanLayout {
+        size_t              sofOffset;  // offset of the SOF marker, the frame height is patched for every slice
+        size_t              scanOffset;
+        uint32_t            width;
+        uint32_t            height;
+        uint32_t            mcuWidth;
+        uint32_t            mcuHeight;
+        uint32_t            restartInterval;  // in MCUs
+        std::vector<size_t> segmentBegins;
+        std::vector<size_t> segmentEnds;
+    };
+
+    bool parseScanLayout(const uint8_t *src, size_t srcLen);
+    bool decodeSlices(const uint8_t *src, uint8_t *target, uint32_t pitch, int pixelFormat, int flags);
+    void buildSlice(const uint8_t *src, uint32_t sliceHeight, size_t firstSegment, size_t lastSegment, std::vector<uint8_t> &slice) const;
+    void *getHandle(size_t index);
+
+private:
+    std::shared_ptr<WorkerPool>       workerPool_;  // decodes the slices of a frame in parallel
+    uint32_t                          maxSlices_;
+    std::vector<void *>               handles_;  // one turbojpeg decompressor per slice
+    std::vector<std::vector<uint8_t>> sliceBuffers_;
+    ScanLayout                        layout_;
+    void                             *lastErrorHandle_ = nullptr;
+};
+
+}  // namespace libobsensor
@@ -19,10 +19,13 @@ PointCloudFilter::PointCloudFilter()
       coordinateSystemType_(OB_RIGHT_HAND_COORDINATE_SYSTEM),
       isColorDataNormalization_(false),
       isOutputZeroPoint_(true),
+      isAlignToColor_(false),
       depthTablesDataSize_(0),
       depthTablesData_(nullptr),
       rgbdTablesDataSize_(0),
       rgbdTablesData_(nullptr),
+      colorTablesDataSize_(0),
+      colorTablesData_(nullptr),
       decimationFactor_(1),
       patchSize_(1),
       optionsChanged_(false),
@@ -37,6 +40,11 @@ PointCloudFilter::PointCloudFilter()
     rgbdXyTables_.yTable = nullptr;
     rgbdXyTables_.height = 0;
     rgbdXyTables_.width  = 0;
+
+    colorUvTables_.xTable = nullptr;
+    colorUvTables_.yTable = nullptr;
+    colorUvTables_.height = 0;
+    colorUvTables_.width  = 0;
 }
 
 PointCloudFilter::~PointCloudFilter() noexcept {
@@ -63,6 +71,14 @@ void PointCloudFilter::reset() {
         rgbdXyTables_.height = 0;
         rgbdXyTables_.width  = 0;
     }
+    if(colorTablesData_) {
+        colorTablesData_.reset();
+        colorTablesDataSize_  = 0;
+        colorUvTables_.xTable = nullptr;
+        colorUvTables_.yTable = nullptr;
+        colorUvTables_.height = 0;
+        colorUvTables_.width  = 0;
+    }
 
     optionsChanged_ = true;
     registeredProfiles_.clear();
@@ -71,7 +87,7 @@ void PointCloudFilter::reset() {
 }
 
 void PointCloudFilter::updateConfig(std::vector<std::string> &params) {
-    if(params.size() != 6) {
+    if(params.size() != 6 && params.size() != 7) {
         THROW_INVALID_PARAM_EXCEPTION("PointCloudFilter config error: params size not match");
     }
     try {
@@ -106,6 +122,10 @@ void PointCloudFilter::updateConfig(std::vector<std::string> &params) {
                 optionsChanged_    = true;
             }
         }
+
+        if(params.size() > 6) {
+            isAlignToColor_ = std::stoi(params[6]) != 0;
+        }
     }
     catch(const std::exception &e) {
         THROW_INVALID_PARAM_EXCEPTION("PointCloudFilter config error: " + std::string(e.what()));
@@ -124,7 +144,8 @@ const std::string &PointCloudFilter::getConfigSchema() const {
                                       "colorDataNormalization, integer, 0, 1, 1, 0, color data normal state\n"
                                       "coordinateSystemType, integer, 0, 1, 1, 1, Coordinate system representation type: 0 is left hand; 1 is right hand\n"
                                       "outputZeroPoint, integer, 0, 1, 1, 1, output zero point\n"
-                                      "decimate, integer, 1, 8, 1, 1, value decimate factor\n";
+                                      "decimate, integer, 1, 8, 1, 1, value decimate factor\n"
+                                      "alignToColor, integer, 0, 1, 1, 0, RGBD point cloud of the depth not aligned to color: project the depth to color\n";
     return schema;
 }
 
@@ -138,6 +159,43 @@ bool PointCloudFilter::hasIntrinsicChanged(const OBCameraIntrinsic &cached, cons
     return !(floatEqual(cached.fx, target.fx) && floatEqual(cached.fy, target.fy) && floatEqual(cached.cx, target.cx) && floatEqual(cached.cy, target.cy));
 }
 
+bool PointCloudFilter::initDepthXYTables(std::shared_ptr<const VideoStreamProfile> depthProfile) {
+    OBCameraIntrinsic depthIntrinsic = depthProfile->getIntrinsic();
+    if(depthTablesData_ == nullptr || hasIntrinsicChanged(depthDstIntrinsic_, depthIntrinsic)) {
+        depthTablesDataSize_          = depthProfile->getWidth() * depthProfile->getHeight() * 2;
+        depthTablesData_              = std::shared_ptr<float>(new float[depthTablesDataSize_], std::default_delete<float[]>());
+        OBCameraDistortion depthDisto = depthProfile->getDistortion();
+        if(!CoordinateUtil::transformationInitXYTables(depthIntrinsic, depthDisto, reinterpret_cast<float *>(depthTablesData_.get()), &depthTablesDataSize_,
+                                                       &depthXyTables_)) {
+            LOG_ERROR_INTVL("Init transformation coordinate tables failed!");
+            depthTablesData_.reset();
+            return false;
+        }
+        depthDstIntrinsic_ = depthIntrinsic;
+    }
+    return true;
+}
+
+bool PointCloudFilter::isAlignedToColor(std::shared_ptr<const VideoStreamProfile> depthProfile, std::shared_ptr<const VideoStreamProfile> colorProfile) {
+    if(hasIntrinsicChanged(depthProfile->getIntrinsic(), colorProfile->getIntrinsic())) {
+        return false;
+    }
+
+    const float eps       = 1e-6f;
+    auto        extrinsic = depthProfile->getExtrinsicTo(colorProfile);
+    for(int i = 0; i < 9; i++) {
+        if(std::fabs(extrinsic.rot[i] - (i % 4 == 0 ? 1.0f : 0.0f)) > eps) {
+            return false;
+        }
+    }
+    for(int i = 0; i < 3; i++) {
+        if(std::fabs(extrinsic.trans[i]) > eps) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::shared_ptr<Frame> PointCloudFilter::createDepthPointCloud(std::shared_ptr<const Frame> frame) {
     std::shared_ptr<const Frame> depthFrame;
     if(frame->is<FrameSet>()) {
@@ -167,18 +225,8 @@ std::shared_ptr<Frame> PointCloudFilter::createDepthPointCloud(std::shared_ptr<c
     memset((void *)pointFrame->getData(), 0, pointFrame->getDataSize());
 
     // Create xytables
-    OBCameraIntrinsic depthIntrinsic = depthVideoStreamProfile->getIntrinsic();
-    if(depthTablesData_ == nullptr || hasIntrinsicChanged(depthDstIntrinsic_, depthIntrinsic)) {
-        depthTablesDataSize_          = depthWidth * depthHeight * 2;
-        depthTablesData_              = std::shared_ptr<float>(new float[depthTablesDataSize_], std::default_delete<float[]>());
-        OBCameraDistortion depthDisto = depthVideoStreamProfile->getDistortion();
-        if(!CoordinateUtil::transformationInitXYTables(depthIntrinsic, depthDisto, reinterpret_cast<float *>(depthTablesData_.get()), &depthTablesDataSize_,
-                                                       &depthXyTables_)) {
-            LOG_ERROR_INTVL("Init transformation coordinate tables failed!");
-            depthTablesData_.reset();
-            return nullptr;
-        }
-        depthDstIntrinsic_ = depthIntrinsic;
+    if(!initDepthXYTables(depthVideoStreamProfile)) {
+        return nullptr;
     }
 
     updateOutputProfile(depthFrame);
@@ -208,49 +256,12 @@ std::shared_ptr<Frame> PointCloudFilter::createDepthPointCloud(std::shared_ptr<c
     return pointFrame;
 }
 
-std::shared_ptr<Frame> PointCloudFilter::createRGBDPointCloud(std::shared_ptr<const Frame> frame) {
-    if(!frame->is<FrameSet>()) {
-        LOG_ERROR_INTVL("Input frame is not a frameset, can not convert to pointcloud!");
-        return nullptr;
-    }
-
-    auto frameSet   = frame->as<FrameSet>();
-    auto depthFrame = frameSet->getFrame(OB_FRAME_DEPTH);
-    auto colorFrame = frameSet->getFrame(OB_FRAME_COLOR);
-
-    if(depthFrame == nullptr || colorFrame == nullptr) {
-        LOG_ERROR_INTVL("depth frame or color frame not found in frameset!");
-        return nullptr;
-    }
-
-    auto                       depthVideoFrame         = depthFrame->as<VideoFrame>();
-    auto                       colorVideoFrame         = colorFrame->as<VideoFrame>();
-    auto                       depthVideoStreamProfile = depthVideoFrame->getStreamProfile()->as<VideoStreamProfile>();
-    auto                       colorVideoStreamProfile = colorVideoFrame->getStreamProfile()->as<VideoStreamProfile>();
-    OBPointCloudDistortionType distortionType          = getDistortionType(colorVideoStreamProfile->getDistortion(), depthVideoStreamProfile->getDistortion());
-
-    // How C2D can recognize
-    uint32_t           dstHeight             = depthVideoFrame->getHeight();
-    uint32_t           dstWidth              = depthVideoFrame->getWidth();
-    auto               dstVideoStreamProfile = depthVideoStreamProfile;
-    OBCameraIntrinsic  dstIntrinsic          = dstVideoStreamProfile->getIntrinsic();
-    OBCameraDistortion dstDistortion         = dstVideoStreamProfile->getDistortion();
-
-    // Create an RGBD point cloud frame
-    auto pointFrame = FrameFactory::createFrame(OB_FRAME_POINTS, OB_FORMAT_RGB_POINT, dstWidth * dstHeight * sizeof(OBColorPoint));
-    if(pointFrame == nullptr) {
-        LOG_WARN_INTVL("Acquire point cloud frame failed!");
-        return nullptr;
-    }
-    memset((void *)pointFrame->getData(), 0, pointFrame->getDataSize());
-
-    // decode rgb frame
+std::shared_ptr<const Frame> PointCloudFilter::convertColorToRGB(std::shared_ptr<const Frame> colorFrame) {
     if(formatConverter_ == nullptr) {
         formatConverter_ = std::make_shared<FormatConverter>();
     }
 
-    std::shared_ptr<const Frame> tarFrame;
-    std::vector<std::string>     params;
+    std::vector<std::string> params;
     switch(colorFrame->getFormat()) {
     case OB_FORMAT_YUYV:
         // FORMAT_YUYV_TO_RGB
@@ -304,17 +315,57 @@ std::shared_ptr<Frame> PointCloudFilter::createRGBDPointCloud(std::shared_ptr<co
         break;
     case OB_FORMAT_RGB:
     case OB_FORMAT_BGR:
-        tarFrame = colorFrame;
-        break;
+        return colorFrame;
     default:
         THROW_UNSUPPORTED_OPERATION_EXCEPTION("unsupported color format for RgbDepth pointCloud convert!");
     }
 
-    uint8_t *colorData = nullptr;
-    if(colorFrame->getFormat() != OB_FORMAT_RGB && colorFrame->getFormat() != OB_FORMAT_BGR) {
-        tarFrame = formatConverter_->process(colorFrame);
+    return formatConverter_->process(colorFrame);
+}
+
+std::shared_ptr<Frame> PointCloudFilter::createRGBDPointCloud(std::shared_ptr<const Frame> frame) {
+    if(!frame->is<FrameSet>()) {
+        LOG_ERROR_INTVL("Input frame is not a frameset, can not convert to pointcloud!");
+        return nullptr;
     }
 
+    auto frameSet   = frame->as<FrameSet>();
+    auto depthFrame = frameSet->getFrame(OB_FRAME_DEPTH);
+    auto colorFrame = frameSet->getFrame(OB_FRAME_COLOR);
+
+    if(depthFrame == nullptr || colorFrame == nullptr) {
+        LOG_ERROR_INTVL("depth frame or color frame not found in frameset!");
+        return nullptr;
+    }
+
+    auto                       depthVideoFrame         = depthFrame->as<VideoFrame>();
+    auto                       colorVideoFrame         = colorFrame->as<VideoFrame>();
+    auto                       depthVideoStreamProfile = depthVideoFrame->getStreamProfile()->as<VideoStreamProfile>();
+    auto                       colorVideoStreamProfile = colorVideoFrame->getStreamProfile()->as<VideoStreamProfile>();
+    OBPointCloudDistortionType distortionType          = getDistortionType(colorVideoStreamProfile->getDistortion(), depthVideoStreamProfile->getDistortion());
+
+    if(isAlignToColor_ && !isAlignedToColor(depthVideoStreamProfile, colorVideoStreamProfile)) {
+        return createRGBDPointCloudByColorProjection(depthFrame, colorFrame);
+    }
+
+    // How C2D can recognize
+    uint32_t           dstHeight             = depthVideoFrame->getHeight();
+    uint32_t           dstWidth              = depthVideoFrame->getWidth();
+    auto               dstVideoStreamProfile = depthVideoStreamProfile;
+    OBCameraIntrinsic  dstIntrinsic          = dstVideoStreamProfile->getIntrinsic();
+    OBCameraDistortion dstDistortion         = dstVideoStreamProfile->getDistortion();
+
+    // Create an RGBD point cloud frame
+    auto pointFrame = FrameFactory::createFrame(OB_FRAME_POINTS, OB_FORMAT_RGB_POINT, dstWidth * dstHeight * sizeof(OBColorPoint));
+    if(pointFrame == nullptr) {
+        LOG_WARN_INTVL("Acquire point cloud frame failed!");
+        return nullptr;
+    }
+    memset((void *)pointFrame->getData(), 0, pointFrame->getDataSize());
+
+    // decode rgb frame
+    auto     tarFrame  = convertColorToRGB(colorFrame);
+    uint8_t *colorData = nullptr;
     if(tarFrame) {
         colorData = (uint8_t *)tarFrame->getData();
     }
@@ -386,6 +437,87 @@ std::shared_ptr<Frame> PointCloudFilter::createRGBDPointCloud(std::shared_ptr<co
     return pointFrame;
 }
 
+std::shared_ptr<Frame> PointCloudFilter::createRGBDPointCloudByColorProjection(std::shared_ptr<const Frame> depthFrame,
+                                                                               std::shared_ptr<const Frame> colorFrame) {
+    auto depthVideoStreamProfile = depthFrame->getStreamProfile()->as<VideoStreamProfile>();
+    auto colorVideoStreamProfile = colorFrame->getStreamProfile()->as<VideoStreamProfile>();
+    auto depthWidth              = depthFrame->as<VideoFrame>()->getWidth();
+    auto depthHeight             = depthFrame->as<VideoFrame>()->getHeight();
+
+    OBCameraIntrinsic  colorIntrinsic  = colorVideoStreamProfile->getIntrinsic();
+    OBCameraDistortion colorDistortion = colorVideoStreamProfile->getDistortion();
+    auto               colorVideoFrame = colorFrame->as<VideoFrame>();
+    if(colorIntrinsic.width != (int)colorVideoFrame->getWidth() || colorIntrinsic.height != (int)colorVideoFrame->getHeight()) {
+        LOG_ERROR_INTVL("The color intrinsic does not match the color frame resolution!");
+        return nullptr;
+    }
+
+    auto rgbFrame = convertColorToRGB(colorFrame);
+    if(!rgbFrame) {
+        LOG_ERROR_INTVL("get rgb data failed!");
+        return nullptr;
+    }
+
+    // Create xytables of the depth, and the uvtables adding the color distortion like those of the depth aligned to color
+    if(!initDepthXYTables(depthVideoStreamProfile)) {
+        return nullptr;
+    }
+
+    OBCameraDistortion zeroDistortion;
+    memset(&zeroDistortion, 0, sizeof(OBCameraDistortion));
+    bool hasColorDistortion = memcmp(&colorDistortion, &zeroDistortion, offsetof(OBCameraDistortion, model)) != 0;
+    if(hasColorDistortion
+       && (colorTablesData_ == nullptr || hasIntrinsicChanged(colorDstIntrinsic_, colorIntrinsic)
+           || memcmp(&colorDstDistortion_, &colorDistortion, sizeof(OBCameraDistortion)) != 0)) {
+        colorTablesDataSize_ = colorIntrinsic.width * colorIntrinsic.height * 2;
+        colorTablesData_     = std::shared_ptr<float>(new float[colorTablesDataSize_], std::default_delete<float[]>());
+        if(!CoordinateUtil::transformationInitAddDistortionUVTables(colorIntrinsic, colorDistortion, reinterpret_cast<float *>(colorTablesData_.get()),
+                                                                    &colorTablesDataSize_, &colorUvTables_)) {
+            LOG_ERROR_INTVL("Init add distortion transformation coordinate tables failed!");
+            colorTablesData_.reset();
+            return nullptr;
+        }
+        colorDstIntrinsic_  = colorIntrinsic;
+        colorDstDistortion_ = colorDistortion;
+    }
+
+    // Create an RGBD point cloud frame
+    auto pointFrame = FrameFactory::createFrame(OB_FRAME_POINTS, OB_FORMAT_RGB_POINT, depthWidth * depthHeight * sizeof(OBColorPoint));
+    if(pointFrame == nullptr) {
+        LOG_WARN_INTVL("Acquire point cloud frame failed!");
+        return nullptr;
+    }
+    memset((void *)pointFrame->getData(), 0, pointFrame->getDataSize());
+
+    updateOutputProfile(depthFrame);
+
+    uint32_t width = targetStreamProfile_->getWidth();
+    pointFrame->as<PointsFrame>()->setWidth(width);
+
+    uint32_t height = targetStreamProfile_->getHeight();
+    pointFrame->as<PointsFrame>()->setHeight(height);
+
+    float       depthValueScale = depthFrame->as<DepthFrame>()->getValueScale();
+    OBExtrinsic depthToColor    = depthVideoStreamProfile->getExtrinsicTo(colorVideoStreamProfile);
+    uint32_t    validPointCount = 0;
+    CoordinateUtil::transformationDepthToRGBDPointCloudByColorProjection(
+        &depthXyTables_, depthFrame->getData(), depthToColor, depthValueScale, colorIntrinsic, hasColorDistortion ? &colorUvTables_ : nullptr,
+        rgbFrame->getData(), (void *)pointFrame->getData(), isOutputZeroPoint_, &validPointCount, positionDataScale_, coordinateSystemType_,
+        isColorDataNormalization_, depthFrame->getFormat() == OB_FORMAT_Y12C4, decimationFactor_, width);
+
+    if(!isOutputZeroPoint_) {
+        pointFrame->setDataSize(validPointCount * sizeof(OBColorPoint));
+    }
+    else {
+        pointFrame->setDataSize(width * height * sizeof(OBColorPoint));
+    }
+    pointFrame->copyInfoFromOther(depthFrame);
+    // Actual coordinate scaling = Depth scaling factor / Set coordinate scaling factor.
+    pointFrame->as<PointsFrame>()->setCoordinateValueScale(depthValueScale / positionDataScale_);
+
+    return pointFrame;
+}
+
 std::shared_ptr<Frame> PointCloudFilter::process(std::shared_ptr<const Frame> frame) {
     if(!frame) {
         return nullptr;
@@ -40,6 +40,11 @@ private:
     bool                   hasIntrinsicChanged(const OBCameraIntrinsic &cached, const OBCameraIntrinsic &target);
     std::shared_ptr<Frame> createDepthPointCloud(std::shared_ptr<const Frame> frame);
     std::shared_ptr<Frame> createRGBDPointCloud(std::shared_ptr<const Frame> frame);
+    std::shared_ptr<Frame> createRGBDPointCloudByColorProjection(std::shared_ptr<const Frame> depthFrame, std::shared_ptr<const Frame> colorFrame);
+
+    bool                         initDepthXYTables(std::shared_ptr<const VideoStreamProfile> depthProfile);
+    bool                         isAlignedToColor(std::shared_ptr<const VideoStreamProfile> depthProfile, std::shared_ptr<const VideoStreamProfile> colorProfile);
+    std::shared_ptr<const Frame> convertColorToRGB(std::shared_ptr<const Frame> colorFrame);
 
     std::shared_ptr<Frame> process(std::shared_ptr<const Frame> frame) override;
 
@@ -53,6 +58,8 @@ protected:
     OBCoordinateSystemType coordinateSystemType_;
     bool                   isColorDataNormalization_;
     bool                   isOutputZeroPoint_;
+    // RGBD point cloud of the depth not aligned to color: project the depth pixels to the color camera instead of the Align filter beforehand
+    bool                   isAlignToColor_;
 
     std::shared_ptr<FormatConverter> formatConverter_;
 
@@ -67,6 +74,12 @@ protected:
     uint32_t                   rgbdTablesDataSize_;
     std::shared_ptr<float>     rgbdTablesData_;
     OBXYTables                 rgbdXyTables_;
+    // data for the color distortion of the depth pixels projected to color
+    OBCameraIntrinsic      colorDstIntrinsic_{};
+    OBCameraDistortion     colorDstDistortion_{};
+    uint32_t               colorTablesDataSize_;
+    std::shared_ptr<float> colorTablesData_;
+    OBXYTables             colorUvTables_;
 
     std::map<std::tuple<std::string, uint8_t>, std::shared_ptr<VideoStreamProfile>> registeredProfiles_;
     std::shared_ptr<const VideoStreamProfile>                                       sourceStreamProfile_;
@@ -52,7 +52,7 @@ std::shared_ptr<Frame> SequenceIdFilter::process(std::shared_ptr<const Frame> fr
         return nullptr;
     }
 
-    auto outFrame = FrameFactory::createFrameFromOtherFrame(frame, true);
+    auto outFrame = FrameFactory::createFrameView(frame);
     if(outFrame->is<FrameSet>()) {
         LOG_WARN_INTVL("The Frame processed by SequenceIdFilter cannot be FrameSet!");
         return outFrame;
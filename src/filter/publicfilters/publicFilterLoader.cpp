@@ -15,6 +15,7 @@
 #include "FilterDecorator.hpp"
 #include "LiDARPointFilter.hpp"
 #include "LiDARFormatConverter.hpp"
+#include "DepthTransformProcess.hpp"
 
 namespace libobsensor {
 publicFilterCreator::publicFilterCreator(std::function<std::shared_ptr<IFilter>()> creatorFunc) : creatorFunc_(creatorFunc) {}
@@ -41,6 +42,7 @@ std::map<std::string, std::shared_ptr<IFilterCreator>> getCreators() {
         ADD_FILTER_CREATOR(FrameRotate),       ADD_FILTER_CREATOR(PointCloudFilter),
         ADD_FILTER_CREATOR(IMUCorrector),      ADD_FILTER_CREATOR(Align),
         ADD_FILTER_CREATOR(LiDARPointFilter),  ADD_FILTER_CREATOR(LiDARFormatConverter),
+        ADD_FILTER_CREATOR(DepthTransformFilter), ADD_FILTER_CREATOR(FrameCrop),
     };
 
     return filterCreators;
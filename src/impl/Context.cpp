@@ -7,6 +7,7 @@
 #include "logger/Logger.hpp"
 #include "context/Context.hpp"
 #include "environment/EnvConfig.hpp"
+#include "frame/FrameLatencyTracer.hpp"
 #include "shared/utils/Utils.hpp"
 #include "common/DeviceSeriesInfo.hpp"
 #include "platform/SourcePortInfo.hpp"
@@ -181,6 +182,37 @@ void ob_free_idle_memory(ob_context *context, ob_error **error) BEGIN_API_CALL {
 }
 HANDLE_EXCEPTIONS_NO_RETURN(context)
 
+const char *ob_query_metrics(ob_context *context, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(context);
+    auto metricsRegistry = context->context->getMetricsRegistry();
+    context->metricsText = metricsRegistry->exportPrometheusText();
+    return context->metricsText.c_str();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, context)
+
+double ob_query_metric_value(ob_context *context, const char *name, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(context);
+    VALIDATE_STR_NOT_NULL(name);
+    auto metricsRegistry = context->context->getMetricsRegistry();
+    return metricsRegistry->getValue(name);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0.0, context, name)
+
+void ob_start_metrics_dump(ob_context *context, const char *file_path, uint32_t interval_ms, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(context);
+    VALIDATE_STR_NOT_NULL(file_path);
+    auto metricsRegistry = context->context->getMetricsRegistry();
+    metricsRegistry->startDump(file_path, interval_ms);
+}
+HANDLE_EXCEPTIONS_NO_RETURN(context, file_path, interval_ms)
+
+void ob_stop_metrics_dump(ob_context *context, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(context);
+    auto metricsRegistry = context->context->getMetricsRegistry();
+    metricsRegistry->stopDump();
+}
+HANDLE_EXCEPTIONS_NO_RETURN(context)
+
 void ob_set_uvc_backend_type(ob_context *context, ob_uvc_backend_type backend_type, ob_error **error) BEGIN_API_CALL {
     VALIDATE_NOT_NULL(context);
 #if defined(__linux__) || defined(__ANDROID__)
@@ -243,6 +275,22 @@ void ob_set_extensions_directory(const char *directory, ob_error **error) BEGIN_
 }
 HANDLE_EXCEPTIONS_NO_RETURN(directory)
 
+void ob_enable_frame_trace(bool enable, ob_error **error) BEGIN_API_CALL {
+    libobsensor::FrameLatencyTracer::enableFrameTrace(enable);
+}
+HANDLE_EXCEPTIONS_NO_RETURN(enable)
+
+void ob_start_frame_trace_export(const char *file_path, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_STR_NOT_NULL(file_path);
+    libobsensor::FrameLatencyTracer::startExport(file_path);
+}
+HANDLE_EXCEPTIONS_NO_RETURN(file_path)
+
+void ob_stop_frame_trace_export(ob_error **error) BEGIN_API_CALL {
+    libobsensor::FrameLatencyTracer::stopExport();
+}
+NO_ARGS_HANDLE_EXCEPTIONS_NO_RETURN()
+
 #ifdef __cplusplus
 }
 #endif
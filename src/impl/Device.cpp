@@ -510,6 +510,28 @@ bool ob_device_is_property_supported(const ob_device *device, ob_property_id pro
 }
 HANDLE_EXCEPTIONS_AND_RETURN(false, device, property_id, permission)
 
+void ob_device_set_property_cache_policy(ob_device *device, ob_property_id property_id, ob_property_cache_policy policy, uint32_t ttl_ms,
+                                         ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(device);
+    auto propServer = device->device->getPropertyServer();
+    propServer->setPropertyCachePolicy(property_id, policy, ttl_ms);
+}
+HANDLE_EXCEPTIONS_NO_RETURN(device, property_id, policy, ttl_ms)
+
+void ob_device_invalidate_property_cache(ob_device *device, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(device);
+    auto propServer = device->device->getPropertyServer();
+    propServer->invalidatePropertyCache();
+}
+HANDLE_EXCEPTIONS_NO_RETURN(device)
+
+ob_property_cache_statistics ob_device_get_property_cache_statistics(ob_device *device, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(device);
+    auto propServer = device->device->getPropertyServer();
+    return propServer->getPropertyCacheStatistics();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(ob_property_cache_statistics(), device)
+
 bool ob_device_is_global_timestamp_supported(const ob_device *device, ob_error **error) BEGIN_API_CALL {
     VALIDATE_NOT_NULL(device);
     return device->device->isComponentExists(libobsensor::OB_DEV_COMPONENT_GLOBAL_TIMESTAMP_FILTER);
@@ -6,10 +6,54 @@
 #include "ImplTypes.hpp"
 #include "exception/ObException.hpp"
 #include "frame/FrameFactory.hpp"
+#include "frame/FrameLatencyTracer.hpp"
 
 #include "IFrame.hpp"
 #include "ISensor.hpp"
 
+#include <algorithm>
+
+namespace {
+
+// Get the handle of a member of a frameset. Handles are cached on the frameset handle and reused while the member is unchanged, the caller
+// still owns one reference of the returned handle and releases it with ob_delete_frame().
+ob_frame *getFramesetMemberHandle(const ob_frame *frameset, std::shared_ptr<const libobsensor::Frame> innerFrame) {
+    auto                        unConstFrameset = const_cast<ob_frame *>(frameset);
+    std::lock_guard<std::mutex> lock(unConstFrameset->childHandlesMutex);
+    auto                       &handles = unConstFrameset->childHandles;
+    for(auto handle: handles) {
+        if(handle->frame == innerFrame) {
+            handle->refCnt += 1;
+            return handle;
+        }
+    }
+
+    // release the handles of the frames that have been replaced since they were cached
+    auto innerFrameSet = static_cast<const libobsensor::FrameSet *>(frameset->frame.get());
+    handles.erase(std::remove_if(handles.begin(), handles.end(),
+                                 [&](ob_frame *handle) {
+                                     bool contained = false;
+                                     innerFrameSet->foreachFrame([&](void *item) {
+                                         auto pFrame = (std::shared_ptr<const libobsensor::Frame> *)item;
+                                         contained   = (*pFrame == handle->frame);
+                                         return contained;
+                                     });
+                                     if(!contained && handle->refCnt.fetch_sub(1) <= 1) {
+                                         delete handle;
+                                     }
+                                     return !contained;
+                                 }),
+                  handles.end());
+
+    auto impl    = new ob_frame();
+    impl->frame  = std::const_pointer_cast<libobsensor::Frame>(innerFrame);  // todo: it's not safe to cast const to non-const, fix it
+    impl->refCnt = 2;                                                        // one for the caller and one for the cache
+    handles.push_back(impl);
+    return impl;
+}
+
+}  // namespace
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -105,8 +149,7 @@ HANDLE_EXCEPTIONS_NO_RETURN(frame)
 void ob_delete_frame(const ob_frame *frame, ob_error **error) BEGIN_API_CALL {
     VALIDATE_NOT_NULL(frame);
     auto unConstFrame = const_cast<ob_frame *>(frame);
-    if(unConstFrame->refCnt > 1) {
-        unConstFrame->refCnt -= 1;
+    if(unConstFrame->refCnt.fetch_sub(1) > 1) {
         return;
     }
     delete frame;
@@ -120,6 +163,13 @@ void ob_frame_copy_info(const ob_frame *src_frame, ob_frame *dst_frame, ob_error
 }
 HANDLE_EXCEPTIONS_NO_RETURN(src_frame, dst_frame)
 
+void ob_frame_get_info(const ob_frame *frame, ob_frame_info *info, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_NOT_NULL(info);
+    frame->frame->getInfo(*info);
+}
+HANDLE_EXCEPTIONS_NO_RETURN(frame, info)
+
 uint64_t ob_frame_get_index(const ob_frame *frame, ob_error **error) BEGIN_API_CALL {
     VALIDATE_NOT_NULL(frame);
     return frame->frame->getNumber();
@@ -268,6 +318,35 @@ int64_t ob_frame_get_metadata_value(const ob_frame *frame, ob_frame_metadata_typ
 }
 HANDLE_EXCEPTIONS_AND_RETURN(-1, frame)
 
+uint32_t ob_frame_get_all_metadata(const ob_frame *frame, int64_t *values, uint8_t *valid, uint32_t count, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_NOT_NULL(values);
+    return frame->frame->getAllMetadataValues(values, valid, count);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame, values, valid, count)
+
+uint32_t ob_frame_get_trace_event_count(const ob_frame *frame, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(frame);
+    auto trace = frame->frame->getTrace();
+    return trace ? static_cast<uint32_t>(trace->getEvents().size()) : 0;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
+
+void ob_frame_get_trace_event(const ob_frame *frame, uint32_t index, ob_frame_trace_event *event, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_NOT_NULL(event);
+    auto trace = frame->frame->getTrace();
+    if(!trace) {
+        THROW_INVALID_PARAM_EXCEPTION("The frame has no trace event, the frame trace is not enabled!");
+    }
+    auto events = trace->getEvents();
+    if(index >= events.size()) {
+        THROW_INVALID_PARAM_EXCEPTION("ob_frame_get_trace_event: index out of range!");
+    }
+    *event = events[index];
+}
+HANDLE_EXCEPTIONS_NO_RETURN(frame, index, event)
+
 ob_stream_profile *ob_frame_get_stream_profile(const ob_frame *frame, ob_error **error) BEGIN_API_CALL {
     VALIDATE_NOT_NULL(frame);
     auto innerProfile = frame->frame->getStreamProfile();
@@ -436,9 +515,7 @@ ob_frame *ob_frameset_get_depth_frame(const ob_frame *frameset, ob_error **error
     if(innerFrame == nullptr) {
         return nullptr;
     }
-    auto impl   = new ob_frame();
-    impl->frame = std::const_pointer_cast<libobsensor::Frame>(innerFrame);  // todo: it's not safe to cast const to non-const, fix it;
-    return impl;
+    return getFramesetMemberHandle(frameset, innerFrame);
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frameset)
 
@@ -451,9 +528,7 @@ ob_frame *ob_frameset_get_color_frame(const ob_frame *frameset, ob_error **error
     if(innerFrame == nullptr) {
         return nullptr;
     }
-    auto impl   = new ob_frame();
-    impl->frame = std::const_pointer_cast<libobsensor::Frame>(innerFrame);  // todo: it's not safe to cast const to non-const, fix it;
-    return impl;
+    return getFramesetMemberHandle(frameset, innerFrame);
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frameset)
 
@@ -466,9 +541,7 @@ ob_frame *ob_frameset_get_ir_frame(const ob_frame *frameset, ob_error **error) B
     if(innerFrame == nullptr) {
         return nullptr;
     }
-    auto impl   = new ob_frame();
-    impl->frame = std::const_pointer_cast<libobsensor::Frame>(innerFrame);  // todo: it's not safe to cast const to non-const, fix it;
-    return impl;
+    return getFramesetMemberHandle(frameset, innerFrame);
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frameset)
 
@@ -481,9 +554,7 @@ ob_frame *ob_frameset_get_points_frame(const ob_frame *frameset, ob_error **erro
     if(innerFrame == nullptr) {
         return nullptr;
     }
-    auto impl   = new ob_frame();
-    impl->frame = std::const_pointer_cast<libobsensor::Frame>(innerFrame);  // todo: it's not safe to cast const to non-const, fix it;
-    return impl;
+    return getFramesetMemberHandle(frameset, innerFrame);
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frameset)
 
@@ -496,9 +567,7 @@ ob_frame *ob_frameset_get_frame(const ob_frame *frameset, ob_frame_type frame_ty
     if(innerFrame == nullptr) {
         return nullptr;
     }
-    auto impl   = new ob_frame();
-    impl->frame = std::const_pointer_cast<libobsensor::Frame>(innerFrame);  // todo: it's not safe to cast const to non-const, fix it
-    return impl;
+    return getFramesetMemberHandle(frameset, innerFrame);
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frameset)
 
@@ -511,9 +580,7 @@ ob_frame *ob_frameset_get_frame_by_index(const ob_frame *frameset, uint32_t inde
     if(innerFrame == nullptr) {
         return nullptr;
     }
-    auto impl   = new ob_frame();
-    impl->frame = std::const_pointer_cast<libobsensor::Frame>(innerFrame);  // todo: it's not safe to cast const to non-const, fix it
-    return impl;
+    return getFramesetMemberHandle(frameset, innerFrame);
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frameset)
 
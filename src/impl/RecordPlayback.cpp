@@ -6,6 +6,7 @@
 #include "ImplTypes.hpp"
 #include "record/RecordDevice.hpp"
 #include "playback/PlaybackDevice.hpp"
+#include "offline/OfflineProcessor.hpp"
 #include "IDevice.hpp"
 
 #include <memory>
@@ -25,6 +26,21 @@ ob_record_device *ob_create_record_device(ob_device *device, const char *file_pa
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file_path, compression_enabled)
 
+ob_record_device *ob_create_record_device_ex(ob_device *device, const char *file_path, bool compression_enabled, ob_record_depth_codec depth_codec,
+                                             ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(file_path);
+    if(depth_codec != OB_RECORD_DEPTH_CODEC_NONE && depth_codec != OB_RECORD_DEPTH_CODEC_DELTA) {
+        THROW_INVALID_PARAM_EXCEPTION("Invalid depth codec: " + std::to_string(depth_codec));
+    }
+    auto recorder = std::make_shared<libobsensor::RecordDevice>(device->device, file_path, compression_enabled, depth_codec);
+
+    auto impl      = new ob_record_device();
+    impl->recorder = recorder;
+    return impl;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file_path, compression_enabled, depth_codec)
+
 void ob_delete_record_device(ob_record_device *recorder, ob_error **error) BEGIN_API_CALL {
     VALIDATE_NOT_NULL(recorder);
     delete recorder;
@@ -84,6 +100,20 @@ void ob_playback_device_set_playback_rate(ob_device *player, const float rate, o
 }
 HANDLE_EXCEPTIONS_NO_RETURN(player, rate)
 
+void ob_playback_device_set_max_throughput_mode(ob_device *player, bool enable, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(player);
+    auto playerPtr = std::dynamic_pointer_cast<libobsensor::PlaybackDevice>(player->device);
+    playerPtr->setMaxThroughputMode(enable);
+}
+HANDLE_EXCEPTIONS_NO_RETURN(player, enable)
+
+bool ob_playback_device_is_max_throughput_mode(ob_device *player, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(player);
+    auto playerPtr = std::dynamic_pointer_cast<libobsensor::PlaybackDevice>(player->device);
+    return playerPtr->isMaxThroughputMode();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(false, player)
+
 ob_playback_status ob_playback_device_get_current_playback_status(ob_device *player, ob_error **error) BEGIN_API_CALL {
     VALIDATE_NOT_NULL(player);
     auto playerPrt = std::dynamic_pointer_cast<libobsensor::PlaybackDevice>(player->device);
@@ -114,6 +144,68 @@ uint64_t ob_playback_device_get_duration(ob_device *player, ob_error **error) BE
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, player)
 
+ob_offline_processor *ob_create_offline_processor(const char *file_path, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(file_path);
+    auto impl       = new ob_offline_processor();
+    impl->processor = std::make_shared<libobsensor::OfflineProcessor>(file_path);
+    return impl;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, file_path)
+
+void ob_delete_offline_processor(ob_offline_processor *processor, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(processor);
+    delete processor;
+}
+HANDLE_EXCEPTIONS_NO_RETURN(processor)
+
+void ob_offline_processor_add_filter(ob_offline_processor *processor, ob_filter *filter, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(processor);
+    VALIDATE_NOT_NULL(filter);
+    processor->processor->addFilter(filter->filter);
+}
+HANDLE_EXCEPTIONS_NO_RETURN(processor, filter)
+
+void ob_offline_processor_set_worker_count(ob_offline_processor *processor, uint32_t count, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(processor);
+    processor->processor->setWorkerCount(count);
+}
+HANDLE_EXCEPTIONS_NO_RETURN(processor, count)
+
+void ob_offline_processor_set_segment_duration(ob_offline_processor *processor, uint64_t duration_ms, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(processor);
+    processor->processor->setSegmentDuration(duration_ms);
+}
+HANDLE_EXCEPTIONS_NO_RETURN(processor, duration_ms)
+
+void ob_offline_processor_enable_frame_sync(ob_offline_processor *processor, bool enable, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(processor);
+    processor->processor->enableFrameSync(enable);
+}
+HANDLE_EXCEPTIONS_NO_RETURN(processor, enable)
+
+uint64_t ob_offline_processor_get_duration(ob_offline_processor *processor, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(processor);
+    return processor->processor->getDuration();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, processor)
+
+void ob_offline_processor_process(ob_offline_processor *processor, ob_frame_callback callback, void *user_data, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(processor);
+    VALIDATE_NOT_NULL(callback);
+    processor->processor->process([callback, user_data](std::shared_ptr<const libobsensor::Frame> frame) {
+        auto impl   = new ob_frame();
+        impl->frame = std::const_pointer_cast<libobsensor::Frame>(frame);
+        callback(impl, user_data);
+    });
+}
+HANDLE_EXCEPTIONS_NO_RETURN(processor, callback, user_data)
+
+void ob_offline_processor_stop(ob_offline_processor *processor, ob_error **error) BEGIN_API_CALL {
+    VALIDATE_NOT_NULL(processor);
+    processor->processor->stop();
+}
+HANDLE_EXCEPTIONS_NO_RETURN(processor)
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
\ No newline at end of file
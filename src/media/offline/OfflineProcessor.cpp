@@ -0,0 +1,285 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#include "OfflineProcessor.hpp"
+#include "FilterFactory.hpp"
+#include "Config.hpp"
+#include "FrameAggregator.hpp"
+#include "utils/MediaUtils.hpp"
+#include "utils/PublicTypeHelper.hpp"
+#include "exception/ObException.hpp"
+#include "logger/Logger.hpp"
+
+#include <algorithm>
+
+namespace libobsensor {
+
+OfflineProcessor::OfflineProcessor(const std::string &filePath)
+    : filePath_(filePath),
+      durationMs_(0),
+      workerCount_(std::max<uint32_t>(1, std::thread::hardware_concurrency())),
+      segmentDurationMs_(1000),
+      frameSyncEnabled_(true),
+      nextSegment_(0),
+      deliverSegment_(0),
+      maxInFlightSegments_(0),
+      stopped_(false) {
+    // Open the file once to validate it and get the duration, each worker opens its own reader later.
+    auto reader = std::make_shared<RosReader>(filePath_);
+
+    double version = 1.0;
+    auto   data    = reader->getPropertyData(versionPropertyId_);
+    if(data.size() >= sizeof(double)) {
+        version = *reinterpret_cast<double *>(data.data());
+    }
+    if(!utils::validateBagFileVersion(version)) {
+        THROW_UNSUPPORTED_OPERATION_EXCEPTION(utils::createUnsupportedBagFileVersionMessage(version));
+    }
+
+    durationMs_ = static_cast<uint64_t>(reader->getDuration().count()) / playbackTimeFreq_;
+}
+
+OfflineProcessor::~OfflineProcessor() noexcept {
+    stop();
+    for(auto &worker: workers_) {
+        if(worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void OfflineProcessor::addFilter(std::shared_ptr<IFilter> filter) {
+    if(!filter) {
+        THROW_INVALID_PARAM_EXCEPTION("Invalid filter, filter is nullptr");
+    }
+    filters_.push_back(filter);
+}
+
+void OfflineProcessor::setWorkerCount(uint32_t count) {
+    workerCount_ = std::max<uint32_t>(1, count);
+}
+
+void OfflineProcessor::setSegmentDuration(uint64_t durationMs) {
+    if(durationMs == 0) {
+        THROW_INVALID_PARAM_EXCEPTION("Invalid segment duration, must be greater than 0");
+    }
+    segmentDurationMs_ = durationMs;
+}
+
+void OfflineProcessor::enableFrameSync(bool enable) {
+    frameSyncEnabled_ = enable;
+}
+
+uint64_t OfflineProcessor::getDuration() const {
+    return durationMs_;
+}
+
+std::vector<std::shared_ptr<IFilter>> OfflineProcessor::cloneFilters() const {
+    // Filters keep processing state, so each worker runs its own instances with the same config as the user's filters.
+    auto                                  factory = FilterFactory::getInstance();
+    std::vector<std::shared_ptr<IFilter>> filters;
+    for(auto &filter: filters_) {
+        auto clone = factory->createFilter(filter->getName());
+        for(auto &item: filter->getConfigSchemaVec()) {
+            clone->setConfigValueSync(item.name, filter->getConfigValue(item.name));
+        }
+        clone->enable(filter->isEnabled());
+        filters.push_back(clone);
+    }
+    return filters;
+}
+
+void OfflineProcessor::process(FrameCallback callback) {
+    if(!callback) {
+        THROW_INVALID_PARAM_EXCEPTION("Invalid callback, callback is nullptr");
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if(!workers_.empty()) {
+            THROW_WRONG_API_CALL_SEQUENCE_EXCEPTION("Offline processor is already processing!");
+        }
+        segments_.clear();
+        for(uint64_t begin = 0; begin <= durationMs_; begin += segmentDurationMs_) {
+            segments_.push_back({ begin, begin + segmentDurationMs_, {}, false });
+        }
+        nextSegment_    = 0;
+        deliverSegment_ = 0;
+        stopped_        = false;
+    }
+
+    auto workerCount     = std::min<size_t>(workerCount_, segments_.size());
+    maxInFlightSegments_ = workerCount * 2;
+    LOG_DEBUG("Start offline processing, file: {}, duration: {}ms, segments: {}, workers: {}", filePath_, durationMs_, segments_.size(), workerCount);
+    for(size_t i = 0; i < workerCount; i++) {
+        workers_.emplace_back(&OfflineProcessor::workerLoop, this);
+    }
+
+    // Deliver the results in segment order on the calling thread
+    while(true) {
+        std::shared_ptr<const Frame> frame;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() {
+                return stopped_ || deliverSegment_ >= segments_.size() || !segments_[deliverSegment_].results.empty() || segments_[deliverSegment_].done;
+            });
+            if(stopped_ || deliverSegment_ >= segments_.size()) {
+                break;
+            }
+
+            auto &segment = segments_[deliverSegment_];
+            if(segment.results.empty()) {
+                deliverSegment_++;
+                cv_.notify_all();
+                continue;
+            }
+            frame = segment.results.front();
+            segment.results.pop_front();
+        }
+        callback(frame);
+    }
+
+    stop();
+    for(auto &worker: workers_) {
+        if(worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+    segments_.clear();
+    LOG_DEBUG("Offline processing finished, file: {}", filePath_);
+}
+
+void OfflineProcessor::stop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stopped_ = true;
+    cv_.notify_all();
+}
+
+void OfflineProcessor::workerLoop() {
+    std::shared_ptr<RosReader>            reader;
+    std::vector<std::shared_ptr<IFilter>> filters;
+    std::shared_ptr<FrameAggregator>      aggregator;
+    size_t                                currentSegment = 0;
+
+    try {
+        reader  = std::make_shared<RosReader>(filePath_);
+        filters = cloneFilters();
+        if(frameSyncEnabled_) {
+            auto config = std::make_shared<Config>();
+            for(auto sensorType: reader->getSensorTypeList()) {
+                auto profile = reader->getStreamProfile(utils::mapSensorTypeToStreamType(sensorType));
+                if(profile) {
+                    config->enableStream(profile);
+                }
+            }
+            aggregator = std::make_shared<FrameAggregator>();
+            aggregator->updateConfig(config, true);
+            aggregator->enableFrameSync(FrameSyncModeSyncAccordingFrameTimestamp);
+            aggregator->setCallback([this, &currentSegment, &filters](std::shared_ptr<const Frame> frameSet) {  //
+                runFilters(currentSegment, frameSet, filters);
+            });
+        }
+    }
+    catch(const libobsensor_exception &e) {
+        LOG_ERROR("Offline processor: failed to initialize worker, {}", e.what());
+        stop();
+        return;
+    }
+
+    // Limit the number of segments in flight, so that the buffered results are bounded while waiting for delivery
+    while(true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() {
+                return stopped_ || nextSegment_ >= segments_.size() || nextSegment_ < deliverSegment_ + maxInFlightSegments_;
+            });
+            if(stopped_ || nextSegment_ >= segments_.size()) {
+                break;
+            }
+            currentSegment = nextSegment_++;
+        }
+
+        processSegment(currentSegment, reader, aggregator, filters);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        segments_[currentSegment].done = true;
+        cv_.notify_all();
+    }
+
+    if(aggregator) {
+        aggregator->setCallback(nullptr);
+    }
+}
+
+void OfflineProcessor::processSegment(size_t index, std::shared_ptr<RosReader> reader, std::shared_ptr<FrameAggregator> aggregator,
+                                      const std::vector<std::shared_ptr<IFilter>> &filters) {
+    const auto beginTime = std::chrono::nanoseconds(segments_[index].beginMs * playbackTimeFreq_);
+    const auto endTime   = std::chrono::nanoseconds(segments_[index].endMs * playbackTimeFreq_);
+
+    try {
+        reader->seekToTime(beginTime);
+    }
+    catch(const libobsensor_exception &e) {
+        LOG_WARN("Offline processor: failed to seek to {}ms, {}", segments_[index].beginMs, e.what());
+        return;
+    }
+
+    if(aggregator) {
+        // Frames left over from the previous segment belong to another part of the timeline
+        aggregator->clearAllFrameQueue();
+    }
+
+    while(!stopped_ && !reader->getIsEndOfFile() && reader->getCurTime() < endTime) {
+        std::shared_ptr<Frame> frame;
+        try {
+            frame = reader->readNextData();
+        }
+        catch(const orbbecRosbag::Exception &e) {
+            LOG_ERROR("Error when reading data from .bag file: {}", e.what());
+            continue;
+        }
+        catch(const libobsensor_exception &e) {
+            LOG_WARN("Error when create playback frame, message: {}", e.what());
+            continue;
+        }
+
+        if(!frame) {
+            continue;
+        }
+
+        if(aggregator) {
+            aggregator->pushFrame(frame);
+        }
+        else {
+            runFilters(index, frame, filters);
+        }
+    }
+}
+
+void OfflineProcessor::runFilters(size_t index, std::shared_ptr<const Frame> frame, const std::vector<std::shared_ptr<IFilter>> &filters) {
+    for(auto &filter: filters) {
+        if(!frame) {
+            return;
+        }
+        if(!filter->isEnabled()) {
+            continue;
+        }
+        BEGIN_TRY_EXECUTE({ frame = filter->process(frame); })
+        CATCH_EXCEPTION_AND_EXECUTE({
+            LOG_WARN("Filter {}: exception caught while processing frame {}#{}, this frame will be dropped", filter->getName(), frame->getType(),
+                     frame->getNumber());
+            return;
+        })
+    }
+
+    if(!frame) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    segments_[index].results.push_back(frame);
+    cv_.notify_all();
+}
+
+}  // namespace libobsensor
@@ -0,0 +1,94 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "IFilter.hpp"
+#include "frame/Frame.hpp"
+#include "ros/RosbagReader.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace libobsensor {
+
+class FrameAggregator;
+
+/**
+ * Process a recording file offline as fast as possible.
+ *
+ * The timeline of the recording is split into segments which are processed by a pool of worker threads. Each worker owns its own reader and its own
+ * copy of the filter chain, so the filters run synchronously without the per-filter threads. The results are delivered on the calling thread in
+ * segment order, so the output order of each stream is the same as in the recording.
+ */
+class OfflineProcessor {
+public:
+    OfflineProcessor(const std::string &filePath);
+    ~OfflineProcessor() noexcept;
+
+    void addFilter(std::shared_ptr<IFilter> filter);
+    void setWorkerCount(uint32_t count);
+    void setSegmentDuration(uint64_t durationMs);
+    void enableFrameSync(bool enable);
+
+    uint64_t getDuration() const;  // in milliseconds
+
+    // Blocking, returns after all segments are processed and delivered or stop() is called
+    void process(FrameCallback callback);
+    void stop();
+
+private:
+    struct Segment {
+        uint64_t                                 beginMs;
+        uint64_t                                 endMs;
+        std::deque<std::shared_ptr<const Frame>> results;
+        bool                                     done;
+    };
+
+    void                                  workerLoop();
+    void                                  processSegment(size_t index, std::shared_ptr<RosReader> reader, std::shared_ptr<FrameAggregator> aggregator,
+                                                         const std::vector<std::shared_ptr<IFilter>> &filters);
+    void                                  runFilters(size_t index, std::shared_ptr<const Frame> frame, const std::vector<std::shared_ptr<IFilter>> &filters);
+    std::vector<std::shared_ptr<IFilter>> cloneFilters() const;
+
+private:
+    const std::string filePath_;
+    uint64_t          durationMs_;
+
+    std::vector<std::shared_ptr<IFilter>> filters_;
+    uint32_t                              workerCount_;
+    uint64_t                              segmentDurationMs_;
+    bool                                  frameSyncEnabled_;
+
+    std::mutex               mutex_;
+    std::condition_variable  cv_;
+    std::vector<Segment>     segments_;
+    size_t                   nextSegment_;
+    size_t                   deliverSegment_;
+    size_t                   maxInFlightSegments_;  // bounds the buffered results while waiting for delivery
+    std::atomic<bool>        stopped_;
+    std::vector<std::thread> workers_;
+
+    const uint64_t playbackTimeFreq_  = 1000000;  // for converting ns to ms
+    const uint32_t versionPropertyId_ = 0;        // used to get version number of recording file
+};
+
+}  // namespace libobsensor
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct ob_offline_processor_t {
+    std::shared_ptr<libobsensor::OfflineProcessor> processor;
+};
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -763,6 +763,14 @@ void PlaybackDevice::setPlaybackRate(const float rate) {
     port_->setPlaybackRate(rate);
 }
 
+void PlaybackDevice::setMaxThroughputMode(bool enable) {
+    port_->setMaxThroughputMode(enable);
+}
+
+bool PlaybackDevice::isMaxThroughputMode() const {
+    return port_->isMaxThroughputMode();
+}
+
 uint64_t PlaybackDevice::getDuration() const {
     return port_->getDuration();
 }
@@ -24,6 +24,8 @@ public:
 
     void     seek(const uint64_t timestamp);
     void     setPlaybackRate(const float rate);
+    void     setMaxThroughputMode(bool enable);
+    bool     isMaxThroughputMode() const;
     uint64_t getDuration() const;
     uint64_t getPosition() const;
 
@@ -17,6 +17,10 @@ PlaybackDevicePort::PlaybackDevicePort(const std::string &filePath)
       seekOccurred_(false),
       needUpdateBaseTime_(true),
       isLooping_(true),
+      prefetchGeneration_(0),
+      prefetchEndOfFile_(false),
+      position_(0),
+      maxThroughputMode_(false),
       playbackStatus_(OB_PLAYBACK_STOPPED),
       duration_(0),
       baseFrameTimestamp_(0),
@@ -52,9 +56,13 @@ PlaybackDevicePort::PlaybackDevicePort(const std::string &filePath)
             needUpdateBaseTime_ = true;
             LOG_DEBUG("Change needUpdateBaseTime_ to true");
             playbackCv_.notify_all();
+            prefetchCv_.notify_all();
         },
         true);
 
+    // The prefetch thread reads and decodes frames ahead of the pacing thread, so that the decompression and deserialization cost does not add jitter
+    // to the output timing.
+    prefetchThread_ = std::thread(&PlaybackDevicePort::prefetchLoop, this);
     playbackThread_ = std::thread(&PlaybackDevicePort::playbackLoop, this);
 }
 
@@ -64,12 +72,17 @@ PlaybackDevicePort::~PlaybackDevicePort() {
         std::unique_lock<std::mutex> lock(playbackMutex_);
         isLooping_ = false;
         playbackCv_.notify_all();
+        prefetchCv_.notify_all();
     }
 
     if(playbackThread_.joinable()) {
         playbackThread_.join();
     }
 
+    if(prefetchThread_.joinable()) {
+        prefetchThread_.join();
+    }
+
     LOG_DEBUG("~PlaybackDevicePort done");
 }
 
@@ -101,6 +114,7 @@ void PlaybackDevicePort::stopStream(std::shared_ptr<const StreamProfile> profile
     }
 
     auto                         sensorType = utils::mapStreamTypeToSensorType(profile->getType());
+    std::unique_lock<std::mutex> readerLock(readerMutex_);
     std::unique_lock<std::mutex> lock(playbackMutex_);
     activeSensors_.reset(sensorType);
     auto freameQueue = getFrameQueue(sensorType);
@@ -112,16 +126,21 @@ void PlaybackDevicePort::stopStream(std::shared_ptr<const StreamProfile> profile
 
     if(activeSensors_.none()) {
         reader_->stop();
+        resetPrefetchQueue();
+        position_ = 0;
         playbackStatus_.transitionTo(OB_PLAYBACK_STOPPED);
     }
     playbackCv_.notify_all();
 }
 
 void PlaybackDevicePort::stopAllStream() {
+    std::unique_lock<std::mutex> readerLock(readerMutex_);
     std::unique_lock<std::mutex> lock(playbackMutex_);
     activeSensors_.reset();
     playbackStatus_.transitionTo(OB_PLAYBACK_STOPPED);
     reader_->stop();
+    resetPrefetchQueue();
+    position_ = 0;
 
     playbackCv_.notify_all();
 }
@@ -140,96 +159,183 @@ StreamProfileList PlaybackDevicePort::getStreamProfileList(OBSensorType sensorTy
     return spList;
 }
 
-void PlaybackDevicePort::playbackLoop() {
+void PlaybackDevicePort::prefetchLoop() {
+    // must be called with playbackMutex_ held
+    auto canPrefetch = [this]() {
+        return !prefetchEndOfFile_ && prefetchQueue_.size() < prefetchQueueSize_ && !activeSensors_.none()
+               && playbackStatus_.getCurrentState() != OB_PLAYBACK_STOPPED;
+    };
     while(isLooping_) {
         {
             std::unique_lock<std::mutex> lock(playbackMutex_);
-            playbackCv_.wait(lock, [this]() {
-                return !isLooping_ || seekOccurred_ || (playbackStatus_.getCurrentState() == OB_PLAYBACK_PLAYING && !activeSensors_.none());
-            });
+            prefetchCv_.wait(lock, [&]() { return !isLooping_ || canPrefetch(); });
             if(!isLooping_) {
                 break;
             }
         }
 
-        bool seekOccurred = seekOccurred_.load();
-        seekOccurred_.store(false);
-        bool isEndOfFile = reader_->getIsEndOfFile();
-        if(!isEndOfFile) {
-            std::shared_ptr<Frame>   frame;
-            std::chrono::nanoseconds lastTime;
-            try {
-                frame    = reader_->readNextData();
-                lastTime = reader_->getCurTime();
-            }
-            catch(const orbbecRosbag::Exception &e) {
-                LOG_ERROR("Error when reading data from .bag file: {}", e.what());
+        // The reader is held from taking the generation to the end of the read. A seek moves the reader and bumps the generation under the
+        // same mutex, so the frame read is always of the generation taken.
+        std::unique_lock<std::mutex> readerLock(readerMutex_);
+        uint64_t                     generation = 0;
+        {
+            std::unique_lock<std::mutex> lock(playbackMutex_);
+            if(!isLooping_ || !canPrefetch()) {
                 continue;
             }
-            catch(const libobsensor_exception &e) {
-                LOG_WARN("Error when create playback frame, message: {}", e.what());
-            }
+            generation = prefetchGeneration_;
+        }
 
-            if(!frame) {
-                LOG_DEBUG("The frame is empty when reading from .bag file");
-                continue;
+        PrefetchItem item = { nullptr, 0, generation, false };
+        try {
+            if(reader_->getIsEndOfFile()) {
+                item.endOfFile = true;
             }
+            else {
+                item.position = static_cast<uint64_t>(reader_->getCurTime().count()) / playbackTimeFreq_;
+                item.frame    = reader_->readNextData();
+            }
+        }
+        catch(const orbbecRosbag::Exception &e) {
+            LOG_ERROR("Error when reading data from .bag file: {}", e.what());
+            continue;
+        }
+        catch(const libobsensor_exception &e) {
+            LOG_WARN("Error when create playback frame, message: {}", e.what());
+        }
+        readerLock.unlock();
 
-            // If seek occurred, output frame directly
-            if(!seekOccurred) {
-                uint64_t sleepTimeUs = calculateSleepTime(frame->getTimeStampUsec());  // in microseconds
-                if(sleepTimeUs > 0) {
-                    std::unique_lock<std::mutex> lock(playbackMutex_);
-
-                    auto waitDuration  = std::chrono::microseconds(sleepTimeUs);
-                    bool isInterrupted = playbackCv_.wait_for(lock, waitDuration, [this]() {
-                        // Note: playback status should acquire here rather than lambda capture.
-                        auto playbackStatus = playbackStatus_.getCurrentState();
-                        return !isLooping_ || seekOccurred_ || playbackStatus != OB_PLAYBACK_PLAYING;
-                    });
-
-                    if(isInterrupted) {
-                        if(!isLooping_) {
-                            LOG_DEBUG("Interrupted sleep of {}us: playback loop terminated", sleepTimeUs);
-                        }
-                        else if(seekOccurred_) {
-                            LOG_DEBUG("Interrupted sleep of {}us: seek occurred", sleepTimeUs);
-                        }
-                        else {
-                            auto status = playbackStatus_.getCurrentState();
-                            LOG_DEBUG("Interrupted sleep of {}us, playback status changed to {}", sleepTimeUs, status);
+        if(!item.endOfFile && !item.frame) {
+            LOG_DEBUG("The frame is empty when reading from .bag file");
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(playbackMutex_);
+        if(generation != prefetchGeneration_) {
+            // seek or stop occurred after the read, the frame belongs to the previous playback progress
+            continue;
+        }
+        if(item.endOfFile) {
+            prefetchEndOfFile_ = true;
+        }
+        prefetchQueue_.push_back(item);
+        playbackCv_.notify_all();
+    }
+}
+
+bool PlaybackDevicePort::popPrefetchItem(PrefetchItem &item) {
+    std::unique_lock<std::mutex> lock(playbackMutex_);
+    playbackCv_.wait(lock, [this]() {
+        return !isLooping_
+               || ((seekOccurred_ || (playbackStatus_.getCurrentState() == OB_PLAYBACK_PLAYING && !activeSensors_.none())) && !prefetchQueue_.empty());
+    });
+    if(!isLooping_) {
+        return false;
+    }
+
+    item = prefetchQueue_.front();
+    prefetchQueue_.pop_front();
+    prefetchCv_.notify_all();
+    return true;
+}
+
+void PlaybackDevicePort::resetPrefetchQueue() {
+    prefetchQueue_.clear();
+    prefetchGeneration_++;
+    prefetchEndOfFile_ = false;
+    prefetchCv_.notify_all();
+}
+
+void PlaybackDevicePort::playbackLoop() {
+    while(isLooping_) {
+        PrefetchItem item;
+        if(!popPrefetchItem(item)) {
+            break;
+        }
+
+        if(item.endOfFile) {
+            stopAllStream();
+            LOG_DEBUG("Playing stopped...");
+            continue;
+        }
+
+        bool seekOccurred = seekOccurred_.load();
+        seekOccurred_.store(false);
+
+        // If seek occurred or in max throughput mode, output frame directly
+        if(!seekOccurred && !maxThroughputMode_) {
+            uint64_t sleepTimeUs = calculateSleepTime(item.frame->getTimeStampUsec());  // in microseconds
+            if(sleepTimeUs > 0) {
+                std::unique_lock<std::mutex> lock(playbackMutex_);
+
+                auto waitDuration  = std::chrono::microseconds(sleepTimeUs);
+                bool isInterrupted = playbackCv_.wait_for(lock, waitDuration, [this]() {
+                    // Note: playback status should acquire here rather than lambda capture.
+                    auto playbackStatus = playbackStatus_.getCurrentState();
+                    return !isLooping_ || seekOccurred_ || maxThroughputMode_ || playbackStatus != OB_PLAYBACK_PLAYING;
+                });
+
+                if(isInterrupted && !maxThroughputMode_) {
+                    if(!isLooping_) {
+                        LOG_DEBUG("Interrupted sleep of {}us: playback loop terminated", sleepTimeUs);
+                    }
+                    else if(seekOccurred_) {
+                        LOG_DEBUG("Interrupted sleep of {}us: seek occurred", sleepTimeUs);
+                    }
+                    else {
+                        auto status = playbackStatus_.getCurrentState();
+                        LOG_DEBUG("Interrupted sleep of {}us, playback status changed to {}", sleepTimeUs, status);
+                        if(item.generation == prefetchGeneration_) {
+                            // keep the frame for resuming, it will be output once playback is resumed
+                            prefetchQueue_.push_front(item);
                         }
-                        continue;
                     }
-                }
-
-                auto currentTime = reader_->getCurTime();
-                if(currentTime != lastTime) {
-                    LOG_DEBUG("Playback progress changed, discard the current frame... index: {}", frame->getNumber());
                     continue;
                 }
             }
+        }
 
-            auto sensorType = utils::mapFrameTypeToSensorType(frame->getType());
-            {
-                std::lock_guard<std::mutex> lock(playbackMutex_);
-                if(!activeSensors_.test(sensorType) || !frameQueues_.count(sensorType)) {
-                    continue;
-                }
+        {
+            std::lock_guard<std::mutex> lock(playbackMutex_);
+            if(item.generation != prefetchGeneration_) {
+                LOG_DEBUG("Playback progress changed, discard the current frame... index: {}", item.frame->getNumber());
+                continue;
             }
-            auto &frameQueue = getFrameQueue(sensorType);
-            frameQueue->enqueue(frame);
         }
-        else {
-            stopAllStream();
-            LOG_DEBUG("Playing stopped...");
+
+        position_ = item.position;
+        outputFrame(item.frame, item.generation);
+    }
+}
+
+bool PlaybackDevicePort::outputFrame(std::shared_ptr<Frame> frame, uint64_t generation) {
+    auto                               sensorType = utils::mapFrameTypeToSensorType(frame->getType());
+    std::shared_ptr<FrameQueue<Frame>> frameQueue;
+    {
+        std::lock_guard<std::mutex> lock(playbackMutex_);
+        if(!activeSensors_.test(sensorType) || !frameQueues_.count(sensorType)) {
+            return false;
+        }
+        frameQueue = getFrameQueue(sensorType);
+    }
+
+    if(!maxThroughputMode_) {
+        return frameQueue->enqueue(frame);
+    }
+
+    // Max throughput mode: apply backpressure from the consumer instead of dropping the frame
+    while(!frameQueue->enqueueWait(frame, backpressureWaitMs_)) {
+        std::lock_guard<std::mutex> lock(playbackMutex_);
+        if(!isLooping_ || generation != prefetchGeneration_ || !activeSensors_.test(sensorType) || !maxThroughputMode_) {
+            return false;
         }
     }
+    return true;
 }
 
 std::shared_ptr<FrameQueue<Frame>> &PlaybackDevicePort::getFrameQueue(OBSensorType sensorType) {
     if(frameQueues_.count(sensorType) == 0) {
-        frameQueues_.insert({ sensorType, std::make_shared<FrameQueue<Frame>>(maxFrameQueueSize_) });
+        frameQueues_.insert({ sensorType, std::make_shared<FrameQueue<Frame>>(maxFrameQueueSize_, "playback_" + utils::obSensorToStr(sensorType)) });
     }
 
     return frameQueues_[sensorType];
@@ -252,14 +358,21 @@ uint64_t PlaybackDevicePort::getDuration() const {
 }
 
 uint64_t PlaybackDevicePort::getPosition() const {
-    auto pos = reader_->getCurTime().count() / playbackTimeFreq_;
-    return pos;
+    // The reader runs ahead of the output by the prefetch queue, so report the position of the last output frame.
+    return position_;
 }
 
 void PlaybackDevicePort::seek(uint64_t position) {
     try {
         auto seekTime = std::chrono::nanoseconds(position * playbackTimeFreq_);
+        // the prefetch thread does not read between the seek and the generation bump, see prefetchLoop
+        std::unique_lock<std::mutex> readerLock(readerMutex_);
         reader_->seekToTime(seekTime);
+        {
+            std::lock_guard<std::mutex> lock(playbackMutex_);
+            resetPrefetchQueue();
+            position_ = position;
+        }
         if(playbackStatus_.getCurrentState() == OB_PLAYBACK_PAUSED) {
             // Read last frames for all sensors before the seek time
             constexpr const std::chrono::nanoseconds preTime(500000000LL);  // 500ms
@@ -274,8 +387,7 @@ void PlaybackDevicePort::seek(uint64_t position) {
                         continue;
                     }
                 }
-                auto &frameQueue = getFrameQueue(sensorType);
-                frameQueue->enqueue(frame);
+                getFrameQueue(sensorType)->enqueue(frame);
             }
         }
         // Notify the loop thread
@@ -394,6 +506,21 @@ void PlaybackDevicePort::setPlaybackRate(const float &rate) {
     needUpdateBaseTime_ = true;
 }
 
+void PlaybackDevicePort::setMaxThroughputMode(bool enable) {
+    LOG_DEBUG("Set max throughput mode to {}", enable);
+    {
+        std::unique_lock<std::mutex> lock(baseTimestampMutex_);
+        maxThroughputMode_  = enable;
+        needUpdateBaseTime_ = true;
+    }
+    std::unique_lock<std::mutex> lock(playbackMutex_);
+    playbackCv_.notify_all();
+}
+
+bool PlaybackDevicePort::isMaxThroughputMode() const {
+    return maxThroughputMode_;
+}
+
 void PlaybackDevicePort::setPlaybackStatusCallback(const PlaybackStatusCallback callback) {
     playbackStatus_.clearGlobalCallbacks();
     playbackStatusCallback_ = callback;
@@ -16,6 +16,7 @@
 #include <string>
 #include <mutex>
 #include <bitset>
+#include <deque>
 
 namespace std {
 template <> struct hash<ob_playback_status> {
@@ -66,6 +67,8 @@ public:
     void resetBaseTimestamp();
 
     void setPlaybackRate(const float &rate);
+    void setMaxThroughputMode(bool enable);
+    bool isMaxThroughputMode() const;
     void setPlaybackStatusCallback(const PlaybackStatusCallback callback);
     void updateFrameBaseTimestamp(uint64_t frameTimestamp, uint64_t sysTimestamp);
 
@@ -81,7 +84,19 @@ public:
     std::vector<uint8_t> getRecordedStructData(uint32_t propertyId);
 
 private:
+    // Frame decoded ahead of the pacing thread by the prefetch thread
+    struct PrefetchItem {
+        std::shared_ptr<Frame> frame;
+        uint64_t               position;    // position of the frame in the recording, in milliseconds
+        uint64_t               generation;  // prefetch generation, bumped on seek/stop to discard stale frames
+        bool                   endOfFile;
+    };
+
     void     playbackLoop();
+    void     prefetchLoop();
+    bool     popPrefetchItem(PrefetchItem &item);
+    void     resetPrefetchQueue();  // must be called with playbackMutex_ held
+    bool     outputFrame(std::shared_ptr<Frame> frame, uint64_t generation);
     uint64_t calculateSleepTime(uint64_t timestamp);
 
     void startAsyncThread();
@@ -100,10 +115,19 @@ private:
     bool                    needUpdateBaseTime_;
     bool                    isLooping_;
     std::mutex              playbackMutex_;
+    std::mutex              readerMutex_;  // serializes the reads of the prefetch thread with seek and stop, taken before playbackMutex_
     std::mutex              baseTimestampMutex_;
     std::condition_variable playbackCv_;
     std::thread             playbackThread_;
 
+    std::deque<PrefetchItem> prefetchQueue_;
+    std::condition_variable  prefetchCv_;
+    std::thread              prefetchThread_;
+    uint64_t                 prefetchGeneration_;
+    bool                     prefetchEndOfFile_;
+    std::atomic<uint64_t>    position_;
+    std::atomic_bool         maxThroughputMode_;
+
     PlaybackStatusCallback playbackStatusCallback_;
     PlaybackStateMachine   playbackStatus_;
 
@@ -114,6 +138,8 @@ private:
     float    rate_;
 
     const uint32_t maxFrameQueueSize_ = 10;
+    const uint32_t prefetchQueueSize_ = 8;    // number of frames decoded ahead of the pacing thread
+    const uint32_t backpressureWaitMs_ = 50;  // max throughput mode: wait interval for room in the frame queue
     const uint32_t playbackTimeFreq_  = 1000000;     // for converting ns to ms
     const uint32_t rangeOffset_       = UINT16_MAX;  // used to get property range from recording file
     const uint32_t versionPropertyId_ = 0;           // used to get version number of recording file
@@ -8,6 +8,7 @@
 #include "IAlgParamManager.hpp"
 #include "property/InternalProperty.hpp"
 #include "utils/MediaUtils.hpp"
+#include "utils/PublicTypeHelper.hpp"
 #include "IDeviceSyncConfigurator.hpp"
 #include "openni/OpenNIDisparitySensor.hpp"
 #include "openni/OpenNIDeviceBase.hpp"
@@ -15,10 +16,10 @@
 
 namespace libobsensor {
 
-RecordDevice::RecordDevice(std::shared_ptr<IDevice> device, const std::string &filePath, bool compressionsEnabled)
+RecordDevice::RecordDevice(std::shared_ptr<IDevice> device, const std::string &filePath, bool compressionsEnabled, OBRecordDepthCodec depthCodec)
     : device_(device), filePath_(filePath), isCompressionsEnabled_(compressionsEnabled), maxFrameQueueSize_(UINT16_MAX), isPaused_(false) {
 
-    writer_ = std::make_shared<RosWriter>(filePath_, isCompressionsEnabled_);
+    writer_ = std::make_shared<RosWriter>(filePath_, isCompressionsEnabled_, depthCodec);
     writeAllProperties();
 
     const auto &sensorTypeList = device_->getSensorTypeList();
@@ -83,7 +84,7 @@ void RecordDevice::initializeFrameQueueOnce(OBSensorType sensorType, std::shared
     // todo: change lazy initialization to eager initialization
     std::call_once(*sensorOnceFlags_[sensorType], [this, sensorType, frame]() {
         std::unique_lock<std::mutex> lock(frameQueueInitMutex_);
-        frameQueueMap_[sensorType] = std::make_shared<FrameQueue<const Frame>>(maxFrameQueueSize_);
+        frameQueueMap_[sensorType] = std::make_shared<FrameQueue<const Frame>>(maxFrameQueueSize_, "record_" + utils::obSensorToStr(sensorType));
         frameQueueMap_[sensorType]->start([this, sensorType](std::shared_ptr<const Frame> frame) { writer_->writeFrame(sensorType, frame); });
     });
 }
@@ -98,6 +99,40 @@ void RecordDevice::writeAllProperties() {
     writeDepthWorkModeProperty();
     writeDepthPostFilterParamProperty();
     writeMultiDeviceSyncConfigProperty();
+    writePendingProperties();
+}
+
+void RecordDevice::writePendingProperties() {
+    // Read the values and then the ranges of all queued properties in two batches instead of two requests per property
+    std::vector<PropertyValueItem> values;
+    std::vector<PropertyRangeItem> ranges;
+    for(const auto &property: pendingProperties_) {
+        values.push_back({ property.id, {}, false });
+        ranges.push_back({ property.id, {}, false });
+    }
+
+    auto server = device_->getPropertyServer();
+    server->getPropertyValues(values, PROP_ACCESS_INTERNAL);
+    server->getPropertyRanges(ranges, PROP_ACCESS_INTERNAL);
+
+    for(size_t i = 0; i < pendingProperties_.size(); i++) {
+        auto id = pendingProperties_[i].id;
+        if(!values[i].success) {
+            LOG_WARN("Failed to record property: {}", id);
+            continue;
+        }
+        if(!ranges[i].success) {
+            LOG_WARN("Failed to record property range: {}", id);
+        }
+
+        try {
+            pendingProperties_[i].write(values[i].value, ranges[i].success ? &ranges[i].range : nullptr);
+        }
+        catch(const std::exception &e) {
+            LOG_WARN("Failed to record property: {}, message: {}", id, e.what());
+        }
+    }
+    pendingProperties_.clear();
 }
 
 void RecordDevice::stopRecord() {
@@ -15,18 +15,22 @@
 #include <map>
 #include <atomic>
 #include <condition_variable>
+#include <functional>
+#include <vector>
 
 namespace libobsensor {
 
 class RecordDevice {
 public:
-    RecordDevice(std::shared_ptr<IDevice> device, const std::string &filePath, bool compressionsEnabled = true);
+    RecordDevice(std::shared_ptr<IDevice> device, const std::string &filePath, bool compressionsEnabled = true,
+                 OBRecordDepthCodec depthCodec = OB_RECORD_DEPTH_CODEC_NONE);
     virtual ~RecordDevice() noexcept;
 
     void pause();
     void resume();
 
 private:
+    // The property is queued, the values and ranges of all queued properties are read in one batch by writePendingProperties()
     template <typename T> void writePropertyT(uint32_t id) {
         auto server = device_->getPropertyServer();
         if(!server->isPropertySupported(id, PROP_OP_READ, PROP_ACCESS_INTERNAL)) {
@@ -34,35 +38,29 @@ private:
             return;
         }
 
-        try {
-            T                    value = server->getPropertyValueT<T>(id);
-            std::vector<uint8_t> data(sizeof(T));
-            data.assign(reinterpret_cast<uint8_t *>(&value), reinterpret_cast<uint8_t *>(&value) + sizeof(T));
-            writer_->writeProperty(id, data.data(), static_cast<uint32_t>(data.size()));
-            writeProperyRangeT<T>(id);
-        }
-        catch(const std::exception &e) {
-            LOG_WARN("Failed to record property: {}, message: {}", id, e.what());
-        }
+        pendingProperties_.push_back({ id, [this, id](const OBPropertyValue &value, const OBPropertyRange *range) {
+                                          T                    valueT = fromPropertyValue<T>(value);
+                                          std::vector<uint8_t> data(reinterpret_cast<uint8_t *>(&valueT), reinterpret_cast<uint8_t *>(&valueT) + sizeof(T));
+                                          writer_->writeProperty(id, data.data(), static_cast<uint32_t>(data.size()));
+                                          if(range) {
+                                              OBPropertyRangeT<T> rangeT = { fromPropertyValue<T>(range->cur), fromPropertyValue<T>(range->max),
+                                                                             fromPropertyValue<T>(range->min), fromPropertyValue<T>(range->step),
+                                                                             fromPropertyValue<T>(range->def) };
+                                              data.assign(reinterpret_cast<uint8_t *>(&rangeT), reinterpret_cast<uint8_t *>(&rangeT) + sizeof(rangeT));
+                                              writer_->writeProperty(id + rangeOffset_, data.data(), static_cast<uint32_t>(data.size()));
+                                          }
+                                      } });
     }
 
-    template <typename T> void writeProperyRangeT(uint32_t id) {
-        auto server = device_->getPropertyServer();
-        if(!server->isPropertySupported(id, PROP_OP_READ, PROP_ACCESS_INTERNAL)) {
-            LOG_DEBUG("Property {} is not supported by device, skipping recording range", id);
-            return;
-        }
+    template <typename T> static typename std::enable_if<!std::is_same<T, float>::value, T>::type fromPropertyValue(const OBPropertyValue &value) {
+        return static_cast<T>(value.intValue);
+    }
 
-        try {
-            auto                 range = server->getPropertyRangeT<T>(id);
-            std::vector<uint8_t> data(sizeof(range));
-            data.assign(reinterpret_cast<uint8_t *>(&range), reinterpret_cast<uint8_t *>(&range) + sizeof(range));
-            writer_->writeProperty(id + rangeOffset_, data.data(), static_cast<uint32_t>(data.size()));
-        }
-        catch(const std::exception &e) {
-            LOG_WARN("Failed to record property range: {}, message: {}", id, e.what());
-        }
+    template <typename T> static typename std::enable_if<std::is_same<T, float>::value, T>::type fromPropertyValue(const OBPropertyValue &value) {
+        return value.floatValue;
     }
+
+    void writePendingProperties();
     void writeVersionProperty();
     void writeFilterProperty();
     void writeFrameGeometryProperty();
@@ -94,6 +92,12 @@ private:
     std::map<OBSensorType, std::shared_ptr<FrameQueue<const Frame>>> frameQueueMap_;
     std::map<OBSensorType, std::unique_ptr<std::once_flag>>          sensorOnceFlags_;
 
+    struct PendingProperty {
+        uint32_t                                                            id;
+        std::function<void(const OBPropertyValue &, const OBPropertyRange *)> write;  // range is nullptr if it could not be read
+    };
+    std::vector<PendingProperty> pendingProperties_;
+
     const uint32_t rangeOffset_       = UINT16_MAX;  // used to record property range
     const uint32_t versionPropertyId_ = 0;           // used to record version of recording file
 };
@@ -0,0 +1,365 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#include "DepthDeltaCodec.hpp"
+#include "exception/ObException.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace libobsensor {
+
+namespace {
+
+const uint32_t DEPTH_DELTA_MAGIC     = 0x3144444F;  // "ODD1"
+const uint8_t  DEPTH_DELTA_KEY_FRAME = 0x01;
+
+#pragma pack(push, 1)
+struct DepthDeltaFrameHeader {
+    uint32_t magic;
+    uint16_t width;
+    uint16_t height;
+    uint8_t  flags;
+    uint8_t  reserved[3];
+    uint32_t index;
+    uint64_t keyTag;
+};
+#pragma pack(pop)
+
+// maps the differences -1, 1, -2, 2... to 1, 2, 3, 4... so the small differences take few nibbles
+inline uint16_t zigzag(uint16_t diff) {
+    return static_cast<uint16_t>((static_cast<uint32_t>(diff) << 1) ^ (0u - (static_cast<uint32_t>(diff) >> 15)));
+}
+
+inline uint16_t unzigzag(uint32_t value) {
+    return static_cast<uint16_t>((value >> 1) ^ (0u - (value & 1)));
+}
+
+inline uint32_t nibbleCount(uint32_t value) {
+    return value < 8 ? 1 : value < 64 ? 2 : value < 512 ? 3 : value < 4096 ? 4 : value < 32768 ? 5 : 6;
+}
+
+class NibbleWriter {
+public:
+    explicit NibbleWriter(uint8_t *data) : begin_(data), data_(data), buffer_(0), nibbles_(0) {}
+
+    void put(uint32_t value) {
+        // the nibbles of the value from the lowest bits, all but the last with the continuation bit
+        uint32_t count = nibbleCount(value);
+        uint64_t code  = 0;
+        for(uint32_t i = 0; i < count; i++) {
+            code = (code << 4) | ((value >> (3 * i)) & 0x07) | (i + 1 < count ? 0x08 : 0);
+        }
+        buffer_ = (buffer_ << (4 * count)) | code;
+        nibbles_ += count;
+        if(nibbles_ >= 8) {
+            nibbles_ -= 8;
+            store(static_cast<uint32_t>(buffer_ >> (4 * nibbles_)));
+        }
+    }
+
+    // writes the last partial word, returns the size written
+    size_t finish() {
+        if(nibbles_) {
+            store(static_cast<uint32_t>(buffer_ << (4 * (8 - nibbles_))));
+            nibbles_ = 0;
+        }
+        return static_cast<size_t>(data_ - begin_);
+    }
+
+private:
+    void store(uint32_t word) {
+        data_[0] = static_cast<uint8_t>(word);
+        data_[1] = static_cast<uint8_t>(word >> 8);
+        data_[2] = static_cast<uint8_t>(word >> 16);
+        data_[3] = static_cast<uint8_t>(word >> 24);
+        data_ += 4;
+    }
+
+    uint8_t *begin_;
+    uint8_t *data_;
+    uint64_t buffer_;  // the nibbles not stored yet are the lowest ones
+    uint32_t nibbles_;
+};
+
+class NibbleReader {
+public:
+    NibbleReader(const uint8_t *data, const uint8_t *end) : data_(data), end_(end), word_(0), nibbles_(0) {}
+
+    // the values and the run lengths are 16 bit, so 6 nibbles at most
+    uint32_t get() {
+        uint32_t value = 0;
+        for(uint32_t shift = 0; shift < 18; shift += 3) {
+            if(nibbles_ == 0) {
+                load();
+            }
+            uint32_t nibble = word_ >> 28;
+            word_ <<= 4;
+            nibbles_--;
+            value |= (nibble & 0x07) << shift;
+            if(!(nibble & 0x08)) {
+                return value;
+            }
+        }
+        THROW_INVALID_DATA_EXCEPTION("Invalid delta coded depth frame: value out of range");
+    }
+
+private:
+    void load() {
+        if(end_ - data_ < 4) {
+            THROW_INVALID_DATA_EXCEPTION("Invalid delta coded depth frame: data truncated");
+        }
+        word_ = static_cast<uint32_t>(data_[0]) | (static_cast<uint32_t>(data_[1]) << 8) | (static_cast<uint32_t>(data_[2]) << 16)
+                | (static_cast<uint32_t>(data_[3]) << 24);
+        data_ += 4;
+        nibbles_ = 8;
+    }
+
+    const uint8_t *data_;
+    const uint8_t *end_;
+    uint32_t       word_;
+    uint32_t       nibbles_;
+};
+
+// Runs of zero pixels and of non-zero pixels, the non-zero pixels are the difference with the previous non-zero pixel of the row, starting
+// from the pixel above the row
+void encodeRowFromLeft(const uint16_t *row, const uint16_t *above, uint32_t width, NibbleWriter &writer) {
+    uint16_t prev = above ? above[0] : 0;
+    uint32_t x    = 0;
+    while(x < width) {
+        uint32_t start = x;
+        while(x < width && row[x] == 0) {
+            x++;
+        }
+        writer.put(x - start);
+        start = x;
+        while(x < width && row[x] != 0) {
+            x++;
+        }
+        writer.put(x - start);
+        for(uint32_t i = start; i < x; i++) {
+            writer.put(zigzag(static_cast<uint16_t>(row[i] - prev)));
+            prev = row[i];
+        }
+    }
+}
+
+// Runs of the pixels equal to the previous frame and of the pixels that differ, coded as the difference minus one
+void encodeRowFromPrevious(const uint16_t *row, const uint16_t *previous, uint32_t width, NibbleWriter &writer) {
+    uint32_t x = 0;
+    while(x < width) {
+        uint32_t start = x;
+        while(x < width && row[x] == previous[x]) {
+            x++;
+        }
+        writer.put(x - start);
+        start = x;
+        while(x < width && row[x] != previous[x]) {
+            x++;
+        }
+        writer.put(x - start);
+        for(uint32_t i = start; i < x; i++) {
+            writer.put(zigzag(static_cast<uint16_t>(row[i] - previous[i])) - 1u);
+        }
+    }
+}
+
+// Estimates the nibbles of a row for both predictions from one pixel in four, the choice only needs their order. The left prediction is
+// taken from the pixel on the left, if both are non-zero.
+void estimateRowNibbles(const uint16_t *row, const uint16_t *previous, uint32_t width, size_t &leftNibbles, size_t &previousNibbles) {
+    size_t left = 0, temporal = 0;
+    for(uint32_t x = 1; x < width; x += 4) {
+        uint16_t value = row[x];
+        if(value != 0 && row[x - 1] != 0) {
+            left += nibbleCount(zigzag(static_cast<uint16_t>(value - row[x - 1])));
+        }
+        if(value != previous[x]) {
+            temporal += nibbleCount(zigzag(static_cast<uint16_t>(value - previous[x])) - 1u);
+        }
+    }
+    leftNibbles     = left;
+    previousNibbles = temporal;
+}
+
+// reads the length of the next run, which must end in the row
+inline uint32_t getRunLength(NibbleReader &reader, uint32_t remaining) {
+    uint32_t length = reader.get();
+    if(length > remaining) {
+        THROW_INVALID_DATA_EXCEPTION("Invalid delta coded depth frame: run out of the row");
+    }
+    return length;
+}
+
+void decodeRowFromLeft(NibbleReader &reader, uint16_t *row, const uint16_t *above, uint32_t width) {
+    uint16_t prev = above ? above[0] : 0;
+    uint32_t x    = 0;
+    while(x < width) {
+        uint32_t zeros    = getRunLength(reader, width - x);
+        uint32_t nonZeros = getRunLength(reader, width - x - zeros);
+        if(zeros + nonZeros == 0) {
+            THROW_INVALID_DATA_EXCEPTION("Invalid delta coded depth frame: empty run");
+        }
+        std::fill(row + x, row + x + zeros, static_cast<uint16_t>(0));
+        x += zeros;
+        for(uint32_t end = x + nonZeros; x < end; x++) {
+            prev   = static_cast<uint16_t>(prev + unzigzag(reader.get()));
+            row[x] = prev;
+        }
+    }
+}
+
+// the row holds the previous frame, updated in place
+void decodeRowFromPrevious(NibbleReader &reader, uint16_t *row, uint32_t width) {
+    uint32_t x = 0;
+    while(x < width) {
+        uint32_t same      = getRunLength(reader, width - x);
+        uint32_t different = getRunLength(reader, width - x - same);
+        if(same + different == 0) {
+            THROW_INVALID_DATA_EXCEPTION("Invalid delta coded depth frame: empty run");
+        }
+        x += same;
+        for(uint32_t end = x + different; x < end; x++) {
+            row[x] = static_cast<uint16_t>(row[x] + unzigzag(reader.get() + 1));
+        }
+    }
+}
+
+}  // namespace
+
+DepthDeltaEncoder::DepthDeltaEncoder(uint32_t keyFrameInterval)
+    : keyFrameInterval_(std::max<uint32_t>(keyFrameInterval, 1)), frameIndex_(0), keyTag_(0), width_(0), height_(0) {}
+
+void DepthDeltaEncoder::reset() {
+    frameIndex_ = 0;
+}
+
+void DepthDeltaEncoder::encode(const uint16_t *data, uint32_t width, uint32_t height, uint64_t tag, std::vector<uint8_t> &output) {
+    if(width == 0 || height == 0 || width > UINT16_MAX || height > UINT16_MAX) {
+        THROW_INVALID_PARAM_EXCEPTION("Invalid frame size for the depth delta codec: " + std::to_string(width) + "x" + std::to_string(height));
+    }
+
+    bool keyFrame = frameIndex_ == 0 || width != width_ || height != height_;
+    if(keyFrame) {
+        frameIndex_ = 0;
+        keyTag_     = tag;
+        width_      = width;
+        height_     = height;
+        reference_.resize(static_cast<size_t>(width) * height);
+    }
+
+    // at most 8 nibbles per pixel: 6 for the value and 2 for the run lengths of the runs
+    size_t modesSize = (height + 7) / 8;
+    output.resize(sizeof(DepthDeltaFrameHeader) + modesSize + static_cast<size_t>(width) * height * 4 + 4);
+
+    DepthDeltaFrameHeader header = {};
+    header.magic                 = DEPTH_DELTA_MAGIC;
+    header.width                 = static_cast<uint16_t>(width);
+    header.height                = static_cast<uint16_t>(height);
+    header.flags                 = keyFrame ? DEPTH_DELTA_KEY_FRAME : 0;
+    header.index                 = frameIndex_;
+    header.keyTag                = keyTag_;
+    memcpy(output.data(), &header, sizeof(header));
+
+    uint8_t *modes = output.data() + sizeof(header);
+    memset(modes, 0, modesSize);
+    NibbleWriter writer(modes + modesSize);
+    for(uint32_t y = 0; y < height; y++) {
+        const uint16_t *row          = data + static_cast<size_t>(y) * width;
+        const uint16_t *above        = y > 0 ? row - width : nullptr;
+        const uint16_t *previous     = reference_.data() + static_cast<size_t>(y) * width;
+        bool            fromPrevious = false;
+        if(!keyFrame) {
+            if(memcmp(row, previous, width * sizeof(uint16_t)) == 0) {
+                fromPrevious = true;
+            }
+            else {
+                size_t leftNibbles, previousNibbles;
+                estimateRowNibbles(row, previous, width, leftNibbles, previousNibbles);
+                fromPrevious = previousNibbles < leftNibbles;
+            }
+        }
+
+        if(fromPrevious) {
+            modes[y / 8] |= static_cast<uint8_t>(1 << (y % 8));
+            encodeRowFromPrevious(row, previous, width, writer);
+        }
+        else {
+            encodeRowFromLeft(row, above, width, writer);
+        }
+    }
+    output.resize(sizeof(header) + modesSize + writer.finish());
+
+    memcpy(reference_.data(), data, reference_.size() * sizeof(uint16_t));
+    frameIndex_ = (frameIndex_ + 1) % keyFrameInterval_;
+}
+
+DepthDeltaDecoder::DepthDeltaDecoder() : hasReference_(false), referenceInfo_() {}
+
+DepthDeltaFrameInfo DepthDeltaDecoder::parseFrameInfo(const uint8_t *data, size_t size) {
+    DepthDeltaFrameHeader header;
+    if(size < sizeof(header)) {
+        THROW_INVALID_DATA_EXCEPTION("Invalid delta coded depth frame: data size " + std::to_string(size));
+    }
+    memcpy(&header, data, sizeof(header));
+    if(header.magic != DEPTH_DELTA_MAGIC || header.width == 0 || header.height == 0 || size < sizeof(header) + (header.height + 7) / 8) {
+        THROW_INVALID_DATA_EXCEPTION("Invalid delta coded depth frame: bad header");
+    }
+
+    DepthDeltaFrameInfo info;
+    info.width    = header.width;
+    info.height   = header.height;
+    info.keyFrame = (header.flags & DEPTH_DELTA_KEY_FRAME) != 0;
+    info.index    = header.index;
+    info.keyTag   = header.keyTag;
+    return info;
+}
+
+bool DepthDeltaDecoder::canDecode(const DepthDeltaFrameInfo &info) const {
+    if(info.keyFrame) {
+        return true;
+    }
+    return hasReference_ && referenceInfo_.keyTag == info.keyTag && referenceInfo_.index + 1 == info.index && referenceInfo_.width == info.width
+           && referenceInfo_.height == info.height;
+}
+
+void DepthDeltaDecoder::reset() {
+    hasReference_ = false;
+}
+
+void DepthDeltaDecoder::decode(const uint8_t *data, size_t size, uint16_t *output) {
+    auto info = parseFrameInfo(data, size);
+    if(!canDecode(info)) {
+        THROW_INVALID_DATA_EXCEPTION("The reference frame of the delta coded depth frame has not been decoded");
+    }
+
+    // the reference is decoded in place, it is invalid until the frame is decoded completely
+    hasReference_ = false;
+    if(info.keyFrame) {
+        reference_.resize(static_cast<size_t>(info.width) * info.height);
+    }
+
+    const uint8_t *modes     = data + sizeof(DepthDeltaFrameHeader);
+    size_t         modesSize = (info.height + 7) / 8;
+    NibbleReader   reader(modes + modesSize, data + size);
+    for(uint32_t y = 0; y < info.height; y++) {
+        uint16_t *row = reference_.data() + static_cast<size_t>(y) * info.width;
+        if(modes[y / 8] & (1 << (y % 8))) {
+            if(info.keyFrame) {
+                THROW_INVALID_DATA_EXCEPTION("Invalid delta coded depth frame: key frame predicted from the previous frame");
+            }
+            decodeRowFromPrevious(reader, row, info.width);
+        }
+        else {
+            decodeRowFromLeft(reader, row, y > 0 ? row - info.width : nullptr, info.width);
+        }
+    }
+
+    hasReference_  = true;
+    referenceInfo_ = info;
+    if(output) {
+        memcpy(output, reference_.data(), reference_.size() * sizeof(uint16_t));
+    }
+}
+
+}  // namespace libobsensor
@@ -0,0 +1,70 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace libobsensor {
+
+// Lossless codec of the 16 bit depth frames of the recordings.
+// Every row is predicted either from the pixels on its left, the zero pixels (no depth) being coded as runs as in RVL, or from the same row of
+// the previous frame, whichever is estimated to take fewer bits. The residuals are coded as runs of zeros and variable length nibbles (3 bits
+// and a continuation bit). The first frame of every group is a key frame, predicted from the left only, so a frame can be decoded from the key
+// frame of its group.
+//
+// An encoded frame is a header (DepthDeltaFrameHeader), the prediction of every row (one bit per row, set for the previous frame) and the
+// nibbles, packed in 32 bit little endian words from the most significant bits.
+
+struct DepthDeltaFrameInfo {
+    uint32_t width;
+    uint32_t height;
+    bool     keyFrame;
+    uint32_t index;   // index of the frame in its group, 0 for the key frame
+    uint64_t keyTag;  // tag of the key frame of the group
+};
+
+class DepthDeltaEncoder {
+public:
+    explicit DepthDeltaEncoder(uint32_t keyFrameInterval = 30);
+
+    // Encodes a frame of width x height packed pixels to output. The tag of a key frame is stored in all the frames of its group, the
+    // recorder passes the timestamp of the frames so the reader can find the key frame of a frame.
+    void encode(const uint16_t *data, uint32_t width, uint32_t height, uint64_t tag, std::vector<uint8_t> &output);
+
+    // The next frame is encoded as a key frame, used when the previous frame could not be written
+    void reset();
+
+private:
+    uint32_t              keyFrameInterval_;
+    uint32_t              frameIndex_;
+    uint64_t              keyTag_;
+    uint32_t              width_;
+    uint32_t              height_;
+    std::vector<uint16_t> reference_;
+};
+
+class DepthDeltaDecoder {
+public:
+    DepthDeltaDecoder();
+
+    // Reads the header of an encoded frame, throws if the data is not an encoded frame
+    static DepthDeltaFrameInfo parseFrameInfo(const uint8_t *data, size_t size);
+
+    // Whether the frame can be decoded: a key frame, or the frame following the last decoded frame in its group
+    bool canDecode(const DepthDeltaFrameInfo &info) const;
+
+    // Decodes the frame to width x height packed pixels, output may be null to only update the reference of the next frame
+    void decode(const uint8_t *data, size_t size, uint16_t *output);
+
+    void reset();
+
+private:
+    bool                  hasReference_;
+    DepthDeltaFrameInfo   referenceInfo_;
+    std::vector<uint16_t> reference_;
+};
+
+}  // namespace libobsensor
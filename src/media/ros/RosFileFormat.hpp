@@ -290,4 +290,11 @@ inline OBFormat convertStringToFormat(const std::string &encoding) {
     else
         return OB_FORMAT_UNKNOWN;
 }
+
+// The encoding of the depth frames coded by the DepthDeltaEncoder: this prefix followed by the encoding of the format of the frames
+const std::string DepthDeltaEncodingPrefix = "ob_delta/";
+
+inline bool isDepthDeltaEncoding(const std::string &encoding) {
+    return encoding.compare(0, DepthDeltaEncodingPrefix.size(), DepthDeltaEncodingPrefix) == 0;
+}
 }  // namespace libobsensor
@@ -348,6 +348,7 @@ std::shared_ptr<Frame> RosReader::readNextData() {
 }
 
 std::vector<std::shared_ptr<Frame>> RosReader::readLastDatas(const std::chrono::nanoseconds &startTime, const std::chrono::nanoseconds &endTime) {
+    std::lock_guard<std::mutex>         lock(readMutex_);
     std::vector<std::shared_ptr<Frame>> result;
     rosbag::View                        view(file_, FalseQuery());
     auto                                rosStartTime = toRosTime(startTime, startTime_.toSec());
@@ -399,9 +400,18 @@ std::shared_ptr<Frame> RosReader::createImuFrame(const rosbag::MessageInstance &
 std::shared_ptr<Frame> RosReader::createVideoFrame(const rosbag::MessageInstance &msg) {
     auto                         videoMsgTopic = msg.getTopic();
     sensor_msgs::Image::ConstPtr imagePtr      = msg.instantiate<sensor_msgs::Image>();
-    auto                         frame =
-        libobsensor::FrameFactory::createVideoFrameFromUserBuffer(RosTopic::getFrameTypeIdentifier(videoMsgTopic), convertStringToFormat(imagePtr->encoding),
-                                                                  imagePtr->width, imagePtr->height, (uint8_t *)imagePtr->data.data(), imagePtr->data.size());
+    std::shared_ptr<Frame>       frame;
+    if(isDepthDeltaEncoding(imagePtr->encoding)) {
+        frame = decodeDepthFrame(msg, *imagePtr);
+        if(!frame) {
+            return nullptr;
+        }
+    }
+    else {
+        frame = libobsensor::FrameFactory::createVideoFrameFromUserBuffer(RosTopic::getFrameTypeIdentifier(videoMsgTopic),
+                                                                          convertStringToFormat(imagePtr->encoding), imagePtr->width, imagePtr->height,
+                                                                          (uint8_t *)imagePtr->data.data(), imagePtr->data.size());
+    }
 
     frame->updateMetadata(imagePtr->metadata.data(), imagePtr->metadatasize);
     frame->setNumber(imagePtr->number);
@@ -415,6 +425,36 @@ std::shared_ptr<Frame> RosReader::createVideoFrame(const rosbag::MessageInstance
     return frame;
 }
 
+std::shared_ptr<Frame> RosReader::decodeDepthFrame(const rosbag::MessageInstance &msg, const sensor_msgs::Image &image) {
+    auto  topic   = msg.getTopic();
+    auto  info    = DepthDeltaDecoder::parseFrameInfo(image.data.data(), image.data.size());
+    auto &decoder = depthDecoders_[topic];
+    if(!decoder.canDecode(info)) {
+        // after a seek: decode the frames of the group from its key frame, whose time is its timestamp
+        std::chrono::duration<double, std::micro> keyTimestampUs(static_cast<double>(info.keyTag));
+        rosbag::View view(file_, rosbag::TopicQuery(topic), orbbecRosbag::Time(std::chrono::duration<double>(keyTimestampUs).count()), msg.getTime());
+        for(auto &&m: view) {
+            auto previous     = m.instantiate<sensor_msgs::Image>();
+            auto previousInfo = DepthDeltaDecoder::parseFrameInfo(previous->data.data(), previous->data.size());
+            if(previousInfo.keyTag == info.keyTag && previousInfo.index >= info.index) {
+                break;
+            }
+            if(previousInfo.keyTag == info.keyTag && decoder.canDecode(previousInfo)) {
+                decoder.decode(previous->data.data(), previous->data.size(), nullptr);
+            }
+        }
+        if(!decoder.canDecode(info)) {
+            LOG_WARN("Skip the delta coded depth frame {}: the previous frames are missing", image.number);
+            return nullptr;
+        }
+    }
+
+    auto format = convertStringToFormat(image.encoding.substr(DepthDeltaEncodingPrefix.size()));
+    auto frame  = FrameFactory::createVideoFrame(RosTopic::getFrameTypeIdentifier(topic), format, info.width, info.height, 0);
+    decoder.decode(image.data.data(), image.data.size(), reinterpret_cast<uint16_t *>(frame->getDataMutable()));
+    return frame;
+}
+
 std::shared_ptr<Frame> RosReader::createLiDARPointCloud(const rosbag::MessageInstance &msg) {
     auto                               msgTopic   = msg.getTopic();
     sensor_msgs::PointCloud2::ConstPtr framePtr   = msg.instantiate<sensor_msgs::PointCloud2>();
@@ -12,6 +12,7 @@
 #include "libobsensor/h/ObTypes.h"
 
 #include "RosFileFormat.hpp"
+#include "DepthDeltaCodec.hpp"
 #include "rosbag/bag.h"
 #include "rosbag/view.h"
 #include "rosbag/structures.h"
@@ -60,6 +61,7 @@ public:
 private:
     void                   initView();
     std::shared_ptr<Frame> createVideoFrame(const rosbag::MessageInstance &msg);
+    std::shared_ptr<Frame> decodeDepthFrame(const rosbag::MessageInstance &msg, const sensor_msgs::Image &image);
     std::shared_ptr<Frame> createImuFrame(const rosbag::MessageInstance &msg);
     std::shared_ptr<Frame> createLiDARPointCloud(const rosbag::MessageInstance &msg);
     void                   queryDeviceInfo();
@@ -82,6 +84,7 @@ private:
     float                                                  baseline_;
     std::map<OBStreamType, std::shared_ptr<StreamProfile>> streamProfileList_;
     std::map<uint32_t, std::vector<uint8_t>>               propertyList_;
+    std::map<std::string, DepthDeltaDecoder>               depthDecoders_;  // by topic
 };
 
 }  // namespace libobsensor
\ No newline at end of file
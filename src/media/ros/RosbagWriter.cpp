@@ -8,7 +8,8 @@
 namespace libobsensor {
 const uint64_t INVALID_DIFF = 6ULL * 60ULL * 60ULL * 1000000ULL;  // 6 hours
 
-RosWriter::RosWriter(const std::string &file, bool compressWhileRecord) : filePath_(file), startTime_(0), minFrameTime_(0), maxFrameTime_(0) {
+RosWriter::RosWriter(const std::string &file, bool compressWhileRecord, OBRecordDepthCodec depthCodec)
+    : filePath_(file), startTime_(0), depthCodec_(depthCodec), minFrameTime_(0), maxFrameTime_(0) {
     file_ = std::make_shared<rosbag::Bag>();
     file_->open(filePath_, rosbag::BagMode::Write);
     if(compressWhileRecord) {
@@ -228,14 +229,43 @@ void RosWriter::writeVideoFrame(const OBSensorType &sensorType, std::shared_ptr<
         }
 
         imageMsg->data.clear();
-        imageMsg->encoding = convertFormatToString(curFrame->getFormat());
         imageMsg->metadata.insert(imageMsg->metadata.begin(), curFrame->getMetadata(), curFrame->getMetadata() + curFrame->getMetadataSize());
-        imageMsg->data.insert(imageMsg->data.begin(), curFrame->getData(), curFrame->getData() + curFrame->getDataSize());
+        if(!encodeDepthFrame(sensorType, curFrame, *imageMsg)) {
+            imageMsg->encoding = convertFormatToString(curFrame->getFormat());
+            imageMsg->data.insert(imageMsg->data.begin(), curFrame->getData(), curFrame->getData() + curFrame->getDataSize());
+        }
         file_->write(imageTopic, imageMsg->header.stamp, imageMsg);
     }
     catch(const std::exception &e) {
         LOG_WARN("Write frame data exception! Message: {}", e.what());
+        // the next frames must not refer to this one
+        auto iter = depthEncoders_.find(sensorType);
+        if(iter != depthEncoders_.end()) {
+            iter->second->reset();
+        }
+    }
+}
+
+bool RosWriter::encodeDepthFrame(const OBSensorType &sensorType, std::shared_ptr<const Frame> curFrame, sensor_msgs::Image &imageMsg) {
+    auto format = curFrame->getFormat();
+    if(depthCodec_ != OB_RECORD_DEPTH_CODEC_DELTA || curFrame->getType() != OB_FRAME_DEPTH || (format != OB_FORMAT_Y16 && format != OB_FORMAT_Z16)) {
+        return false;
+    }
+    auto videoFrame = curFrame->as<VideoFrame>();
+    auto width      = videoFrame->getWidth();
+    auto height     = videoFrame->getHeight();
+    if(curFrame->getDataSize() != static_cast<size_t>(width) * height * sizeof(uint16_t)) {
+        return false;  // padded rows, recorded as they are
+    }
+
+    auto &encoder = depthEncoders_[sensorType];
+    if(!encoder) {
+        encoder = std::make_shared<DepthDeltaEncoder>();
     }
+    // the key frame is found by its timestamp, the time of its message
+    encoder->encode(reinterpret_cast<const uint16_t *>(curFrame->getData()), width, height, curFrame->getTimeStampUsec(), imageMsg.data);
+    imageMsg.encoding = DepthDeltaEncodingPrefix + convertFormatToString(format);
+    return true;
 }
 
 void RosWriter::writeProperty(uint32_t propertyID, const uint8_t *data, const uint32_t datasize) {
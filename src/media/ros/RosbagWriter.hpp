@@ -5,6 +5,7 @@
 
 #include "IWriter.hpp"
 #include "RosFileFormat.hpp"
+#include "DepthDeltaCodec.hpp"
 #include "frame/Frame.hpp"
 #include "IDevice.hpp"
 #include "libobsensor/h/ObTypes.h"
@@ -37,7 +38,7 @@ namespace libobsensor {
 
 class RosWriter : public IWriter {
 public:
-    explicit RosWriter(const std::string &file, bool compressWhileRecord);
+    RosWriter(const std::string &file, bool compressWhileRecord, OBRecordDepthCodec depthCodec = OB_RECORD_DEPTH_CODEC_NONE);
     virtual ~RosWriter() noexcept override;
 
     virtual void writeFrame(const OBSensorType &sensorType, std::shared_ptr<const Frame> curFrame) override;
@@ -55,6 +56,7 @@ private:
     void writeGyroStreamProfile(const std::shared_ptr<const StreamProfile> &streamProfile);
     void writeLiDARStreamProfile(const std::shared_ptr<const StreamProfile> &streamProfile);
     void writeDisparityParam(std::shared_ptr<const DisparityBasedStreamProfile> disparityParam);
+    bool encodeDepthFrame(const OBSensorType &sensorType, std::shared_ptr<const Frame> curFrame, sensor_msgs::Image &imageMsg);
 
 private:
     std::string                                                  filePath_;
@@ -64,6 +66,8 @@ private:
     std::shared_ptr<const StreamProfile>                         colorStreamProfile_;
     std::shared_ptr<const StreamProfile>                         depthStreamProfile_;
     std::map<OBSensorType, std::shared_ptr<const StreamProfile>> streamProfileMap_;
+    OBRecordDepthCodec                                           depthCodec_;
+    std::map<OBSensorType, std::shared_ptr<DepthDeltaEncoder>>   depthEncoders_;
 
     uint64_t minFrameTime_;
     uint64_t maxFrameTime_;
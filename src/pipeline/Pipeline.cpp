@@ -12,6 +12,7 @@
 #include "exception/ObException.hpp"
 #include "IAlgParamManager.hpp"
 #include "frameprocessor/FrameProcessor.hpp"
+#include "frame/FrameLatencyTracer.hpp"
 
 #include <cmath>
 #include <algorithm>
@@ -32,7 +33,7 @@ Pipeline::Pipeline(std::shared_ptr<IDevice> dev) : device_(dev), config_(nullptr
     loadFrameQueueSizeConfig();
     loadMaxFrameDelayConfig();
 
-    outputFrameQueue_ = std::make_shared<FrameQueue<const Frame>>(maxFrameQueueSize_);
+    outputFrameQueue_ = std::make_shared<FrameQueue<const Frame>>(maxFrameQueueSize_, "pipeline_output");
 
     statusCollector_ = std::make_shared<PipelineStatusCollector>(device_.get());
     statusCollector_->setExternalCollector([this]() {
@@ -294,6 +295,7 @@ void Pipeline::startStream() {
 }
 
 void Pipeline::onFrameCallback(std::shared_ptr<const Frame> frame) {
+    FrameLatencyTracer::record(OB_FRAME_TRACE_STAGE_PIPELINE_INPUT, frame);
     std::unique_lock<std::mutex> lk(streamMutex_);
     if(streamState_ != STREAM_STATE_STOPPED && streamState_ != STREAM_STATE_STOPPING) {
         if(streamState_ == STREAM_STATE_STARTING) {
@@ -314,9 +316,13 @@ void Pipeline::onFrameCallback(std::shared_ptr<const Frame> frame) {
 
 void Pipeline::outputFrame(std::shared_ptr<const Frame> frame) {
     LOG_FREQ_CALC(DEBUG, 5000, "Pipeline {}, frameset output rate={freq}fps", STREAM_STATE_STR(streamState_));
+    FrameLatencyTracer::record(OB_FRAME_TRACE_STAGE_AGGREGATION, frame);
     if(streamState_ == STREAM_STATE_STREAMING) {
         if(pipelineCallback_ != nullptr) {
+            FrameLatencyTracer::record(OB_FRAME_TRACE_STAGE_DELIVERY, frame);
             pipelineCallback_(frame);
+            FrameLatencyTracer::record(OB_FRAME_TRACE_STAGE_CALLBACK_RETURN, frame);
+            FrameLatencyTracer::exportTrace(frame);
             return;
         }
 
@@ -336,6 +342,8 @@ std::shared_ptr<const Frame> Pipeline::waitForFrame(uint32_t timeout_ms) {
         statusCollector_->reportSdkStatus(OB_SDK_STATUS_FRAME_WAIT_TIMEOUT);
         return nullptr;
     }
+    FrameLatencyTracer::record(OB_FRAME_TRACE_STAGE_DELIVERY, frame);
+    FrameLatencyTracer::exportTrace(frame);
     return frame;
 }
 
@@ -12,6 +12,7 @@
 #include "IStreamer.hpp"
 #include "SourcePortInfo.hpp"
 
+#include <exception>
 #include <functional>
 
 namespace libobsensor {
@@ -40,11 +41,36 @@ public:
 };
 
 // for vendor command
+struct VendorTransfer {
+    const uint8_t *sendData;
+    uint32_t       sendLen;
+    uint8_t       *recvData;
+    uint32_t       exceptedRecvLen;
+    uint32_t       recvLen;  // 0 if the transfer failed
+};
+
 class IVendorDataPort : virtual public ISourcePort {  // Virtual inheritance solves diamond inheritance problem
 public:
     ~IVendorDataPort() noexcept override = default;
 
     virtual uint32_t sendAndReceive(const uint8_t *sendData, uint32_t sendLen, uint8_t *recvData, uint32_t exceptedRecvLen) = 0;
+
+    /**
+     * @brief Send several requests and receive their responses in order.
+     * @brief Ports that can keep several requests in flight override it, the default implementation sends them one by one.
+     * @brief No port overrides it yet: the firmware handles one vendor command at a time (write the request, then read the response), so a
+     * batch currently costs the same round trips as the single requests and only saves the per-request overhead of the property server.
+     */
+    virtual void sendAndReceiveBatch(std::vector<VendorTransfer> &transfers) {
+        for(auto &transfer: transfers) {
+            try {
+                transfer.recvLen = sendAndReceive(transfer.sendData, transfer.sendLen, transfer.recvData, transfer.exceptedRecvLen);
+            }
+            catch(const std::exception &) {
+                transfer.recvLen = 0;
+            }
+        }
+    }
 };
 
 // for imu data stream
@@ -11,7 +11,19 @@
 namespace libobsensor {
 
 ObRTPPacketProcessor::ObRTPPacketProcessor()
-    : foundStartPacket_(false), revDataComplete_(false), revDataError_(false), frameNumber_(0), dataSize_(0), rtpBuffer_(nullptr), fameSequenceNumberCount_(0) {
+    : foundStartPacket_(false),
+      revDataComplete_(false),
+      revDataError_(false),
+      frameNumber_(0),
+      dataSize_(0),
+      rtpBuffer_(nullptr),
+      fameSequenceNumberCount_(0),
+      lastSequenceNumber_(-1),
+      metricsRegistry_(MetricsRegistry::getInstance()) {
+    MetricLabels labels     = { { "transport", "rtp" }, { "id", MetricsRegistry::newInstanceId() } };
+    packetCounter_          = metricsRegistry_->getCounter("ob_transport_packets_total", "Packets received by the transport.", labels);
+    reorderedPacketCounter_ = metricsRegistry_->getCounter("ob_transport_packets_reordered_total", "Packets received out of order.", labels);
+    lostPacketCounter_      = metricsRegistry_->getCounter("ob_transport_packets_lost_total", "Packets missing from the frames received.", labels);
 
     maxPacketSize_  = MAX_RTP_FIX_SIZE - RTP_FIX_SIZE;
     maxPacketCount_ = MAX_RTP_FRAME_SIZE / maxPacketSize_ + 1;
@@ -28,6 +40,7 @@ void ObRTPPacketProcessor::OnStartOfFrame() {
     foundStartPacket_        = true;
     dataSize_                = 0;
     fameSequenceNumberCount_ = 0;
+    lastSequenceNumber_      = -1;
     memset(rtpBuffer_, 0, maxCacheSize_);
 }
 
@@ -44,6 +57,7 @@ bool ObRTPPacketProcessor::process(RTPHeader *header, uint8_t *recvData, uint32_
 
     uint8_t  marker         = header->marker;
     uint16_t sequenceNumber = ntohs(header->sequenceNumber);
+    packetCounter_->add();
     rtpType_                = type;
     // LOG_DEBUG("marker-{}, sequenceNumber-{},length-{}, type-{}", marker, sequenceNumber, length, type);
     if(sequenceNumber == START_RTP_TAG) {
@@ -56,6 +70,10 @@ bool ObRTPPacketProcessor::process(RTPHeader *header, uint8_t *recvData, uint32_
     }
 
     fameSequenceNumberCount_++;
+    if(static_cast<int32_t>(sequenceNumber) < lastSequenceNumber_) {
+        reorderedPacketCounter_->add();
+    }
+    lastSequenceNumber_ = std::max(lastSequenceNumber_, static_cast<int32_t>(sequenceNumber));
 
     uint32_t offset  = RTP_FIX_METADATA_OFFSET + sequenceNumber * maxPacketSize_;
     uint32_t dataLen = length - RTP_FIX_SIZE;
@@ -87,6 +105,9 @@ void ObRTPPacketProcessor::OnEndOfFrame(uint16_t sequenceNumber, OBFormat format
     else {
         revDataComplete_ = false;
         revDataError_    = true;
+        if(fameSequenceNumberCount_ < (uint32_t)(sequenceNumber + 1)) {
+            lostPacketCounter_->add(sequenceNumber + 1 - fameSequenceNumberCount_);
+        }
         LOG_WARN("Received rtp packet count does not match sequenceNumber!");
     }
 }
@@ -122,6 +143,7 @@ void ObRTPPacketProcessor::reset() {
     revDataError_            = false;
     dataSize_                = 0;
     fameSequenceNumberCount_ = 0;
+    lastSequenceNumber_      = -1;
     memset(rtpBuffer_, 0, maxCacheSize_);
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "libobsensor/h/ObTypes.h"
+#include "metrics/MetricsRegistry.hpp"
 #include <iostream>
 #include <mutex>
 #include <unordered_set>
@@ -105,6 +106,12 @@ private:
     uint32_t rtpType_;
 
     uint32_t fameSequenceNumberCount_;
+    int32_t  lastSequenceNumber_;
+
+    std::shared_ptr<MetricsRegistry> metricsRegistry_;
+    std::shared_ptr<MetricCounter>   packetCounter_;
+    std::shared_ptr<MetricCounter>   reorderedPacketCounter_;
+    std::shared_ptr<MetricCounter>   lostPacketCounter_;
 };
 
 }
@@ -11,7 +11,7 @@
 
 namespace libobsensor {
 HidDevicePort::HidDevicePort(const std::shared_ptr<IUsbDevice> &usbDevice, std::shared_ptr<const USBSourcePortInfo> portInfo)
-    : portInfo_(portInfo), usbDevice_(usbDevice), isStreaming_(false), frameQueue_(10) {
+    : portInfo_(portInfo), usbDevice_(usbDevice), isStreaming_(false), frameQueue_(10, "hid") {
 
     auto libusbDevice = std::dynamic_pointer_cast<UsbDeviceLibusb>(usbDevice_);
     auto epDesc       = libusbDevice->getEndpointDesc(portInfo->infIndex, LIBUSB_ENDPOINT_TRANSFER_TYPE_INTERRUPT, LIBUSB_ENDPOINT_IN);
@@ -65,7 +65,7 @@ void imuSleepMs(int mSleepMs) {
     std::this_thread::sleep_for(std::chrono::milliseconds(mSleepMs));
 }
 
-HidDevicePortGmsl::HidDevicePortGmsl(std::shared_ptr<const USBSourcePortInfo> portInfo) : portInfo_(portInfo), isStreaming_(false), frameQueue_(10) {
+HidDevicePortGmsl::HidDevicePortGmsl(std::shared_ptr<const USBSourcePortInfo> portInfo) : portInfo_(portInfo), isStreaming_(false), frameQueue_(10, "hid") {
     imu_fd_ = open(portInfo_->infName.c_str(), O_RDWR);
     if(imu_fd_ < 0) {
         THROW_PAL_EXCEPTION(utils::string::to_string() << "HidDevicePortGmsl() openDev failed, errno: " << errno << " " << strerror(errno),
@@ -21,6 +21,7 @@
 #include "stream/StreamProfile.hpp"
 #include "utils/PublicTypeHelper.hpp"
 #include "frame/FrameFactory.hpp"
+#include "metrics/MetricsRegistry.hpp"
 #include "stream/StreamProfileFactory.hpp"
 
 namespace libobsensor {
@@ -393,6 +394,13 @@ ObV4lUvcDevicePort::~ObV4lUvcDevicePort() noexcept {
 void ObV4lUvcDevicePort::captureLoop(std::shared_ptr<V4lDeviceHandle> devHandle) {
     int metadataBufferIndex = -1;
 
+    // the frames lost by the driver show as gaps in the sequence numbers of the buffers
+    auto         metricsRegistry  = MetricsRegistry::getInstance();
+    MetricLabels labels           = { { "transport", "v4l2" }, { "device", devHandle->info->name }, { "id", MetricsRegistry::newInstanceId() } };
+    auto         frameCounter     = metricsRegistry->getCounter("ob_transport_frames_total", "Frames received by the transport.", labels);
+    auto         lostFrameCounter = metricsRegistry->getCounter("ob_transport_frames_lost_total", "Frames lost before reaching the host.", labels);
+    int64_t      lastSequence     = -1;
+
     devHandle->loopFrameIndex.store(1);  // frame number start from 1
     try {
 
@@ -491,6 +499,12 @@ void ObV4lUvcDevicePort::captureLoop(std::shared_ptr<V4lDeviceHandle> devHandle)
                 }
 
                 if(buf.bytesused) {
+                    frameCounter->add();
+                    if(lastSequence >= 0 && static_cast<int64_t>(buf.sequence) > lastSequence + 1) {
+                        lostFrameCounter->add(static_cast<uint64_t>(buf.sequence - lastSequence - 1));
+                    }
+                    lastSequence = static_cast<int64_t>(buf.sequence);
+
                     TRY_EXECUTE({
                         auto timestamp = (double)buf.timestamp.tv_sec * 1000.f + (double)buf.timestamp.tv_usec / 1000.f;
                         (void)timestamp;
@@ -809,4 +809,111 @@ void CoordinateUtil::transformationDepthToRGBDPointCloudByUVTables(const OBCamer
     }
 }
 
+void CoordinateUtil::transformationDepthToRGBDPointCloudByColorProjection(OBXYTables *xyTables, const void *depthImageData, const OBD2CTransform depthToColor,
+                                                                          float depthValueScale, const OBCameraIntrinsic rgbIntrinsic, OBXYTables *uvTables,
+                                                                          const void *colorImageData, void *pointCloudData, bool outputZeroPoint,
+                                                                          uint32_t *validPointCount, float positionDataScale, OBCoordinateSystemType type,
+                                                                          bool colorDataNormalization, bool isDepthImageY12C4, int step, uint32_t width) {
+    const uint16_t *dImageData = (const uint16_t *)depthImageData;
+    const uint8_t  *cImageData = (const uint8_t *)colorImageData;
+    float          *xyzrgbData = (float *)pointCloudData;
+    float           x, y, z;
+    float           r, g, b;
+    int             coordinateSystemCoefficient = type == OB_LEFT_HAND_COORDINATE_SYSTEM ? -1 : 1;
+    float           colorDivCoeff               = colorDataNormalization ? 255.0f : 1.0f;
+    int             validCount                  = 0;
+
+    // The points are in the depth unit, so is the translation.
+    const float *rot        = depthToColor.rot;
+    const float  transX     = depthToColor.trans[0] / depthValueScale;
+    const float  transY     = depthToColor.trans[1] / depthValueScale;
+    const float  transZ     = depthToColor.trans[2] / depthValueScale;
+    const float  maxU       = rgbIntrinsic.width - 0.5f;
+    const float  maxV       = rgbIntrinsic.height - 0.5f;
+    const int    colorWidth = rgbIntrinsic.width;
+
+    for(int h = 0; h < xyTables->height; h += step) {
+        for(int w = 0; w < xyTables->width; w += step) {
+            int   i     = h * xyTables->width + w;
+            float x_tab = xyTables->xTable[i];
+
+            uint16_t depthValue = dImageData[i];
+            if(isDepthImageY12C4) {
+                depthValue = depthValue >> 4;
+                if(depthValue == 0x0FFF) {
+                    depthValue = 0xFFFF;
+                }
+            }
+
+            x = 0.0;
+            y = 0.0;
+            z = 0.0;
+            r = 0.0;
+            g = 0.0;
+            b = 0.0;
+            // A zero depth is no point here: transformed, it would not stay at the origin.
+            if(!std::isnan(x_tab) && depthValue != 0 && depthValue != 65535) {
+                float zd = (float)depthValue;
+                float xd = x_tab * zd;
+                float yd = xyTables->yTable[i] * zd;
+                float zc = rot[6] * xd + rot[7] * yd + rot[8] * zd + transZ;
+                if(zc > 0) {
+                    float xc = rot[0] * xd + rot[1] * yd + rot[2] * zd + transX;
+                    float yc = rot[3] * xd + rot[4] * yd + rot[5] * zd + transY;
+                    float u  = xc / zc * rgbIntrinsic.fx + rgbIntrinsic.cx;
+                    float v  = yc / zc * rgbIntrinsic.fy + rgbIntrinsic.cy;
+
+                    // The nearest pixel of the color image, the points outside have no color like the ones outside the aligned depth frame.
+                    int idx_rgb = -1;
+                    if(u > -0.5f && u < maxU && v > -0.5f && v < maxV) {
+                        idx_rgb = (int)(v + 0.5f) * colorWidth + (int)(u + 0.5f);
+                        if(uvTables != nullptr) {
+                            float u_d = uvTables->xTable[idx_rgb];
+                            idx_rgb   = std::isnan(u_d) ? -1 : (int)(uvTables->yTable[idx_rgb] + 0.5f) * colorWidth + (int)(u_d + 0.5f);
+                        }
+                    }
+
+                    if(idx_rgb >= 0) {
+                        x = xc * positionDataScale;
+                        y = yc * positionDataScale * coordinateSystemCoefficient;
+                        z = zc * positionDataScale;
+
+                        r = cImageData[3 * idx_rgb + 0] / colorDivCoeff;
+                        g = cImageData[3 * idx_rgb + 1] / colorDivCoeff;
+                        b = cImageData[3 * idx_rgb + 2] / colorDivCoeff;
+                    }
+                }
+            }
+
+            if(!outputZeroPoint && x == 0.0f && y == 0.0f && z == 0.0f && r == 0.0f && g == 0.0f && b == 0.0f) {
+                continue;
+            }
+
+            if(!outputZeroPoint) {
+                xyzrgbData[6 * validCount + 0] = x;
+                xyzrgbData[6 * validCount + 1] = y;
+                xyzrgbData[6 * validCount + 2] = z;
+                xyzrgbData[6 * validCount + 3] = r;
+                xyzrgbData[6 * validCount + 4] = g;
+                xyzrgbData[6 * validCount + 5] = b;
+                validCount++;
+            }
+            else {
+                uint32_t pid            = h / step * width + w / step;
+                xyzrgbData[6 * pid + 0] = x;
+                xyzrgbData[6 * pid + 1] = y;
+                xyzrgbData[6 * pid + 2] = z;
+                xyzrgbData[6 * pid + 3] = r;
+                xyzrgbData[6 * pid + 4] = g;
+                xyzrgbData[6 * pid + 5] = b;
+                validCount++;
+            }
+        }
+    }
+
+    if(validPointCount != nullptr) {
+        *validPointCount = validCount;
+    }
+}
+
 }  // namespace libobsensor
@@ -59,5 +59,16 @@ public:
                                                               const void *colorImageData, void *pointCloudData,bool outputZeroPoint = false,
                                                               uint32_t *validPointCount = nullptr,float positionDataScale = 1.0f,
                                                               OBCoordinateSystemType type = OB_RIGHT_HAND_COORDINATE_SYSTEM, bool colorDataNormalization = false, bool isDepthImageY12C4 = false, int step = 1, uint32_t width = 0);
+
+    // Depth not aligned to color: each depth pixel is transformed to the color camera and takes the color of the pixel it projects to, so the points are
+    // those of the depth aligned to color without building the aligned frame. uvTables adds the color distortion (see
+    // transformationInitAddDistortionUVTables), nullptr if the color has no distortion. The translation of depthToColor is in millimeters.
+    static void transformationDepthToRGBDPointCloudByColorProjection(OBXYTables *xyTables, const void *depthImageData, const OBD2CTransform depthToColor,
+                                                                     float depthValueScale, const OBCameraIntrinsic rgbIntrinsic, OBXYTables *uvTables,
+                                                                     const void *colorImageData, void *pointCloudData, bool outputZeroPoint = false,
+                                                                     uint32_t *validPointCount = nullptr, float positionDataScale = 1.0f,
+                                                                     OBCoordinateSystemType type = OB_RIGHT_HAND_COORDINATE_SYSTEM,
+                                                                     bool colorDataNormalization = false, bool isDepthImageY12C4 = false, int step = 1,
+                                                                     uint32_t width = 0);
 };
 }  // namespace libobsensor
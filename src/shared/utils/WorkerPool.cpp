@@ -0,0 +1,142 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#include "WorkerPool.hpp"
+#include "logger/Logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <system_error>
+
+namespace libobsensor {
+
+// The tasks of one parallelFor call. The threads take the task indices from next until they run out, the batch may stay in the queue after
+// that and is then dropped by the worker that takes it.
+struct WorkerPool::Batch {
+    const std::function<void(uint32_t)> *task;
+    uint32_t                             count;
+    std::atomic<uint32_t>                next;
+    uint32_t                             done;  // protected by mutex
+    std::exception_ptr                   error;
+    std::mutex                           mutex;
+    std::condition_variable              doneCv;
+};
+
+std::mutex                WorkerPool::instanceMutex_;
+std::weak_ptr<WorkerPool> WorkerPool::instanceWeakPtr_;
+
+std::shared_ptr<WorkerPool> WorkerPool::getInstance() {
+    std::unique_lock<std::mutex> lock(instanceMutex_);
+    auto                         instance = instanceWeakPtr_.lock();
+    if(!instance) {
+        instance         = std::shared_ptr<WorkerPool>(new WorkerPool());
+        instanceWeakPtr_ = instance;
+    }
+    return instance;
+}
+
+WorkerPool::WorkerPool() : stopped_(false) {
+    uint32_t workerCount = std::thread::hardware_concurrency();
+    workerCount          = workerCount > 1 ? workerCount - 1 : 0;  // the calling thread runs tasks too
+    for(uint32_t i = 0; i < workerCount; i++) {
+        try {
+            workers_.emplace_back(&WorkerPool::workerLoop, this);
+        }
+        catch(const std::system_error &e) {
+            LOG_WARN("WorkerPool: only {} of {} worker threads started: {}", workers_.size(), workerCount, e.what());
+            break;
+        }
+    }
+}
+
+WorkerPool::~WorkerPool() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        stopped_ = true;
+    }
+    queueCv_.notify_all();
+    for(auto &worker: workers_) {
+        worker.join();
+    }
+}
+
+uint32_t WorkerPool::getConcurrency() const {
+    return static_cast<uint32_t>(workers_.size()) + 1;
+}
+
+void WorkerPool::parallelFor(uint32_t count, const std::function<void(uint32_t)> &task) {
+    if(count == 0) {
+        return;
+    }
+    if(count == 1 || workers_.empty()) {
+        for(uint32_t i = 0; i < count; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    auto batch   = std::make_shared<Batch>();
+    batch->task  = &task;
+    batch->count = count;
+    batch->next  = 0;
+    batch->done  = 0;
+    try {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        auto                        helpers = std::min<size_t>(count - 1, workers_.size());
+        for(size_t i = 0; i < helpers; i++) {
+            queue_.push_back(batch);
+        }
+    }
+    catch(const std::bad_alloc &) {
+        // fewer helpers, the calling thread runs the tasks left
+    }
+    queueCv_.notify_all();
+
+    runBatch(*batch);
+
+    std::unique_lock<std::mutex> lock(batch->mutex);
+    batch->doneCv.wait(lock, [&]() { return batch->done == batch->count; });
+    if(batch->error) {
+        std::rethrow_exception(batch->error);
+    }
+}
+
+void WorkerPool::runBatch(Batch &batch) {
+    uint32_t index;
+    while((index = batch.next.fetch_add(1)) < batch.count) {
+        std::exception_ptr error;
+        try {
+            (*batch.task)(index);
+        }
+        catch(...) {
+            error = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(batch.mutex);
+        if(error && !batch.error) {
+            batch.error = error;
+        }
+        if(++batch.done == batch.count) {
+            batch.doneCv.notify_all();
+        }
+    }
+}
+
+void WorkerPool::workerLoop() {
+    while(true) {
+        std::shared_ptr<Batch> batch;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueCv_.wait(lock, [this]() { return stopped_ || !queue_.empty(); });
+            if(stopped_) {
+                break;
+            }
+            batch = queue_.front();
+            queue_.pop_front();
+        }
+        runBatch(*batch);
+    }
+}
+
+}  // namespace libobsensor
@@ -0,0 +1,57 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace libobsensor {
+
+/**
+ * @brief Worker threads shared by the filters that split a frame into parts processed in parallel, so the threads are started once and not
+ * for every frame.
+ */
+class WorkerPool {
+public:
+    static std::shared_ptr<WorkerPool> getInstance();
+
+    ~WorkerPool() noexcept;
+
+    /**
+     * @brief The number of threads a job can run on: the worker threads and the calling thread.
+     */
+    uint32_t getConcurrency() const;
+
+    /**
+     * @brief Runs task(0) to task(count - 1) on the worker threads and the calling thread, and returns once all of them are done.
+     * The calling thread also runs the tasks that no worker has taken yet, so it never waits for a busy pool.
+     * If tasks throw, the first exception is rethrown once all the tasks are done.
+     */
+    void parallelFor(uint32_t count, const std::function<void(uint32_t)> &task);
+
+private:
+    struct Batch;
+
+    WorkerPool();
+
+    void        workerLoop();
+    static void runBatch(Batch &batch);
+
+private:
+    static std::mutex                instanceMutex_;
+    static std::weak_ptr<WorkerPool> instanceWeakPtr_;
+
+    std::vector<std::thread>           workers_;
+    std::mutex                         queueMutex_;
+    std::condition_variable            queueCv_;
+    std::deque<std::shared_ptr<Batch>> queue_;
+    bool                               stopped_;
+};
+
+}  // namespace libobsensor
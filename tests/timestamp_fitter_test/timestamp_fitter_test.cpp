@@ -0,0 +1,110 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+// Checks that the incremental sliding window regression used by the global timestamp fitter gives the same clock model as
+// recomputing the regression over the whole sampling queue, on synthetic device clock drift data.
+
+#include "SlidingLinearRegression.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <deque>
+
+namespace {
+
+struct TimestampPair {
+    uint64_t systemTimestamp;
+    uint64_t deviceTimestamp;
+};
+
+// The regression the fitter used to run for every sample: sums over the whole queue, relative to the first sample
+void fitWholeQueue(const std::deque<TimestampPair> &queue, double &a, double &b) {
+    uint64_t offset_x = queue.front().deviceTimestamp;
+    uint64_t offset_y = queue.front().systemTimestamp;
+    double   Ex       = 0;
+    double   Exx      = 0;
+    double   Ey       = 0;
+    double   Exy      = 0;
+    for(auto &item: queue) {
+        auto systemTimestamp = item.systemTimestamp - offset_y;
+        auto deviceTimestamp = item.deviceTimestamp - offset_x;
+        Ex += deviceTimestamp;
+        Exx += deviceTimestamp * deviceTimestamp;
+        Ey += systemTimestamp;
+        Exy += deviceTimestamp * systemTimestamp;
+    }
+    auto n = static_cast<double>(queue.size());
+    a      = (Exy * n - Ex * Ey) / (n * Exx - Ex * Ex);
+    b      = (Exx * Ey - Exy * Ex) / (n * Exx - Ex * Ex) + offset_y - a * offset_x;
+}
+
+uint32_t nextRandom(uint32_t &state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+}  // namespace
+
+int main() {
+    const size_t   windowSize  = 100;
+    const size_t   sampleCount = 20000;
+    const size_t   resetAt     = 7000;     // the fitter clears the queue when the device time goes backwards
+    const uint64_t intervalUs  = 1000000;  // one sample per second
+    const double   maxDiffA    = 1e-9;
+    const double   maxDiffUs   = 2.0;      // a few ulps of an epoch timestamp in microseconds (1 ulp = 0.25us)
+
+    libobsensor::SlidingLinearRegression regression;
+    std::deque<TimestampPair>            queue;
+
+    uint64_t deviceTime = 3ull * 24 * 3600 * 1000000;  // device up for 3 days
+    uint64_t systemTime = 1700000000ull * 1000000;     // unix epoch time
+    uint32_t random     = 12345;
+    double   worstA     = 0;
+    double   worstUs    = 0;
+
+    for(size_t i = 0; i < sampleCount; i++) {
+        // 40ppm drift, slowly varying with temperature, plus up to +-300us of round trip jitter
+        double ppm = 40.0 + 10.0 * std::sin(static_cast<double>(i) / 500.0);
+        deviceTime += intervalUs;
+        systemTime += static_cast<uint64_t>(intervalUs * (1.0 + ppm * 1e-6));
+        auto jitter        = static_cast<int64_t>(nextRandom(random) % 600) - 300;
+        auto sampledSystem = static_cast<uint64_t>(static_cast<int64_t>(systemTime) + jitter);
+
+        if(i == resetAt) {
+            deviceTime = 1000000;
+            regression.clear();
+            queue.clear();
+        }
+
+        if(queue.size() > windowSize) {
+            queue.pop_front();
+            regression.popFront();
+        }
+        queue.push_back({ sampledSystem, deviceTime });
+        regression.push(deviceTime, sampledSystem);
+        if(queue.size() < 4) {
+            continue;
+        }
+
+        double refA, refB, incA, incB;
+        fitWholeQueue(queue, refA, refB);
+        if(!regression.solve(incA, incB)) {
+            std::printf("sample %zu: incremental regression failed to solve\n", i);
+            return 1;
+        }
+
+        auto x      = static_cast<double>(deviceTime);
+        auto diffA  = std::fabs(incA - refA);
+        auto diffUs = std::fabs((incA * x + incB) - (refA * x + refB));
+        worstA      = std::fmax(worstA, diffA);
+        worstUs     = std::fmax(worstUs, diffUs);
+        if(diffA > maxDiffA || diffUs > maxDiffUs) {
+            std::printf("sample %zu: mismatch, a: %.12f vs %.12f, converted timestamp diff: %.3fus\n", i, incA, refA, diffUs);
+            return 1;
+        }
+    }
+
+    std::printf("%zu samples, window %zu: max coefficient diff %.3e, max converted timestamp diff %.3fus\n", sampleCount, windowSize, worstA, worstUs);
+    std::printf("PASSED\n");
+    return 0;
+}
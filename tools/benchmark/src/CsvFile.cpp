@@ -38,6 +38,15 @@ void CSVFile::writeAverageSystemInfo(const std::string &config, float cpuUsage,
     csvFile_.flush();
 }
 
+void CSVFile::writeConfigValues(const std::string &config, const std::vector<double> &values) {
+    csvFile_ << config;
+    for(auto value: values) {
+        csvFile_ << "," << value;
+    }
+    csvFile_ << "\n";
+    csvFile_.flush();
+}
+
 void CSVFile::writeTitle(const std::string &title) {
     csvFile_ << title << "\n";
     csvFile_.flush();
@@ -29,6 +29,7 @@ public:
 
     void writeSystemInfo(const std::string &timestamp, float cpuUsage, float memoryUsage);
     void writeAverageSystemInfo(const std::string &config, float cpuUsage, float memoryUsage);
+    void writeConfigValues(const std::string &config, const std::vector<double> &values);
     void writeSystemInfos(const std::vector<SystemInfo> &systemInfos);
     void writeTitle(const std::string &title);
 
@@ -0,0 +1,301 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+// Measures the delta codec of the depth frames of the recordings: the compression ratio and the encode and decode throughput of the codec,
+// then the size and the write and read throughput of recordings made with and without the codec and the LZ4 chunk compression. Every frame
+// read back must be equal to the recorded one, also after a seek into a group of frames.
+
+#include "ros/DepthDeltaCodec.hpp"
+#include "ros/RosbagReader.hpp"
+#include "ros/RosbagWriter.hpp"
+#include "frame/FrameFactory.hpp"
+#include "stream/StreamProfileFactory.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace libobsensor;
+
+typedef std::chrono::steady_clock Clock;
+
+const uint32_t fps = 30;
+
+struct DepthSequence {
+    uint32_t                           width;
+    uint32_t                           height;
+    OBFormat                           format;
+    std::vector<std::vector<uint16_t>> frames;
+};
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+double toMB(double bytes) {
+    return bytes / (1024.0 * 1024.0);
+}
+
+// A static scene (a slanted wall and two boxes with their shadows) with a ball moving across it, the depth noise of the sensor on a part of
+// the pixels of every frame and a few invalid pixels appearing and disappearing.
+DepthSequence generateSequence(uint32_t width, uint32_t height, uint32_t frameCount) {
+    DepthSequence sequence = { width, height, OB_FORMAT_Y16, {} };
+    std::mt19937  random(7);
+
+    std::vector<uint16_t> scene(width * height);
+    for(uint32_t y = 0; y < height; y++) {
+        for(uint32_t x = 0; x < width; x++) {
+            uint16_t depth = static_cast<uint16_t>(2500 - x + y / 2);
+            if(x >= width / 8 && x < width * 3 / 8 && y >= height / 2 && y < height * 7 / 8) {
+                depth = static_cast<uint16_t>(1200 + (x - width / 8) / 4);
+            }
+            else if(x >= width * 5 / 8 && x < width * 7 / 8 && y >= height / 4 && y < height * 3 / 4) {
+                depth = 1600;
+            }
+            else if((x >= width * 3 / 8 && x < width * 3 / 8 + 8 && y >= height / 2 && y < height * 7 / 8)
+                    || (x >= width * 7 / 8 && x < width * 7 / 8 + 8 && y >= height / 4 && y < height * 3 / 4)) {
+                depth = 0;  // shadow of the box, seen by the camera but not by the projector
+            }
+            scene[y * width + x] = depth;
+        }
+    }
+    std::uniform_int_distribution<uint32_t> pixel(0, width * height - 1);
+    for(uint32_t i = 0; i < width * height / 50; i++) {
+        scene[pixel(random)] = 0;
+    }
+
+    std::uniform_int_distribution<int> noise(-2, 2);
+    std::bernoulli_distribution        noisy(0.3);
+    std::bernoulli_distribution        dropout(0.005);
+    int                                radius = static_cast<int>(height / 8);
+    for(uint32_t i = 0; i < frameCount; i++) {
+        std::vector<uint16_t> frame(scene);
+        int                   centerX = static_cast<int>((i * 4) % (width + 2 * radius)) - radius;
+        int                   centerY = static_cast<int>(height / 3);
+        for(uint32_t y = 0; y < height; y++) {
+            for(uint32_t x = 0; x < width; x++) {
+                auto &depth = frame[y * width + x];
+                int   dx    = static_cast<int>(x) - centerX;
+                int   dy    = static_cast<int>(y) - centerY;
+                if(dx * dx + dy * dy < radius * radius) {
+                    depth = static_cast<uint16_t>(800 + std::sqrt(static_cast<double>(dx * dx + dy * dy)));
+                }
+                if(depth != 0 && noisy(random)) {
+                    depth = static_cast<uint16_t>(depth + noise(random));
+                }
+                if(dropout(random)) {
+                    depth = 0;
+                }
+            }
+        }
+        sequence.frames.push_back(std::move(frame));
+    }
+    return sequence;
+}
+
+// the packed Y16/Z16 depth frames of a recording
+DepthSequence loadSequence(const std::string &filePath, uint32_t frameCount) {
+    DepthSequence sequence = { 0, 0, OB_FORMAT_UNKNOWN, {} };
+    RosReader     reader(filePath);
+    while(!reader.getIsEndOfFile() && sequence.frames.size() < frameCount) {
+        auto frame = reader.readNextData();
+        if(!frame || frame->getType() != OB_FRAME_DEPTH || (frame->getFormat() != OB_FORMAT_Y16 && frame->getFormat() != OB_FORMAT_Z16)) {
+            continue;
+        }
+        auto videoFrame = frame->as<VideoFrame>();
+        if(sequence.frames.empty()) {
+            sequence.width  = videoFrame->getWidth();
+            sequence.height = videoFrame->getHeight();
+            sequence.format = frame->getFormat();
+        }
+        if(videoFrame->getWidth() != sequence.width || videoFrame->getHeight() != sequence.height
+           || frame->getDataSize() != sequence.width * sequence.height * sizeof(uint16_t)) {
+            continue;
+        }
+        auto data = reinterpret_cast<const uint16_t *>(frame->getData());
+        sequence.frames.emplace_back(data, data + sequence.width * sequence.height);
+    }
+    if(sequence.frames.empty()) {
+        throw std::runtime_error("No packed Y16 or Z16 depth frame in " + filePath);
+    }
+    return sequence;
+}
+
+// returns false if a decoded frame differs
+bool benchmarkCodec(const DepthSequence &sequence) {
+    size_t                            frameSize = sequence.width * sequence.height * sizeof(uint16_t);
+    std::vector<std::vector<uint8_t>> encoded(sequence.frames.size());
+    DepthDeltaEncoder                 encoder;
+    auto                              start = Clock::now();
+    for(size_t i = 0; i < sequence.frames.size(); i++) {
+        encoder.encode(sequence.frames[i].data(), sequence.width, sequence.height, i, encoded[i]);
+    }
+    double encodeMs = elapsedMs(start);
+
+    std::vector<uint16_t> decoded(sequence.width * sequence.height);
+    DepthDeltaDecoder     decoder;
+    size_t                mismatches   = 0;
+    double                decodeMs     = 0;
+    size_t                encodedBytes = 0;
+    for(size_t i = 0; i < sequence.frames.size(); i++) {
+        start = Clock::now();
+        decoder.decode(encoded[i].data(), encoded[i].size(), decoded.data());
+        decodeMs += elapsedMs(start);
+        encodedBytes += encoded[i].size();
+        if(memcmp(decoded.data(), sequence.frames[i].data(), frameSize) != 0) {
+            mismatches++;
+        }
+    }
+
+    double rawBytes = static_cast<double>(frameSize * sequence.frames.size());
+    double count    = static_cast<double>(sequence.frames.size());
+    printf("Codec: %zu frames, raw %.1f MB, encoded %.1f MB, ratio %.2f, %zu mismatching frames\n", sequence.frames.size(), toMB(rawBytes),
+           toMB(static_cast<double>(encodedBytes)), rawBytes / static_cast<double>(encodedBytes), mismatches);
+    printf("  encode %.2f ms/frame, %.0f MB/s\n", encodeMs / count, toMB(rawBytes) / (encodeMs / 1000));
+    printf("  decode %.2f ms/frame, %.0f MB/s\n", decodeMs / count, toMB(rawBytes) / (decodeMs / 1000));
+    return mismatches == 0;
+}
+
+uint64_t frameTimestamp(size_t index) {
+    return 1000000 + static_cast<uint64_t>(index) * 1000000 / fps;
+}
+
+// returns false if a frame read back differs
+bool benchmarkRecording(const DepthSequence &sequence, const std::string &name, bool compression, OBRecordDepthCodec codec) {
+    const std::string filePath  = "depth_codec_benchmark.bag";
+    size_t            frameSize = sequence.width * sequence.height * sizeof(uint16_t);
+
+    OBCameraIntrinsic  intrinsic  = { 460.0f, 460.0f, sequence.width / 2.0f, sequence.height / 2.0f, static_cast<int16_t>(sequence.width),
+                                      static_cast<int16_t>(sequence.height) };
+    OBCameraDistortion distortion = {};
+    auto               profile    = StreamProfileFactory::createVideoStreamProfile(OB_STREAM_DEPTH, sequence.format, sequence.width, sequence.height, fps);
+    profile->bindIntrinsic(intrinsic);
+    profile->bindDistortion(distortion);
+
+    // the frames are created before the time is taken, as the recorder receives them
+    std::vector<std::shared_ptr<Frame>> frames;
+    for(size_t i = 0; i < sequence.frames.size(); i++) {
+        auto frame = FrameFactory::createVideoFrame(OB_FRAME_DEPTH, sequence.format, sequence.width, sequence.height, 0);
+        memcpy(frame->getDataMutable(), sequence.frames[i].data(), frameSize);
+        frame->setStreamProfile(profile);
+        frame->setNumber(i);
+        frame->setTimeStampUsec(frameTimestamp(i));
+        frame->setSystemTimeStampUsec(frameTimestamp(i));
+        frames.push_back(frame);
+    }
+
+    auto start = Clock::now();
+    {
+        auto writer = std::make_shared<RosWriter>(filePath, compression, codec);
+        for(auto &frame: frames) {
+            writer->writeFrame(OB_SENSOR_DEPTH, frame);
+        }
+        writer->writeStreamProfiles();
+        writer->stop(false);
+    }
+    double writeMs = elapsedMs(start);
+    frames.clear();
+
+    double fileBytes = 0;
+    if(auto file = fopen(filePath.c_str(), "rb")) {
+        fseek(file, 0, SEEK_END);
+        fileBytes = static_cast<double>(ftell(file));
+        fclose(file);
+    }
+
+    size_t mismatches = 0;
+    size_t count      = 0;
+    start             = Clock::now();
+    RosReader reader(filePath);
+    while(!reader.getIsEndOfFile()) {
+        auto frame = reader.readNextData();
+        if(!frame || frame->getType() != OB_FRAME_DEPTH) {
+            continue;
+        }
+        auto index = static_cast<size_t>(frame->getNumber());
+        if(index >= sequence.frames.size() || frame->getDataSize() != frameSize || memcmp(frame->getData(), sequence.frames[index].data(), frameSize) != 0) {
+            mismatches++;
+        }
+        count++;
+    }
+    double readMs = elapsedMs(start);
+    mismatches += sequence.frames.size() - std::min(count, sequence.frames.size());
+
+    // a frame in the middle of a group of frames, decoded from the key frame of the group after a seek
+    size_t seekIndex = sequence.frames.size() * 2 / 3;
+    start            = Clock::now();
+    reader.seekToTime(std::chrono::nanoseconds((frameTimestamp(seekIndex) - frameTimestamp(0) - 1) * 1000));  // 1us before, for the rounding
+    auto   seekFrame = reader.readNextData();
+    double seekMs    = elapsedMs(start);
+    if(!seekFrame || seekFrame->getNumber() != seekIndex || memcmp(seekFrame->getData(), sequence.frames[seekIndex].data(), frameSize) != 0) {
+        mismatches++;
+    }
+    reader.stop();
+
+    double rawBytes = static_cast<double>(frameSize * sequence.frames.size());
+    printf("%-14s %-10.1f %-8.2f %-12.0f %-12.0f %-10.2f %zu\n", name.c_str(), toMB(fileBytes), rawBytes / fileBytes, toMB(rawBytes) / (writeMs / 1000),
+           toMB(rawBytes) / (readMs / 1000), seekMs, mismatches);
+    std::remove(filePath.c_str());
+    return mismatches == 0;
+}
+
+void printUsage() {
+    std::cout << "Usage: ob_depth_codec_benchmark [bag_file] [--frames N] [--size WIDTHxHEIGHT]" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) try {
+    std::string filePath;
+    uint32_t    frameCount = 300;
+    uint32_t    width      = 640;
+    uint32_t    height     = 480;
+    for(int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if(arg == "--frames" && i + 1 < argc) {
+            frameCount = static_cast<uint32_t>(std::stoul(argv[++i]));
+        }
+        else if(arg == "--size" && i + 1 < argc && sscanf(argv[++i], "%ux%u", &width, &height) == 2) {
+            continue;
+        }
+        else if(arg.compare(0, 2, "--") != 0 && filePath.empty()) {
+            filePath = arg;
+        }
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    DepthSequence sequence;
+    if(filePath.empty()) {
+        std::cout << "Generating " << frameCount << " synthetic depth frames " << width << "x" << height << std::endl;
+        sequence = generateSequence(width, height, frameCount);
+    }
+    else {
+        sequence = loadSequence(filePath, frameCount);
+        std::cout << sequence.frames.size() << " depth frames " << sequence.width << "x" << sequence.height << " from " << filePath << std::endl;
+    }
+
+    bool ok = benchmarkCodec(sequence);
+
+    printf("%-14s %-10s %-8s %-12s %-12s %-10s %s\n", "recording", "file MB", "ratio", "write MB/s", "read MB/s", "seek ms", "mismatch");
+    ok = benchmarkRecording(sequence, "raw", false, OB_RECORD_DEPTH_CODEC_NONE) && ok;
+    ok = benchmarkRecording(sequence, "LZ4", true, OB_RECORD_DEPTH_CODEC_NONE) && ok;
+    ok = benchmarkRecording(sequence, "delta", false, OB_RECORD_DEPTH_CODEC_DELTA) && ok;
+    ok = benchmarkRecording(sequence, "delta+LZ4", true, OB_RECORD_DEPTH_CODEC_DELTA) && ok;
+    return ok ? 0 : 1;
+}
+catch(const std::exception &e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+}
@@ -0,0 +1,215 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+// The depth decimation of DecimationFilter against its previous per pixel implementation, kept here as the reference.
+
+#include "reference_check.hpp"
+
+#include <algorithm>
+
+namespace filter_benchmark {
+
+using namespace libobsensor;
+
+namespace {
+
+#define REFERENCE_SWAP(a, b)  \
+    {                         \
+        uint16_t temp = (a);  \
+        (a)           = (b);  \
+        (b)           = temp; \
+    }
+#define REFERENCE_SORT(a, b)    \
+    if((a) > (b)) {             \
+        REFERENCE_SWAP((a), (b)) \
+    }
+
+uint16_t referenceMedian1(uint16_t arr[]) {
+    return arr[0];
+}
+
+uint16_t referenceMedian2(uint16_t arr[]) {
+    REFERENCE_SORT(arr[0], arr[1]);
+    return arr[0];
+}
+
+uint16_t referenceMedian3(uint16_t arr[]) {
+    REFERENCE_SORT(arr[0], arr[1]);
+    REFERENCE_SORT(arr[1], arr[2]);
+    REFERENCE_SORT(arr[0], arr[1]);
+    return arr[1];
+}
+
+uint16_t referenceMedian4(uint16_t arr[]) {
+    REFERENCE_SORT(arr[0], arr[1]);
+    REFERENCE_SORT(arr[2], arr[3]);
+    REFERENCE_SORT(arr[0], arr[2]);
+    REFERENCE_SORT(arr[1], arr[3]);
+    REFERENCE_SORT(arr[1], arr[2]);
+    return arr[1];
+}
+
+uint16_t referenceMedian5(uint16_t arr[]) {
+    REFERENCE_SORT(arr[0], arr[1]);
+    REFERENCE_SORT(arr[3], arr[4]);
+    REFERENCE_SORT(arr[0], arr[2]);
+    REFERENCE_SORT(arr[1], arr[2]);
+    REFERENCE_SORT(arr[3], arr[2]);
+    REFERENCE_SORT(arr[4], arr[2]);
+    REFERENCE_SORT(arr[1], arr[3]);
+    return arr[2];
+}
+
+uint16_t referenceMedian6(uint16_t arr[]) {
+    REFERENCE_SORT(arr[0], arr[1]);
+    REFERENCE_SORT(arr[2], arr[3]);
+    REFERENCE_SORT(arr[4], arr[5]);
+    REFERENCE_SORT(arr[0], arr[2]);
+    REFERENCE_SORT(arr[1], arr[3]);
+    REFERENCE_SORT(arr[2], arr[4]);
+    REFERENCE_SORT(arr[3], arr[5]);
+    REFERENCE_SORT(arr[1], arr[4]);
+    REFERENCE_SORT(arr[3], arr[4]);
+    return arr[2];
+}
+
+uint16_t referenceMedian7(uint16_t arr[]) {
+    REFERENCE_SORT(arr[0], arr[5]);
+    REFERENCE_SORT(arr[0], arr[3]);
+    REFERENCE_SORT(arr[1], arr[6]);
+    REFERENCE_SORT(arr[2], arr[4]);
+    REFERENCE_SORT(arr[0], arr[1]);
+    REFERENCE_SORT(arr[3], arr[5]);
+    REFERENCE_SORT(arr[2], arr[6]);
+    REFERENCE_SORT(arr[2], arr[3]);
+    REFERENCE_SORT(arr[3], arr[6]);
+    REFERENCE_SORT(arr[4], arr[5]);
+    REFERENCE_SORT(arr[1], arr[5]);
+    REFERENCE_SORT(arr[1], arr[3]);
+    REFERENCE_SORT(arr[3], arr[4]);
+    return arr[3];
+}
+
+uint16_t referenceMedian8(uint16_t arr[]) {
+    REFERENCE_SORT(arr[0], arr[1]);
+    REFERENCE_SORT(arr[2], arr[3]);
+    REFERENCE_SORT(arr[4], arr[5]);
+    REFERENCE_SORT(arr[6], arr[7]);
+    REFERENCE_SORT(arr[0], arr[2]);
+    REFERENCE_SORT(arr[1], arr[3]);
+    REFERENCE_SORT(arr[4], arr[6]);
+    REFERENCE_SORT(arr[5], arr[7]);
+    REFERENCE_SORT(arr[1], arr[4]);
+    REFERENCE_SORT(arr[3], arr[6]);
+    REFERENCE_SORT(arr[2], arr[5]);
+    REFERENCE_SORT(arr[3], arr[4]);
+    REFERENCE_SORT(arr[2], arr[6]);
+    REFERENCE_SORT(arr[1], arr[3]);
+    REFERENCE_SORT(arr[5], arr[7]);
+    REFERENCE_SORT(arr[3], arr[5]);
+    REFERENCE_SORT(arr[4], arr[6]);
+    return arr[3];
+}
+
+uint16_t referenceMedian9(uint16_t arr[]) {
+    REFERENCE_SORT(arr[0], arr[1]);
+    REFERENCE_SORT(arr[3], arr[4]);
+    REFERENCE_SORT(arr[6], arr[7]);
+    REFERENCE_SORT(arr[1], arr[2]);
+    REFERENCE_SORT(arr[4], arr[5]);
+    REFERENCE_SORT(arr[7], arr[8]);
+    REFERENCE_SORT(arr[0], arr[1]);
+    REFERENCE_SORT(arr[3], arr[4]);
+    REFERENCE_SORT(arr[6], arr[7]);
+    REFERENCE_SORT(arr[1], arr[2]);
+    REFERENCE_SORT(arr[4], arr[5]);
+    REFERENCE_SORT(arr[7], arr[8]);
+    arr[3] = arr[0] > arr[3] ? arr[0] : arr[3];
+    arr[5] = arr[5] > arr[8] ? arr[8] : arr[5];
+    REFERENCE_SORT(arr[4], arr[7]);
+    arr[6] = arr[3] > arr[6] ? arr[3] : arr[6];
+    arr[4] = arr[1] > arr[4] ? arr[1] : arr[4];
+    arr[2] = arr[2] > arr[5] ? arr[5] : arr[2];
+    arr[4] = arr[4] > arr[7] ? arr[7] : arr[4];
+    REFERENCE_SORT(arr[4], arr[2]);
+    arr[4] = arr[4] > arr[6] ? arr[6] : arr[4];
+    return arr[4];
+}
+
+typedef uint16_t (*ReferenceMedian)(uint16_t arr[]);
+const ReferenceMedian referenceMedians[] = { nullptr,          referenceMedian1, referenceMedian2, referenceMedian3, referenceMedian4,
+                                             referenceMedian5, referenceMedian6, referenceMedian7, referenceMedian8, referenceMedian9 };
+
+// Scales 2 and 3 take the median of the non-zero pixels of every patch, the other scales their mean. The output is padded with zeros to a
+// multiple of 4 pixels in both directions.
+std::vector<uint8_t> referenceDecimateDepth(const uint16_t *src, uint32_t width, uint32_t height, uint32_t scale) {
+    uint32_t realWidth    = width / scale;
+    uint32_t realHeight   = height / scale;
+    uint32_t paddedWidth  = (realWidth + 3) / 4 * 4;
+    uint32_t paddedHeight = (realHeight + 3) / 4 * 4;
+
+    std::vector<uint8_t> output(static_cast<size_t>(paddedWidth) * paddedHeight * sizeof(uint16_t), 0);
+    auto                 dst = reinterpret_cast<uint16_t *>(output.data());
+    for(uint32_t j = 0; j < realHeight; j++) {
+        for(uint32_t i = 0; i < realWidth; i++) {
+            uint16_t kernel[9];
+            int      count = 0;
+            int      sum   = 0;
+            for(uint32_t n = 0; n < scale; n++) {
+                const uint16_t *p = src + static_cast<size_t>(j * scale + n) * width + i * scale;
+                for(uint32_t m = 0; m < scale; m++) {
+                    if(p[m]) {
+                        if(scale == 2 || scale == 3) {
+                            kernel[count] = p[m];
+                        }
+                        sum += p[m];
+                        count++;
+                    }
+                }
+            }
+            uint16_t value = 0;
+            if(count != 0) {
+                value = scale == 2 || scale == 3 ? referenceMedians[count](kernel) : static_cast<uint16_t>(sum / count);
+            }
+            dst[static_cast<size_t>(j) * paddedWidth + i] = value;
+        }
+    }
+    return output;
+}
+
+// random depth values, the pixels of the lower half are invalid (0) more often so every count of valid pixels per patch occurs
+std::vector<uint8_t> generateSparseDepth(uint32_t width, uint32_t height, uint32_t seed) {
+    auto data  = generateRandomDepth(width, height, 10000, seed);
+    auto depth = reinterpret_cast<uint16_t *>(data.data());
+    for(uint32_t y = height / 2; y < height; y++) {
+        for(uint32_t x = 0; x < width; x++) {
+            if(nextRandom(seed) % 3 == 0) {
+                depth[static_cast<size_t>(y) * width + x] = 0;
+            }
+        }
+    }
+    return data;
+}
+
+}  // namespace
+
+std::vector<ReferenceCheck> createDecimationChecks() {
+    std::vector<ReferenceCheck> checks;
+    for(auto size: std::vector<std::pair<uint32_t, uint32_t>>{ { 1280, 800 }, { 848, 480 }, { 641, 479 } }) {
+        auto name = "DecimationFilter/depth_y16_" + std::to_string(size.first) + "x" + std::to_string(size.second);
+        checks.push_back({ name, [size]() {
+                              auto   data       = generateSparseDepth(size.first, size.second, size.first + size.second);
+                              auto   frame      = createVideoFrame(OB_FRAME_DEPTH, OB_FORMAT_Y16, size.first, size.second, data);
+                              size_t mismatches = 0;
+                              for(uint32_t scale = 1; scale <= 8; scale++) {
+                                  auto reference =
+                                      referenceDecimateDepth(reinterpret_cast<const uint16_t *>(data.data()), size.first, size.second, scale);
+                                  mismatches += countMismatches(processFrame("DecimationFilter", { { "decimate", scale } }, frame), reference);
+                              }
+                              return mismatches;
+                          } });
+    }
+    return checks;
+}
+
+}  // namespace filter_benchmark
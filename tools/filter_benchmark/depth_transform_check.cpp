@@ -0,0 +1,84 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+// DepthTransformFilter against the filters it stands for: ThresholdFilter, PixelValueScaler, PixelValueOffset, FrameMirror, FrameFlip and
+// FrameRotate applied in this order.
+
+#include "reference_check.hpp"
+
+namespace filter_benchmark {
+
+using namespace libobsensor;
+
+namespace {
+
+struct ValueConfig {
+    uint32_t min;
+    uint32_t max;
+    double   scale;
+    int      offset;
+};
+
+std::shared_ptr<const Frame> applyFilterChain(std::shared_ptr<const Frame> frame, const ValueConfig &values, bool mirror, bool flip, int rotate) {
+    frame = processFrame("ThresholdFilter", { { "min", values.min }, { "max", values.max } }, frame);
+    if(values.scale != 1.0) {
+        frame = processFrame("PixelValueScaler", { { "scale", values.scale } }, frame);
+    }
+    if(values.offset != 0) {
+        frame = processFrame("PixelValueOffset", { { "offset", values.offset } }, frame);
+    }
+    if(mirror) {
+        frame = processFrame("FrameMirror", {}, frame);
+    }
+    if(flip) {
+        frame = processFrame("FrameFlip", {}, frame);
+    }
+    if(rotate != 0) {
+        frame = processFrame("FrameRotate", { { "rotate", rotate } }, frame);
+    }
+    return frame;
+}
+
+// every mirror, flip and rotation with every value config
+size_t checkDepthTransform(std::shared_ptr<const Frame> frame, const std::vector<ValueConfig> &valueConfigs) {
+    size_t mismatches = 0;
+    for(auto &values: valueConfigs) {
+        for(int transform = 0; transform < 16; transform++) {
+            bool mirror = (transform & 1) != 0;
+            bool flip   = (transform & 2) != 0;
+            int  rotate = (transform >> 2) * 90;
+
+            FilterConfig config = { { "min", values.min },          { "max", values.max },      { "scale", values.scale }, { "offset", values.offset },
+                                    { "mirror", mirror ? 1 : 0 }, { "flip", flip ? 1 : 0 }, { "rotate", rotate } };
+            mismatches += countMismatches(processFrame("DepthTransformFilter", config, frame), applyFilterChain(frame, values, mirror, flip, rotate));
+        }
+    }
+    return mismatches;
+}
+
+}  // namespace
+
+std::vector<ReferenceCheck> createDepthTransformChecks() {
+    // the 40x scale wraps the values above 1638 like PixelValueScaler, the negative offset shifts bits out of the 16 bits
+    std::vector<ValueConfig> y16Values = { { 300, 3000, 1.0, 0 }, { 300, 3000, 0.5, 2 }, { 0, 16000, 1.7, 0 }, { 300, 3000, 40.0, 0 }, { 300, 3000, 3.3, -3 } };
+    // PixelValueScaler does not process Y8, see DepthTransformFilter
+    std::vector<ValueConfig> y8Values = { { 20, 200, 1.0, 0 }, { 20, 200, 1.0, 1 }, { 0, 16000, 1.0, -1 } };
+
+    std::vector<ReferenceCheck> checks;
+    for(auto size: std::vector<std::pair<uint32_t, uint32_t>>{ { 1280, 800 }, { 641, 479 } }) {
+        auto sizeName = std::to_string(size.first) + "x" + std::to_string(size.second);
+        checks.push_back({ "DepthTransformFilter/chain_y16_" + sizeName, [size, y16Values]() {
+                              auto frame = createVideoFrame(OB_FRAME_DEPTH, OB_FORMAT_Y16, size.first, size.second,
+                                                            generateRandomDepth(size.first, size.second, 4000, size.first));
+                              return checkDepthTransform(frame, y16Values);
+                          } });
+        checks.push_back({ "DepthTransformFilter/chain_y8_" + sizeName, [size, y8Values]() {
+                              auto frame = createVideoFrame(OB_FRAME_DEPTH, OB_FORMAT_Y8, size.first, size.second,
+                                                            generateRandomBytes(static_cast<size_t>(size.first) * size.second, size.second));
+                              return checkDepthTransform(frame, y8Values);
+                          } });
+    }
+    return checks;
+}
+
+}  // namespace filter_benchmark
@@ -0,0 +1,528 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+// Runs every public filter over synthetic frames wrapped from user buffers. Reports the time per frame, the input throughput and the heap
+// allocations per frame, and writes them to a CSV file that a later run can compare against. Then compares the output of the rewritten
+// filters with reference implementations, see reference_check.hpp.
+
+#include "reference_check.hpp"
+#include "FilterFactory.hpp"
+#include "frame/FrameFactory.hpp"
+#include "stream/StreamProfile.hpp"
+#include "stream/StreamProfileFactory.hpp"
+#include <turbojpeg.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Every heap allocation of the process, the filter threads included
+std::atomic<uint64_t> allocationCount(0);
+std::atomic<uint64_t> allocatedBytes(0);
+
+void *countedAllocate(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+    auto ptr = countedAllocate(size);
+    if(!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    return countedAllocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+    return countedAllocate(size);
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+using namespace libobsensor;
+using namespace filter_benchmark;
+
+typedef std::shared_ptr<std::vector<uint8_t>> Buffer;
+
+const uint32_t DEPTH_WIDTH   = 1280;
+const uint32_t DEPTH_HEIGHT  = 800;
+const uint32_t COLOR_WIDTH   = 1280;
+const uint32_t COLOR_HEIGHT  = 720;
+const int      WARMUP_ROUNDS = 10;  // the filters build their tables and the frame pool fills up on the first frames
+
+// The synthetic metadata of the HDR frames, an array of int64_t
+enum SyntheticMetadataField {
+    METADATA_HDR_SEQUENCE_SIZE,
+    METADATA_HDR_SEQUENCE_INDEX,
+    METADATA_FRAME_NUMBER,
+    METADATA_FIELD_COUNT,
+};
+
+class SyntheticMetadataParser : public IFrameMetadataParser {
+public:
+    explicit SyntheticMetadataParser(SyntheticMetadataField field) : field_(field) {}
+
+    int64_t getValue(const uint8_t *metadata, size_t dataSize) override {
+        int64_t value = 0;
+        if(isSupported(metadata, dataSize)) {
+            memcpy(&value, metadata + field_ * sizeof(int64_t), sizeof(value));
+        }
+        return value;
+    }
+
+    bool isSupported(const uint8_t *metadata, size_t dataSize) override {
+        return metadata != nullptr && dataSize >= (field_ + 1) * sizeof(int64_t);
+    }
+
+private:
+    SyntheticMetadataField field_;
+};
+
+class SyntheticMetadataParsers : public IFrameMetadataParserContainer {
+public:
+    SyntheticMetadataParsers() {
+        registerParser(OB_FRAME_METADATA_TYPE_HDR_SEQUENCE_SIZE, std::make_shared<SyntheticMetadataParser>(METADATA_HDR_SEQUENCE_SIZE));
+        registerParser(OB_FRAME_METADATA_TYPE_HDR_SEQUENCE_INDEX, std::make_shared<SyntheticMetadataParser>(METADATA_HDR_SEQUENCE_INDEX));
+        registerParser(OB_FRAME_METADATA_TYPE_FRAME_NUMBER, std::make_shared<SyntheticMetadataParser>(METADATA_FRAME_NUMBER));
+    }
+
+    void registerParser(OBFrameMetadataType type, std::shared_ptr<IFrameMetadataParser> parser) override {
+        parsers_[type] = parser;
+    }
+
+    bool isContained(OBFrameMetadataType type) override {
+        return parsers_.find(type) != parsers_.end();
+    }
+
+    std::shared_ptr<IFrameMetadataParser> get(OBFrameMetadataType type) override {
+        return parsers_.at(type);  // the callers catch the exception of an unregistered type
+    }
+
+    uint64_t parseAll(const uint8_t *metadata, size_t dataSize, int64_t *values, uint64_t skipMask) override {
+        uint64_t validMask = 0;
+        for(auto &item: parsers_) {
+            auto type = static_cast<uint32_t>(item.first);
+            if((skipMask & (1ULL << type)) == 0 && item.second->isSupported(metadata, dataSize)) {
+                values[type] = item.second->getValue(metadata, dataSize);
+                validMask |= 1ULL << type;
+            }
+        }
+        return validMask;
+    }
+
+private:
+    std::map<OBFrameMetadataType, std::shared_ptr<IFrameMetadataParser>> parsers_;
+};
+
+struct Scenario {
+    std::string                                  name;  // <filter>/<input>, the key of the results
+    std::string                                  filterName;
+    std::vector<std::pair<std::string, double>> config;
+    std::vector<std::shared_ptr<const Frame>>    inputs;  // processed in turn, e.g. the two exposures of a HDR sequence
+};
+
+struct Result {
+    std::string name;
+    std::string filterName;
+    int         frames;
+    double      nsPerFrame;
+    double      mbPerSecond;
+    double      allocationsPerFrame;
+    double      allocatedBytesPerFrame;
+    int         failedFrames;
+};
+
+Buffer generateRandomData(size_t size, uint32_t seed) {
+    auto buffer = std::make_shared<std::vector<uint8_t>>(size);
+    for(auto &value: *buffer) {
+        value = static_cast<uint8_t>(nextRandom(seed));
+    }
+    return buffer;
+}
+
+// A room seen by the depth camera: a back wall, the floor getting closer at the bottom and a box, with noise and some invalid pixels
+Buffer generateDepthData(uint32_t width, uint32_t height, uint32_t seed) {
+    auto buffer = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(width) * height * sizeof(uint16_t));
+    auto depth  = reinterpret_cast<uint16_t *>(buffer->data());
+    for(uint32_t y = 0; y < height; y++) {
+        for(uint32_t x = 0; x < width; x++) {
+            uint32_t value = 2500;
+            if(y > height * 2 / 3) {
+                value = 700 + (height - y) * 1800 * 3 / height;
+            }
+            if(x > width / 3 && x < width / 2 && y > height / 3 && y < height * 2 / 3) {
+                value = 1200;
+            }
+            auto random = nextRandom(seed);
+            value += random % 9;
+            depth[y * width + x] = (random >> 4) % 50 == 0 ? 0 : static_cast<uint16_t>(value);
+        }
+    }
+    return buffer;
+}
+
+Buffer generateMjpegData(uint32_t width, uint32_t height) {
+    std::vector<uint8_t> image(static_cast<size_t>(width) * height * 3);
+    uint32_t             random = 12345;
+    for(size_t i = 0; i < image.size(); i++) {
+        image[i] = static_cast<uint8_t>((i % (width * 3)) * 255 / (width * 3) + nextRandom(random) % 16);
+    }
+    auto           handle = tjInitCompress();
+    unsigned char *jpeg   = nullptr;
+    unsigned long  size   = 0;
+    auto ret = tjCompress2(handle, image.data(), static_cast<int>(width), 0, static_cast<int>(height), TJPF_RGB, &jpeg, &size, TJSAMP_422, 85, 0);
+    tjDestroy(handle);
+    if(ret != 0) {
+        throw std::runtime_error("failed to compress the MJPEG frame");
+    }
+    auto buffer = std::make_shared<std::vector<uint8_t>>(jpeg, jpeg + size);
+    tjFree(jpeg);
+    return buffer;
+}
+
+// The frame uses the buffer without a copy, the reclaim function keeps it alive as long as the frame
+std::shared_ptr<Frame> wrapVideoFrame(OBFrameType type, std::shared_ptr<VideoStreamProfile> profile, Buffer buffer) {
+    auto frame = FrameFactory::createVideoFrameFromUserBuffer(type, profile->getFormat(), profile->getWidth(), profile->getHeight(), 0, buffer->data(),
+                                                              buffer->size(), [buffer]() {});
+    frame->setStreamProfile(profile);
+    return frame;
+}
+
+std::shared_ptr<Frame> wrapFrame(OBFrameType type, std::shared_ptr<StreamProfile> profile, Buffer buffer) {
+    auto frame = FrameFactory::createFrameFromUserBuffer(type, profile->getFormat(), buffer->data(), buffer->size(), [buffer]() {});
+    frame->setStreamProfile(profile);
+    return frame;
+}
+
+std::shared_ptr<const Frame> createFrameSet(std::shared_ptr<Frame> depth, std::shared_ptr<Frame> color) {
+    auto frameSet = FrameFactory::createFrameSet();
+    frameSet->pushFrame(std::move(depth));
+    frameSet->pushFrame(std::move(color));
+    return frameSet;
+}
+
+std::shared_ptr<Frame> createHdrFrame(std::shared_ptr<VideoStreamProfile> profile, int64_t sequenceIndex, uint32_t seed) {
+    static auto metadataParsers = std::make_shared<SyntheticMetadataParsers>();
+
+    int64_t metadata[METADATA_FIELD_COUNT] = {};
+    metadata[METADATA_HDR_SEQUENCE_SIZE]   = 2;
+    metadata[METADATA_HDR_SEQUENCE_INDEX]  = sequenceIndex;
+    metadata[METADATA_FRAME_NUMBER]        = sequenceIndex;  // the two frames of the sequence are adjacent
+
+    auto frame = wrapVideoFrame(OB_FRAME_DEPTH, profile, generateDepthData(profile->getWidth(), profile->getHeight(), seed));
+    frame->registerMetadataParsers(metadataParsers);
+    frame->updateMetadata(reinterpret_cast<const uint8_t *>(metadata), sizeof(metadata));
+    return frame;
+}
+
+std::vector<Scenario> createScenarios() {
+    // A Gemini 330 like camera: the depth and color sensors 15mm apart, the color lens with some distortion
+    OBCameraIntrinsic  depthIntrinsic  = { 690.0f, 690.0f, 640.0f, 400.0f, static_cast<int16_t>(DEPTH_WIDTH), static_cast<int16_t>(DEPTH_HEIGHT) };
+    OBCameraIntrinsic  colorIntrinsic  = { 910.0f, 910.0f, 640.0f, 360.0f, static_cast<int16_t>(COLOR_WIDTH), static_cast<int16_t>(COLOR_HEIGHT) };
+    OBCameraDistortion depthDistortion = {};
+    OBCameraDistortion colorDistortion = { 0.08f, -0.05f, 0.01f, 0, 0, 0, 0.0005f, -0.0003f, OB_DISTORTION_BROWN_CONRADY };
+    OBExtrinsic        depthToColor    = { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { -15.0f, 0, 0 } };
+
+    auto depthProfile = StreamProfileFactory::createVideoStreamProfile(OB_STREAM_DEPTH, OB_FORMAT_Y16, DEPTH_WIDTH, DEPTH_HEIGHT, 30);
+    depthProfile->bindIntrinsic(depthIntrinsic);
+    depthProfile->bindDistortion(depthDistortion);
+
+    auto colorProfile = StreamProfileFactory::createVideoStreamProfile(OB_STREAM_COLOR, OB_FORMAT_RGB, COLOR_WIDTH, COLOR_HEIGHT, 30);
+    colorProfile->bindIntrinsic(colorIntrinsic);
+    colorProfile->bindDistortion(colorDistortion);
+    depthProfile->bindExtrinsicTo(colorProfile, depthToColor);
+
+    // the depth once aligned to the color, for the RGBD point cloud
+    auto alignedDepthProfile = StreamProfileFactory::createVideoStreamProfile(OB_STREAM_DEPTH, OB_FORMAT_Y16, COLOR_WIDTH, COLOR_HEIGHT, 30);
+    alignedDepthProfile->bindIntrinsic(colorIntrinsic);
+    alignedDepthProfile->bindDistortion(colorDistortion);
+    alignedDepthProfile->bindSameExtrinsicTo(colorProfile);
+
+    auto depthFrame        = wrapVideoFrame(OB_FRAME_DEPTH, depthProfile, generateDepthData(DEPTH_WIDTH, DEPTH_HEIGHT, 1));
+    auto colorFrame        = wrapVideoFrame(OB_FRAME_COLOR, colorProfile, generateRandomData(COLOR_WIDTH * COLOR_HEIGHT * 3, 2));
+    auto alignedDepthFrame = wrapVideoFrame(OB_FRAME_DEPTH, alignedDepthProfile, generateDepthData(COLOR_WIDTH, COLOR_HEIGHT, 3));
+    auto depthColorSet     = createFrameSet(depthFrame, colorFrame);
+    auto alignedSet        = createFrameSet(alignedDepthFrame, colorFrame);
+
+    std::vector<std::shared_ptr<const Frame>> hdrSequence = { createHdrFrame(depthProfile, 0, 4), createHdrFrame(depthProfile, 1, 5) };
+
+    auto yuyvProfile = StreamProfileFactory::createVideoStreamProfile(OB_STREAM_COLOR, OB_FORMAT_YUYV, COLOR_WIDTH, COLOR_HEIGHT, 30);
+    auto nv12Profile = StreamProfileFactory::createVideoStreamProfile(OB_STREAM_COLOR, OB_FORMAT_NV12, COLOR_WIDTH, COLOR_HEIGHT, 30);
+    auto mjpgProfile = StreamProfileFactory::createVideoStreamProfile(OB_STREAM_COLOR, OB_FORMAT_MJPG, COLOR_WIDTH, COLOR_HEIGHT, 30);
+    auto yuyvFrame   = wrapVideoFrame(OB_FRAME_COLOR, yuyvProfile, generateRandomData(COLOR_WIDTH * COLOR_HEIGHT * 2, 6));
+    auto nv12Frame   = wrapVideoFrame(OB_FRAME_COLOR, nv12Profile, generateRandomData(COLOR_WIDTH * COLOR_HEIGHT * 3 / 2, 7));
+    auto mjpgFrame   = wrapVideoFrame(OB_FRAME_COLOR, mjpgProfile, generateMjpegData(COLOR_WIDTH, COLOR_HEIGHT));
+
+    // A full ME450 frame at 10Hz, the LiDAR streamer hands the sphere points to the converter in a OB_FORMAT_LIDAR_POINT frame
+    auto sphereProfile = StreamProfileFactory::createLiDARStreamProfile(OB_LIDAR_SCAN_10HZ, OB_FORMAT_LIDAR_SPHERE_POINT);
+    auto pointProfile  = StreamProfileFactory::createLiDARStreamProfile(OB_LIDAR_SCAN_10HZ, OB_FORMAT_LIDAR_POINT);
+    auto pointCount    = sphereProfile->getInfo().maxDataBlockNum * sphereProfile->getInfo().pointsNum;
+    auto spherePoints  = std::make_shared<std::vector<uint8_t>>(pointCount * sizeof(OBLiDARSpherePoint));
+    auto points        = reinterpret_cast<OBLiDARSpherePoint *>(spherePoints->data());
+    uint32_t random    = 8;
+    for(uint32_t i = 0; i < pointCount; i++) {
+        points[i].distance     = static_cast<float>(3000 + nextRandom(random) % 400);
+        points[i].theta        = static_cast<int16_t>(i * 27000 / pointCount + 4500) * 0.01f;
+        points[i].phi          = static_cast<int16_t>(static_cast<int>(i % 16) * 300 - 2250) * 0.01f;
+        points[i].reflectivity = static_cast<uint8_t>(nextRandom(random));
+        points[i].tag          = 0;
+    }
+    auto sphereFrame = wrapFrame(OB_FRAME_LIDAR_POINTS, sphereProfile, spherePoints);
+    auto lidarFrame  = wrapFrame(OB_FRAME_LIDAR_POINTS, pointProfile, spherePoints);
+
+    const std::string depthInput = "depth_y16_" + std::to_string(DEPTH_WIDTH) + "x" + std::to_string(DEPTH_HEIGHT);
+    const std::string colorSize  = std::to_string(COLOR_WIDTH) + "x" + std::to_string(COLOR_HEIGHT);
+
+    return {
+        { "ThresholdFilter/" + depthInput, "ThresholdFilter", { { "min", 300 }, { "max", 3000 } }, { depthFrame } },
+        { "PixelValueScaler/" + depthInput, "PixelValueScaler", { { "scale", 0.5 } }, { depthFrame } },
+        { "PixelValueOffset/" + depthInput, "PixelValueOffset", { { "offset", 2 } }, { depthFrame } },
+        { "DecimationFilter/" + depthInput, "DecimationFilter", { { "decimate", 2 } }, { depthFrame } },
+        { "FrameMirror/" + depthInput, "FrameMirror", {}, { depthFrame } },
+        { "FrameMirror/color_rgb_" + colorSize, "FrameMirror", {}, { colorFrame } },
+        { "FrameFlip/" + depthInput, "FrameFlip", {}, { depthFrame } },
+        { "FrameRotate/" + depthInput + "_90", "FrameRotate", { { "rotate", 90 } }, { depthFrame } },
+        { "HDRMerge/" + depthInput + "_sequence", "HDRMerge", {}, hdrSequence },
+        { "SequenceIdFilter/" + depthInput + "_sequence", "SequenceIdFilter", { { "sequenceid", 0 } }, hdrSequence },
+        { "FormatConverter/yuyv_to_rgb_" + colorSize, "FormatConverter", { { "convertType", FORMAT_YUYV_TO_RGB } }, { yuyvFrame } },
+        { "FormatConverter/nv12_to_rgb_" + colorSize, "FormatConverter", { { "convertType", FORMAT_NV12_TO_RGB } }, { nv12Frame } },
+        { "FormatConverter/mjpg_to_rgb_" + colorSize, "FormatConverter", { { "convertType", FORMAT_MJPG_TO_RGB } }, { mjpgFrame } },
+        { "PointCloudFilter/xyz_" + depthInput, "PointCloudFilter", { { "pointFormat", OB_FORMAT_POINT } }, { depthFrame } },
+        { "PointCloudFilter/rgbd_" + colorSize, "PointCloudFilter", { { "pointFormat", OB_FORMAT_RGB_POINT } }, { alignedSet } },
+        { "Align/depth_to_color_" + colorSize, "Align", { { "AlignType", OB_STREAM_COLOR } }, { depthColorSet } },
+        { "Align/color_to_depth_" + colorSize, "Align", { { "AlignType", OB_STREAM_DEPTH } }, { depthColorSet } },
+        { "LiDARPointFilter/sphere_" + std::to_string(pointCount), "LiDARPointFilter", { { "FilterLevel", 5 } }, { sphereFrame } },
+        { "LiDARFormatConverter/sphere_" + std::to_string(pointCount), "LiDARFormatConverter", {}, { lidarFrame } },
+    };
+}
+
+std::vector<ReferenceCheck> createReferenceChecks() {
+    std::vector<ReferenceCheck> checks;
+    for(auto &group: { createDepthTransformChecks(), createGeometricTransformChecks(), createDecimationChecks() }) {
+        checks.insert(checks.end(), group.begin(), group.end());
+    }
+    return checks;
+}
+
+size_t frameBytes(const std::shared_ptr<const Frame> &frame) {
+    if(!frame->is<FrameSet>()) {
+        return frame->getDataSize();
+    }
+    size_t bytes    = 0;
+    auto   frameSet = frame->as<FrameSet>();
+    for(uint32_t i = 0; i < frameSet->getCount(); i++) {
+        bytes += frameSet->getFrame(static_cast<int>(i))->getDataSize();
+    }
+    return bytes;
+}
+
+Result runScenario(const Scenario &scenario, int rounds) {
+    auto filter = FilterFactory::getInstance()->createFilter(scenario.filterName);
+    for(auto &config: scenario.config) {
+        filter->setConfigValue(config.first, config.second);
+    }
+
+    std::shared_ptr<Frame> output;
+    for(int i = 0; i < WARMUP_ROUNDS; i++) {
+        output = filter->process(scenario.inputs[i % scenario.inputs.size()]);
+    }
+
+    size_t inputBytes   = 0;
+    int    failedFrames = 0;
+    for(int i = 0; i < rounds; i++) {
+        inputBytes += frameBytes(scenario.inputs[i % scenario.inputs.size()]);
+    }
+
+    auto allocations = allocationCount.load();
+    auto bytes       = allocatedBytes.load();
+    auto start       = std::chrono::steady_clock::now();
+    for(int i = 0; i < rounds; i++) {
+        output = filter->process(scenario.inputs[i % scenario.inputs.size()]);
+        failedFrames += output ? 0 : 1;
+    }
+    auto elapsedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    allocations    = allocationCount.load() - allocations;
+    bytes          = allocatedBytes.load() - bytes;
+    output.reset();
+
+    Result result;
+    result.name                   = scenario.name;
+    result.filterName             = scenario.filterName;
+    result.frames                 = rounds;
+    result.nsPerFrame             = elapsedNs / rounds;
+    result.mbPerSecond            = static_cast<double>(inputBytes) / (1024.0 * 1024.0) / (elapsedNs / 1e9);
+    result.allocationsPerFrame    = static_cast<double>(allocations) / rounds;
+    result.allocatedBytesPerFrame = static_cast<double>(bytes) / rounds;
+    result.failedFrames           = failedFrames;
+    return result;
+}
+
+const char *CSV_HEADER = "scenario,filter,frames,ns_per_frame,mb_per_s,allocations_per_frame,allocated_bytes_per_frame,failed_frames";
+
+void writeCsv(const std::string &filePath, const std::vector<Result> &results) {
+    std::ofstream file(filePath);
+    if(!file) {
+        throw std::runtime_error("failed to open " + filePath);
+    }
+    file << CSV_HEADER << "\n";
+    for(auto &result: results) {
+        file << result.name << "," << result.filterName << "," << result.frames << "," << result.nsPerFrame << "," << result.mbPerSecond << ","
+             << result.allocationsPerFrame << "," << result.allocatedBytesPerFrame << "," << result.failedFrames << "\n";
+    }
+}
+
+// ns_per_frame of every scenario of a previous run
+std::map<std::string, double> readBaseline(const std::string &filePath) {
+    std::ifstream file(filePath);
+    if(!file) {
+        throw std::runtime_error("failed to open " + filePath);
+    }
+    std::map<std::string, double> baseline;
+    std::string                   line;
+    std::getline(file, line);  // header
+    while(std::getline(file, line)) {
+        std::vector<std::string> fields;
+        std::stringstream        stream(line);
+        std::string              field;
+        while(std::getline(stream, field, ',')) {
+            fields.push_back(field);
+        }
+        if(fields.size() >= 4) {
+            baseline[fields[0]] = std::stod(fields[3]);
+        }
+    }
+    return baseline;
+}
+
+void printUsage() {
+    std::cout << "Usage: ob_filter_benchmark [--rounds N] [--filter NAME] [--csv FILE] [--baseline FILE] [--tolerance PERCENT]" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) try {
+    int         rounds    = 100;
+    double      tolerance = 20.0;
+    std::string nameFilter, csvPath, baselinePath;
+    for(int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if(arg == "--help" || arg == "-h" || i + 1 >= argc) {
+            printUsage();
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+        std::string value = argv[++i];
+        if(arg == "--rounds") {
+            rounds = std::max(1, std::stoi(value));
+        }
+        else if(arg == "--filter") {
+            nameFilter = value;
+        }
+        else if(arg == "--csv") {
+            csvPath = value;
+        }
+        else if(arg == "--baseline") {
+            baselinePath = value;
+        }
+        else if(arg == "--tolerance") {
+            tolerance = std::stod(value);
+        }
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    std::map<std::string, double> baseline;
+    if(!baselinePath.empty()) {
+        baseline = readBaseline(baselinePath);
+    }
+
+    std::cout << rounds << " frames per scenario" << std::endl;
+    std::printf("%-44s %-12s %-10s %-12s %-14s %s\n", "scenario", "ns/frame", "MB/s", "allocs/frame", "alloc KB/frame", "status");
+
+    std::vector<Result> results;
+    bool                passed = true;
+    for(auto &scenario: createScenarios()) {
+        if(!nameFilter.empty() && scenario.name.find(nameFilter) == std::string::npos) {
+            continue;
+        }
+        auto result = runScenario(scenario, rounds);
+
+        std::string status = "ok";
+        if(result.failedFrames > 0) {
+            status = std::to_string(result.failedFrames) + " frames failed";
+            passed = false;
+        }
+        auto base = baseline.find(result.name);
+        if(base != baseline.end() && result.nsPerFrame > base->second * (1.0 + tolerance / 100.0)) {
+            status = "regressed from " + std::to_string(static_cast<int64_t>(base->second)) + " ns";
+            passed = false;
+        }
+        std::printf("%-44s %-12.0f %-10.1f %-12.1f %-14.1f %s\n", result.name.c_str(), result.nsPerFrame, result.mbPerSecond, result.allocationsPerFrame,
+                    result.allocatedBytesPerFrame / 1024.0, status.c_str());
+        results.push_back(result);
+    }
+
+    if(!csvPath.empty()) {
+        writeCsv(csvPath, results);
+    }
+
+    bool headerPrinted = false;
+    for(auto &check: createReferenceChecks()) {
+        if(!nameFilter.empty() && check.name.find(nameFilter) == std::string::npos) {
+            continue;
+        }
+        if(!headerPrinted) {
+            std::printf("\n%-44s %-12s %s\n", "reference check", "mismatch", "status");
+            headerPrinted = true;
+        }
+        auto mismatches = check.run();
+        passed          = passed && mismatches == 0;
+        std::printf("%-44s %-12zu %s\n", check.name.c_str(), mismatches, mismatches == 0 ? "ok" : "differs");
+    }
+    return passed ? 0 : 1;
+}
+catch(const std::exception &e) {
+    std::cerr << "Filter benchmark failed: " << e.what() << std::endl;
+    return 1;
+}
@@ -0,0 +1,328 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+// FrameMirror, FrameFlip and FrameRotate against their previous per pixel implementations, kept here as the reference.
+
+#include "reference_check.hpp"
+
+#include <libyuv.h>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace filter_benchmark {
+
+using namespace libobsensor;
+
+namespace {
+
+template <typename T> void referenceImageMirror(const T *src, T *dst, uint32_t width, uint32_t height) {
+    const T *srcPixel;
+    T       *dstPixel = dst;
+    for(uint32_t h = 0; h < height; h++) {
+        srcPixel = src + (h + 1) * width - 1;
+        for(uint32_t w = 0; w < width; w++) {
+            *dstPixel = *srcPixel;
+            srcPixel--;
+            dstPixel++;
+        }
+    }
+}
+
+template <typename T> void referenceImageFlip(const T *src, T *dst, uint32_t width, uint32_t height) {
+    const T *flipSrc = src + (width * height);
+    for(uint32_t h = 0; h < height; h++) {
+        flipSrc -= width;
+        memcpy(dst, flipSrc, width * sizeof(T));
+        dst += width;
+    }
+}
+
+template <typename T> void referenceImageRotate90(const T *src, T *dst, uint32_t width, uint32_t height) {
+    T *dstPixel = dst;
+    for(uint32_t h = 0; h < width; h++) {
+        for(uint32_t w = 0; w < height; w++) {
+            *dstPixel = src[width * (height - w - 1) + h];
+            dstPixel++;
+        }
+    }
+}
+
+template <typename T> void referenceImageRotate180(const T *src, T *dst, uint32_t width, uint32_t height) {
+    T *dstPixel = dst;
+    for(uint32_t h = 0; h < height; h++) {
+        for(uint32_t w = 0; w < width; w++) {
+            *dstPixel = src[width * (height - h - 1) + (width - w - 1)];
+            dstPixel++;
+        }
+    }
+}
+
+template <typename T> void referenceImageRotate270(const T *src, T *dst, uint32_t width, uint32_t height) {
+    T *dstPixel = dst;
+    for(uint32_t h = 0; h < width; h++) {
+        for(uint32_t w = 0; w < height; w++) {
+            *dstPixel = src[width * w + (width - h - 1)];
+            dstPixel++;
+        }
+    }
+}
+
+template <typename T> void referenceImageRotate(const T *src, T *dst, uint32_t width, uint32_t height, uint32_t rotateDegree) {
+    if(rotateDegree == 90) {
+        referenceImageRotate90(src, dst, width, height);
+    }
+    else if(rotateDegree == 180) {
+        referenceImageRotate180(src, dst, width, height);
+    }
+    else {
+        referenceImageRotate270(src, dst, width, height);
+    }
+}
+
+void referenceMirrorRgbImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t pixelSize) {
+    uint8_t *dstPixel = dst;
+    for(uint32_t h = 0; h < height; h++) {
+        const uint8_t *srcPixel = src + (h + 1) * width * pixelSize - pixelSize;
+        for(uint32_t w = 0; w < width; w++) {
+            memcpy(dstPixel, srcPixel, pixelSize);
+            srcPixel -= pixelSize;
+            dstPixel += pixelSize;
+        }
+    }
+}
+
+void referenceMirrorYuyvImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height) {
+    uint8_t *dstPixel = dst;
+    for(uint32_t h = 0; h < height; h++) {
+        const uint8_t *srcPixel = src + width * 2 * (h + 1) - 4;
+        for(uint32_t w = 0; w < width / 2; w++) {
+            dstPixel[0] = srcPixel[2];
+            dstPixel[1] = srcPixel[1];
+            dstPixel[2] = srcPixel[0];
+            dstPixel[3] = srcPixel[3];
+            srcPixel -= 4;
+            dstPixel += 4;
+        }
+    }
+}
+
+void referenceMirrorUyvyImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height) {
+    uint8_t *dstPixel = dst;
+    for(uint32_t h = 0; h < height; h++) {
+        const uint8_t *srcPixel = src + width * 2 * (h + 1) - 4;
+        for(uint32_t w = 0; w < width / 2; w++) {
+            dstPixel[0] = srcPixel[0];
+            dstPixel[1] = srcPixel[3];
+            dstPixel[2] = srcPixel[2];
+            dstPixel[3] = srcPixel[1];
+            srcPixel -= 4;
+            dstPixel += 4;
+        }
+    }
+}
+
+void referenceFlipRgbImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t pixelSize) {
+    const uint32_t rowSize = width * pixelSize;
+    for(uint32_t h = 0; h < height; h++) {
+        memcpy(dst, src + (height - h - 1) * rowSize, rowSize);
+        dst += rowSize;
+    }
+}
+
+void referenceRotateRgbImage(const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree, uint32_t pixelSize) {
+    for(uint32_t y = 0; y < height; y++) {
+        for(uint32_t x = 0; x < width; x++) {
+            const uint8_t *srcPixel = src + (static_cast<size_t>(y) * width + x) * pixelSize;
+            size_t         dstIndex;
+            if(rotateDegree == 90) {
+                dstIndex = static_cast<size_t>(x) * height + (height - y - 1);
+            }
+            else if(rotateDegree == 180) {
+                dstIndex = static_cast<size_t>(height - y - 1) * width + (width - x - 1);
+            }
+            else {
+                dstIndex = static_cast<size_t>(width - x - 1) * height + y;
+            }
+            memcpy(dst + dstIndex * pixelSize, srcPixel, pixelSize);
+        }
+    }
+}
+
+// The packed YUV image goes through I420, the chroma of two rows is averaged. The previous implementation used the source frame as the
+// scratch buffer, here a buffer of the same size.
+void referenceRotatePackedYuvImage(bool uyvy, const uint8_t *source, uint8_t *dst, uint32_t width, uint32_t height, uint32_t rotateDegree) {
+    auto rotationMode = rotateDegree == 90 ? libyuv::kRotate90 : (rotateDegree == 180 ? libyuv::kRotate180 : libyuv::kRotate270);
+
+    std::vector<uint8_t> scratch(static_cast<size_t>(width) * height * 2);
+    int                  w    = static_cast<int>(width);
+    int                  h    = static_cast<int>(height);
+    uint8_t             *srcY = dst;
+    uint8_t             *srcU = dst + width * height;
+    uint8_t             *srcV = srcU + width * height / 4;
+    if(uyvy) {
+        libyuv::UYVYToI420(source, w * 2, srcY, w, srcU, w / 2, srcV, w / 2, w, h);
+    }
+    else {
+        libyuv::YUY2ToI420(source, w * 2, srcY, w, srcU, w / 2, srcV, w / 2, w, h);
+    }
+
+    int      dstWidth  = rotationMode == libyuv::kRotate180 ? w : h;
+    int      dstHeight = rotationMode == libyuv::kRotate180 ? h : w;
+    uint8_t *dstY      = scratch.data();
+    uint8_t *dstU      = dstY + width * height;
+    uint8_t *dstV      = dstU + width * height / 4;
+    libyuv::I420Rotate(srcY, w, srcU, w / 2, srcV, w / 2, dstY, dstWidth, dstU, dstWidth / 2, dstV, dstWidth / 2, w, h, rotationMode);
+
+    if(uyvy) {
+        libyuv::I420ToUYVY(dstY, dstWidth, dstU, dstWidth / 2, dstV, dstWidth / 2, dst, dstWidth * 2, dstWidth, dstHeight);
+    }
+    else {
+        libyuv::I420ToYUY2(dstY, dstWidth, dstU, dstWidth / 2, dstV, dstWidth / 2, dst, dstWidth * 2, dstWidth, dstHeight);
+    }
+}
+
+enum Transform { TRANSFORM_MIRROR, TRANSFORM_FLIP, TRANSFORM_ROTATE_90, TRANSFORM_ROTATE_180, TRANSFORM_ROTATE_270 };
+
+// the output of the previous implementation, false if it did not write the output frame
+bool referenceTransform(OBFrameType type, OBFormat format, const uint8_t *src, uint8_t *dst, uint32_t width, uint32_t height, Transform transform) {
+    bool     color        = is_color_frame(type);
+    uint32_t rotateDegree = transform == TRANSFORM_ROTATE_90 ? 90 : (transform == TRANSFORM_ROTATE_180 ? 180 : 270);
+    auto     src16        = reinterpret_cast<const uint16_t *>(src);
+    auto     dst16        = reinterpret_cast<uint16_t *>(dst);
+    switch(format) {
+    case OB_FORMAT_Y8:
+        if(transform == TRANSFORM_MIRROR) {
+            referenceImageMirror(src, dst, width, height);
+        }
+        else if(transform == TRANSFORM_FLIP) {
+            referenceImageFlip(src, dst, width, height);
+        }
+        else {
+            referenceImageRotate(src, dst, width, height, rotateDegree);
+        }
+        return true;
+    case OB_FORMAT_Y12C4:
+    case OB_FORMAT_Y16:
+        if(transform == TRANSFORM_MIRROR) {
+            referenceImageMirror(src16, dst16, width, height);
+        }
+        else if(transform == TRANSFORM_FLIP) {
+            referenceImageFlip(src16, dst16, width, height);
+        }
+        else {
+            referenceImageRotate(src16, dst16, width, height, rotateDegree);
+        }
+        return true;
+    case OB_FORMAT_YUYV:
+    case OB_FORMAT_UYVY:
+        if(transform == TRANSFORM_MIRROR) {
+            if(!color) {
+                if(format == OB_FORMAT_UYVY) {
+                    return false;  // left the output frame unwritten
+                }
+                referenceImageMirror(reinterpret_cast<const uint32_t *>(src), reinterpret_cast<uint32_t *>(dst), width / 2, height);
+            }
+            else if(format == OB_FORMAT_YUYV) {
+                referenceMirrorYuyvImage(src, dst, width, height);
+            }
+            else {
+                referenceMirrorUyvyImage(src, dst, width, height);
+            }
+        }
+        else if(transform == TRANSFORM_FLIP) {
+            referenceImageFlip(src16, dst16, width, height);
+        }
+        else {
+            referenceRotatePackedYuvImage(format == OB_FORMAT_UYVY, src, dst, width, height, rotateDegree);
+        }
+        return true;
+    case OB_FORMAT_RGB:
+    case OB_FORMAT_BGR:
+    case OB_FORMAT_RGBA:
+    case OB_FORMAT_BGRA: {
+        uint32_t pixelSize = format == OB_FORMAT_RGB || format == OB_FORMAT_BGR ? 3 : 4;
+        if(transform == TRANSFORM_MIRROR) {
+            referenceMirrorRgbImage(src, dst, width, height, pixelSize);
+        }
+        else if(transform == TRANSFORM_FLIP) {
+            referenceFlipRgbImage(src, dst, width, height, pixelSize);
+        }
+        else {
+            referenceRotateRgbImage(src, dst, width, height, rotateDegree, pixelSize);
+        }
+        return true;
+    }
+    default:
+        throw std::runtime_error("no reference transform for the format " + std::to_string(format));
+    }
+}
+
+uint32_t bytesPerPixel(OBFormat format) {
+    switch(format) {
+    case OB_FORMAT_Y8:
+        return 1;
+    case OB_FORMAT_RGB:
+    case OB_FORMAT_BGR:
+        return 3;
+    case OB_FORMAT_RGBA:
+    case OB_FORMAT_BGRA:
+        return 4;
+    default:
+        return 2;
+    }
+}
+
+size_t checkGeometricTransforms(OBFrameType type, OBFormat format, uint32_t width, uint32_t height) {
+    auto data  = generateRandomBytes(static_cast<size_t>(width) * height * bytesPerPixel(format), width * height);
+    auto frame = createVideoFrame(type, format, width, height, data);
+
+    const std::vector<std::pair<Transform, std::pair<std::string, FilterConfig>>> transforms = {
+        { TRANSFORM_MIRROR, { "FrameMirror", {} } },
+        { TRANSFORM_FLIP, { "FrameFlip", {} } },
+        { TRANSFORM_ROTATE_90, { "FrameRotate", { { "rotate", 90 } } } },
+        { TRANSFORM_ROTATE_180, { "FrameRotate", { { "rotate", 180 } } } },
+        { TRANSFORM_ROTATE_270, { "FrameRotate", { { "rotate", 270 } } } },
+    };
+
+    size_t mismatches = 0;
+    for(auto &transform: transforms) {
+        std::vector<uint8_t> reference(data.size());
+        if(referenceTransform(type, format, data.data(), reference.data(), width, height, transform.first)) {
+            mismatches += countMismatches(processFrame(transform.second.first, transform.second.second, frame), reference);
+        }
+    }
+    return mismatches;
+}
+
+}  // namespace
+
+std::vector<ReferenceCheck> createGeometricTransformChecks() {
+    struct Input {
+        std::string name;
+        OBFrameType type;
+        OBFormat    format;
+    };
+    const std::vector<Input> inputs = {
+        { "depth_y16", OB_FRAME_DEPTH, OB_FORMAT_Y16 },    { "depth_y12c4", OB_FRAME_DEPTH, OB_FORMAT_Y12C4 }, { "ir_y8", OB_FRAME_IR, OB_FORMAT_Y8 },
+        { "color_yuyv", OB_FRAME_COLOR, OB_FORMAT_YUYV },  { "ir_yuyv", OB_FRAME_IR, OB_FORMAT_YUYV },         { "color_uyvy", OB_FRAME_COLOR, OB_FORMAT_UYVY },
+        { "ir_uyvy", OB_FRAME_IR, OB_FORMAT_UYVY },        { "color_rgb", OB_FRAME_COLOR, OB_FORMAT_RGB },     { "color_bgr", OB_FRAME_COLOR, OB_FORMAT_BGR },
+        { "color_rgba", OB_FRAME_COLOR, OB_FORMAT_RGBA },  { "color_bgra", OB_FRAME_COLOR, OB_FORMAT_BGRA },
+    };
+    // the odd sizes only for the formats without 2x2 chroma subsampling in the rotation
+    const std::vector<std::pair<uint32_t, uint32_t>> sizes = { { 1280, 720 }, { 642, 478 }, { 641, 479 }, { 37, 23 } };
+
+    std::vector<ReferenceCheck> checks;
+    for(auto &input: inputs) {
+        for(auto &size: sizes) {
+            if((input.format == OB_FORMAT_YUYV || input.format == OB_FORMAT_UYVY) && (size.first % 2 != 0 || size.second % 2 != 0)) {
+                continue;
+            }
+            auto name = "FrameGeometricTransform/" + input.name + "_" + std::to_string(size.first) + "x" + std::to_string(size.second);
+            checks.push_back({ name, [input, size]() { return checkGeometricTransforms(input.type, input.format, size.first, size.second); } });
+        }
+    }
+    return checks;
+}
+
+}  // namespace filter_benchmark
@@ -0,0 +1,89 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#include "reference_check.hpp"
+#include "FilterFactory.hpp"
+#include "frame/FrameFactory.hpp"
+#include "stream/StreamProfileFactory.hpp"
+#include "utils/PublicTypeHelper.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace filter_benchmark {
+
+using namespace libobsensor;
+
+uint32_t nextRandom(uint32_t &state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+std::vector<uint8_t> generateRandomBytes(size_t size, uint32_t seed) {
+    std::vector<uint8_t> data(size);
+    for(auto &value: data) {
+        value = static_cast<uint8_t>(nextRandom(seed));
+    }
+    return data;
+}
+
+std::vector<uint8_t> generateRandomDepth(uint32_t width, uint32_t height, uint32_t maxValue, uint32_t seed) {
+    std::vector<uint8_t> data(static_cast<size_t>(width) * height * sizeof(uint16_t));
+    auto                 depth = reinterpret_cast<uint16_t *>(data.data());
+    for(size_t i = 0; i < static_cast<size_t>(width) * height; i++) {
+        auto random = nextRandom(seed);
+        depth[i]    = random % 16 == 0 ? 0 : static_cast<uint16_t>((random >> 4) % maxValue);
+    }
+    return data;
+}
+
+std::shared_ptr<Frame> createVideoFrame(OBFrameType type, OBFormat format, uint32_t width, uint32_t height, const std::vector<uint8_t> &data) {
+    OBCameraIntrinsic  intrinsic  = { 700.0f, 700.0f, width / 2.0f, height / 2.0f, static_cast<int16_t>(width), static_cast<int16_t>(height) };
+    OBCameraDistortion distortion = { 0.08f, -0.05f, 0.01f, 0, 0, 0, 0.0005f, -0.0003f, OB_DISTORTION_BROWN_CONRADY };
+
+    auto profile = StreamProfileFactory::createVideoStreamProfile(utils::mapFrameTypeToStreamType(type), format, width, height, 30);
+    profile->bindIntrinsic(intrinsic);
+    profile->bindDistortion(distortion);
+
+    auto buffer = std::make_shared<std::vector<uint8_t>>(data);
+    auto frame  = FrameFactory::createVideoFrameFromUserBuffer(type, format, width, height, 0, buffer->data(), buffer->size(), [buffer]() {});
+    frame->setStreamProfile(profile);
+    return frame;
+}
+
+std::shared_ptr<Frame> processFrame(const std::string &filterName, const FilterConfig &config, std::shared_ptr<const Frame> frame) {
+    auto filter = FilterFactory::getInstance()->createFilter(filterName);
+    for(auto &item: config) {
+        filter->setConfigValue(item.first, item.second);
+    }
+    return filter->process(frame);
+}
+
+size_t countMismatches(const std::shared_ptr<const Frame> &frame, const std::vector<uint8_t> &reference) {
+    if(!frame || frame->getDataSize() != reference.size()) {
+        return reference.size();
+    }
+    auto   data       = frame->getData();
+    size_t mismatches = 0;
+    for(size_t i = 0; i < reference.size(); i++) {
+        mismatches += data[i] != reference[i] ? 1 : 0;
+    }
+    return mismatches;
+}
+
+size_t countMismatches(const std::shared_ptr<const Frame> &frame, const std::shared_ptr<const Frame> &reference) {
+    if(!reference) {
+        throw std::runtime_error("the reference filters returned no frame");
+    }
+    std::vector<uint8_t> referenceData(reference->getData(), reference->getData() + reference->getDataSize());
+    if(frame && frame->is<VideoFrame>() && reference->is<VideoFrame>()) {
+        auto videoFrame     = frame->as<VideoFrame>();
+        auto referenceFrame = reference->as<VideoFrame>();
+        if(videoFrame->getWidth() != referenceFrame->getWidth() || videoFrame->getHeight() != referenceFrame->getHeight()) {
+            return referenceData.size();
+        }
+    }
+    return countMismatches(frame, referenceData);
+}
+
+}  // namespace filter_benchmark
@@ -0,0 +1,46 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "frame/Frame.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace filter_benchmark {
+
+typedef std::vector<std::pair<std::string, double>> FilterConfig;
+
+// Compares the output of a filter with a reference: the previous implementation of the filter, or the filters it stands for
+struct ReferenceCheck {
+    std::string             name;  // <filter>/<input>
+    std::function<size_t()> run;   // returns the number of bytes that differ from the reference
+};
+
+uint32_t nextRandom(uint32_t &state);
+
+std::vector<uint8_t> generateRandomBytes(size_t size, uint32_t seed);
+
+// random depth values below maxValue, one out of 16 is 0 (invalid)
+std::vector<uint8_t> generateRandomDepth(uint32_t width, uint32_t height, uint32_t maxValue, uint32_t seed);
+
+// A frame holding a copy of the data, with a stream profile of its own that has intrinsics, so the filters updating them can run
+std::shared_ptr<libobsensor::Frame> createVideoFrame(OBFrameType type, OBFormat format, uint32_t width, uint32_t height, const std::vector<uint8_t> &data);
+
+// Processes a frame with a new filter of the FilterFactory
+std::shared_ptr<libobsensor::Frame> processFrame(const std::string &filterName, const FilterConfig &config, std::shared_ptr<const libobsensor::Frame> frame);
+
+// The bytes of the frame that differ from the reference, every byte of the reference if the sizes differ or there is no frame
+size_t countMismatches(const std::shared_ptr<const libobsensor::Frame> &frame, const std::vector<uint8_t> &reference);
+size_t countMismatches(const std::shared_ptr<const libobsensor::Frame> &frame, const std::shared_ptr<const libobsensor::Frame> &reference);
+
+std::vector<ReferenceCheck> createDepthTransformChecks();
+std::vector<ReferenceCheck> createGeometricTransformChecks();
+std::vector<ReferenceCheck> createDecimationChecks();
+
+}  // namespace filter_benchmark
@@ -0,0 +1,230 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+// Measures every conversion of the FormatConverter over synthetic frames of the typical color resolutions, and compares the conversions that
+// used to be hand-written pixel loops with the previous scalar implementation. Both must give the same image.
+
+#include "FilterFactory.hpp"
+#include "frame/FrameFactory.hpp"
+#include "stream/StreamProfileFactory.hpp"
+#include <turbojpeg.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace libobsensor;
+
+typedef void (*ReferenceConvert)(const uint8_t *src, uint8_t *target, uint32_t width, uint32_t height);
+
+// The scalar loops the filter used before the SIMD kernels and libyuv
+
+void referenceExchangeRAndB(const uint8_t *src, uint8_t *target, uint32_t width, uint32_t height) {
+    for(uint32_t i = 0; i < width * height; i++) {
+        uint8_t tmp       = src[i * 3];
+        target[i * 3]     = src[i * 3 + 2];
+        target[i * 3 + 1] = src[i * 3 + 1];
+        target[i * 3 + 2] = tmp;
+    }
+}
+
+void referenceDropAlpha(const uint8_t *src, uint8_t *target, uint32_t width, uint32_t height) {
+    for(uint32_t i = 0; i < width * height; ++i) {
+        target[i * 3]     = src[i * 4];
+        target[i * 3 + 1] = src[i * 4 + 1];
+        target[i * 3 + 2] = src[i * 4 + 2];
+    }
+}
+
+void referenceY16ToRgb(const uint8_t *src, uint8_t *target, uint32_t width, uint32_t height) {
+    auto y16 = reinterpret_cast<const uint16_t *>(src);
+    for(uint32_t i = 0; i < width * height; ++i) {
+        uint8_t y8        = y16[i] >> 8;
+        target[i * 3]     = y8;
+        target[i * 3 + 1] = y8;
+        target[i * 3 + 2] = y8;
+    }
+}
+
+void referenceY8ToRgb(const uint8_t *src, uint8_t *target, uint32_t width, uint32_t height) {
+    for(uint32_t i = 0; i < width * height; ++i) {
+        target[i * 3]     = src[i];
+        target[i * 3 + 1] = src[i];
+        target[i * 3 + 2] = src[i];
+    }
+}
+
+void referenceYuyvToY16(const uint8_t *src, uint8_t *target, uint32_t width, uint32_t height) {
+    for(uint32_t i = 0; i < width * height; i++) {
+        target[i * 2]     = 0;
+        target[i * 2 + 1] = src[i * 2];
+    }
+}
+
+void referenceYuyvToY8(const uint8_t *src, uint8_t *target, uint32_t width, uint32_t height) {
+    for(uint32_t i = 0; i < width * height; i++) {
+        target[i] = src[i * 2];
+    }
+}
+
+struct Conversion {
+    const char      *name;
+    OBConvertFormat  type;
+    OBFormat         srcFormat;
+    ReferenceConvert reference;  // nullptr for the conversions that always used libyuv or turbojpeg
+};
+
+const Conversion conversions[] = {
+    { "YUYV_TO_RGB", FORMAT_YUYV_TO_RGB, OB_FORMAT_YUYV, nullptr },
+    { "I420_TO_RGB", FORMAT_I420_TO_RGB, OB_FORMAT_I420, nullptr },
+    { "NV21_TO_RGB", FORMAT_NV21_TO_RGB, OB_FORMAT_NV21, nullptr },
+    { "NV12_TO_RGB", FORMAT_NV12_TO_RGB, OB_FORMAT_NV12, nullptr },
+    { "MJPG_TO_I420", FORMAT_MJPG_TO_I420, OB_FORMAT_MJPG, nullptr },
+    { "RGB_TO_BGR", FORMAT_RGB_TO_BGR, OB_FORMAT_RGB, referenceExchangeRAndB },
+    { "MJPG_TO_NV21", FORMAT_MJPG_TO_NV21, OB_FORMAT_MJPG, nullptr },
+    { "MJPG_TO_RGB", FORMAT_MJPG_TO_RGB, OB_FORMAT_MJPG, nullptr },
+    { "MJPG_TO_BGR", FORMAT_MJPG_TO_BGR, OB_FORMAT_MJPG, nullptr },
+    { "MJPG_TO_BGRA", FORMAT_MJPG_TO_BGRA, OB_FORMAT_MJPG, nullptr },
+    { "UYVY_TO_RGB", FORMAT_UYVY_TO_RGB, OB_FORMAT_UYVY, nullptr },
+    { "BGR_TO_RGB", FORMAT_BGR_TO_RGB, OB_FORMAT_BGR, referenceExchangeRAndB },
+    { "MJPG_TO_NV12", FORMAT_MJPG_TO_NV12, OB_FORMAT_MJPG, nullptr },
+    { "YUYV_TO_BGR", FORMAT_YUYV_TO_BGR, OB_FORMAT_YUYV, nullptr },
+    { "YUYV_TO_RGBA", FORMAT_YUYV_TO_RGBA, OB_FORMAT_YUYV, nullptr },
+    { "YUYV_TO_BGRA", FORMAT_YUYV_TO_BGRA, OB_FORMAT_YUYV, nullptr },
+    { "YUYV_TO_Y16", FORMAT_YUYV_TO_Y16, OB_FORMAT_YUYV, referenceYuyvToY16 },
+    { "YUYV_TO_Y8", FORMAT_YUYV_TO_Y8, OB_FORMAT_YUYV, referenceYuyvToY8 },
+    { "RGBA_TO_RGB", FORMAT_RGBA_TO_RGB, OB_FORMAT_RGBA, referenceDropAlpha },
+    { "BGRA_TO_BGR", FORMAT_BGRA_TO_BGR, OB_FORMAT_BGRA, referenceDropAlpha },
+    { "Y16_TO_RGB", FORMAT_Y16_TO_RGB, OB_FORMAT_Y16, referenceY16ToRgb },
+    { "Y8_TO_RGB", FORMAT_Y8_TO_RGB, OB_FORMAT_Y8, referenceY8ToRgb },
+};
+
+uint32_t nextRandom(uint32_t &state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+size_t rawFrameSize(OBFormat format, uint32_t width, uint32_t height) {
+    size_t pixels = static_cast<size_t>(width) * height;
+    switch(format) {
+    case OB_FORMAT_I420:
+    case OB_FORMAT_NV12:
+    case OB_FORMAT_NV21:
+        return pixels * 3 / 2;
+    case OB_FORMAT_RGB:
+    case OB_FORMAT_BGR:
+        return pixels * 3;
+    case OB_FORMAT_RGBA:
+    case OB_FORMAT_BGRA:
+        return pixels * 4;
+    case OB_FORMAT_Y8:
+        return pixels;
+    default:  // YUYV, UYVY, Y16
+        return pixels * 2;
+    }
+}
+
+std::vector<uint8_t> generateFrameData(OBFormat format, uint32_t width, uint32_t height) {
+    uint32_t random = 12345;
+    if(format != OB_FORMAT_MJPG) {
+        std::vector<uint8_t> data(rawFrameSize(format, width, height));
+        for(auto &value: data) {
+            value = static_cast<uint8_t>(nextRandom(random));
+        }
+        return data;
+    }
+
+    // a noisy gradient compressed like a camera does
+    std::vector<uint8_t> image(static_cast<size_t>(width) * height * 3);
+    for(size_t i = 0; i < image.size(); i++) {
+        image[i] = static_cast<uint8_t>((i % (width * 3)) * 255 / (width * 3) + nextRandom(random) % 16);
+    }
+    auto           handle = tjInitCompress();
+    unsigned char *jpeg   = nullptr;
+    unsigned long  size   = 0;
+    auto ret = tjCompress2(handle, image.data(), static_cast<int>(width), 0, static_cast<int>(height), TJPF_RGB, &jpeg, &size, TJSAMP_422, 85, 0);
+    tjDestroy(handle);
+    if(ret != 0) {
+        throw std::runtime_error("failed to compress the MJPEG frame");
+    }
+    std::vector<uint8_t> data(jpeg, jpeg + size);
+    tjFree(jpeg);
+    return data;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) try {
+    int rounds = argc > 1 ? std::stoi(argv[1]) : 50;
+
+    struct Resolution {
+        uint32_t width;
+        uint32_t height;
+    };
+    const Resolution resolutions[] = { { 640, 480 }, { 1280, 800 }, { 1920, 1080 } };
+
+    auto factory = FilterFactory::getInstance();
+
+    std::cout << rounds << " rounds per conversion" << std::endl;
+    std::printf("%-14s %-11s %-14s %-14s %-10s\n", "conversion", "resolution", "reference us", "filter us", "mismatch");
+
+    bool allMatched = true;
+    for(auto &resolution: resolutions) {
+        auto width          = resolution.width;
+        auto height         = resolution.height;
+        auto resolutionName = std::to_string(width) + "x" + std::to_string(height);
+
+        for(auto &conversion: conversions) {
+            auto data  = generateFrameData(conversion.srcFormat, width, height);
+            auto frame = FrameFactory::createFrame(OB_FRAME_COLOR, conversion.srcFormat, data.size());
+            frame->updateData(data.data(), data.size());
+            frame->setStreamProfile(StreamProfileFactory::createVideoStreamProfile(OB_STREAM_COLOR, conversion.srcFormat, width, height, 30));
+
+            // a filter per conversion, the target profile is only derived again for a new source profile
+            auto filter = factory->createFilter("FormatConverter");
+            filter->setConfigValue("convertType", conversion.type);
+
+            std::shared_ptr<Frame> output;
+            auto                   start = std::chrono::steady_clock::now();
+            for(int i = 0; i < rounds; i++) {
+                output = filter->process(frame);
+            }
+            auto filterUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / rounds;
+            if(!output) {
+                std::printf("%-14s %-11s conversion failed\n", conversion.name, resolutionName.c_str());
+                allMatched = false;
+                continue;
+            }
+
+            if(!conversion.reference) {
+                std::printf("%-14s %-11s %-14s %-14.1f %-10s\n", conversion.name, resolutionName.c_str(), "-", filterUs, "-");
+                continue;
+            }
+
+            std::vector<uint8_t> reference(output->getDataSize());
+            start = std::chrono::steady_clock::now();
+            for(int i = 0; i < rounds; i++) {
+                conversion.reference(data.data(), reference.data(), width, height);
+            }
+            auto referenceUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / rounds;
+
+            size_t mismatches = 0;
+            auto   outData    = output->getData();
+            for(size_t i = 0; i < reference.size(); i++) {
+                mismatches += outData[i] != reference[i] ? 1 : 0;
+            }
+            allMatched = allMatched && mismatches == 0;
+            std::printf("%-14s %-11s %-14.1f %-14.1f %-10zu\n", conversion.name, resolutionName.c_str(), referenceUs, filterUs, mismatches);
+        }
+    }
+    return allMatched ? 0 : 1;
+}
+catch(const std::exception &e) {
+    std::cerr << "Format convert benchmark failed: " << e.what() << std::endl;
+    return 1;
+}
@@ -0,0 +1,114 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+// Compares the per point conversion of LiDAR sphere points (calibration table search for every point) with the block conversion that uses the
+// precomputed received power tables, over synthetic ME450 data blocks. Both paths must give the same points.
+
+#include "component/sensor/lidar/LiDARSpherePointConverter.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace libobsensor;
+
+// ME450 data block: header(40) || 125 sphere points || tail magic(FE FE FE FE)
+const size_t   blockHeaderSize = 40;
+const size_t   blockPointsNum  = 125;
+const size_t   blockTailSize   = 4;
+const size_t   blockSize       = blockHeaderSize + blockPointsNum * sizeof(LiDARSpherePoint) + blockTailSize;
+const uint8_t  headMagic[]     = { 0x4D, 0x53, 0x02, 0xF4, 0xEB, 0x90 };
+const uint32_t blocksPerFrame  = 200;
+
+uint32_t nextRandom(uint32_t &state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+void putBigEndian16(uint8_t *data, uint16_t value) {
+    data[0] = static_cast<uint8_t>(value >> 8);
+    data[1] = static_cast<uint8_t>(value & 0xFF);
+}
+
+std::vector<uint8_t> generateBlocks(uint32_t blockCount) {
+    std::vector<uint8_t> blocks(blockCount * blockSize, 0);
+    uint32_t             random = 12345;
+    for(uint32_t i = 0; i < blockCount; i++) {
+        auto block = blocks.data() + i * blockSize;
+        memcpy(block, headMagic, sizeof(headMagic));
+        putBigEndian16(block + 6, static_cast<uint16_t>(blockSize));                         // data length
+        block[8] = 1;                                                                        // model: ME450
+        block[9] = 2;                                                                        // scan rate: 10Hz
+        putBigEndian16(block + 10, static_cast<uint16_t>(i % blocksPerFrame + 1));           // data block number
+        putBigEndian16(block + 12, static_cast<uint16_t>(i / blocksPerFrame % 65535 + 1));  // frame index
+        block[14] = 2;                                                                       // data format: sphere point
+
+        auto points = block + blockHeaderSize;
+        for(size_t j = 0; j < blockPointsNum; j++) {
+            auto point = points + j * sizeof(LiDARSpherePoint);
+            putBigEndian16(point + 0, static_cast<uint16_t>(nextRandom(random) % 30000));             // up to 60m
+            putBigEndian16(point + 2, static_cast<uint16_t>(nextRandom(random) % 36000 - 18000));     // -180 ~ 180 degrees
+            putBigEndian16(point + 4, static_cast<uint16_t>(nextRandom(random) % 5000 - 2500));       // -25 ~ 25 degrees
+            auto extValue = static_cast<uint16_t>((nextRandom(random) % 4) << 14 | (nextRandom(random) % 1600));  // mode | pulse width
+            point[6]      = static_cast<uint8_t>(extValue >> 8);
+            point[7]      = static_cast<uint8_t>(extValue & 0xFF);
+        }
+        memset(points + blockPointsNum * sizeof(LiDARSpherePoint), 0xFE, blockTailSize);
+    }
+    return blocks;
+}
+
+template <typename Func> double measure(const std::vector<uint8_t> &blocks, std::vector<OBLiDARSpherePoint> &output, int rounds, Func convert) {
+    auto blockCount = blocks.size() / blockSize;
+    auto start      = std::chrono::steady_clock::now();
+    for(int round = 0; round < rounds; round++) {
+        for(size_t i = 0; i < blockCount; i++) {
+            auto points = reinterpret_cast<const LiDARSpherePoint *>(blocks.data() + i * blockSize + blockHeaderSize);
+            convert(points, output.data() + i * blockPointsNum, blockPointsNum);
+        }
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) try {
+    auto blockCount = argc > 1 ? static_cast<uint32_t>(std::stoul(argv[1])) : blocksPerFrame * 10;
+    int  rounds     = argc > 2 ? std::stoi(argv[2]) : 10;
+
+    LiDARSpherePointConverter converter;
+    auto                      blocks = generateBlocks(blockCount);
+    auto                      points = static_cast<double>(blockCount) * blockPointsNum * rounds;
+
+    std::vector<OBLiDARSpherePoint> referenceOutput(blockCount * blockPointsNum);
+    std::vector<OBLiDARSpherePoint> output(blockCount * blockPointsNum);
+
+    auto referenceSeconds = measure(blocks, referenceOutput, rounds, [&](const LiDARSpherePoint *src, OBLiDARSpherePoint *dst, size_t count) {
+        converter.convertReference(src, dst, count);
+    });
+    auto seconds =
+        measure(blocks, output, rounds, [&](const LiDARSpherePoint *src, OBLiDARSpherePoint *dst, size_t count) { converter.convert(src, dst, count); });
+
+    size_t mismatches = 0;
+    for(size_t i = 0; i < output.size(); i++) {
+        if(memcmp(&output[i], &referenceOutput[i], sizeof(OBLiDARSpherePoint)) != 0) {
+            mismatches++;
+        }
+    }
+
+    std::cout << blockCount << " blocks of " << blockPointsNum << " points, " << rounds << " rounds" << std::endl;
+    std::printf("%-28s %-10s %-10s\n", "case", "seconds", "Mpoints/s");
+    std::printf("%-28s %-10.3f %-10.2f\n", "per point, table search", referenceSeconds, points / referenceSeconds / 1e6);
+    std::printf("%-28s %-10.3f %-10.2f\n", "block, lookup tables", seconds, points / seconds / 1e6);
+    std::printf("mismatched points: %zu\n", mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
+catch(const std::exception &e) {
+    std::cerr << "LiDAR point benchmark failed: " << e.what() << std::endl;
+    return 1;
+}
@@ -0,0 +1,186 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+// Compares the LiDAR point filter with the previous scalar implementation (cosine per point, division per neighbor pair) over synthetic sphere
+// point frames of the typical LiDAR frame sizes. Both must remove the same points.
+
+#include "FilterFactory.hpp"
+#include "frame/FrameFactory.hpp"
+#include "stream/StreamProfileFactory.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace libobsensor;
+
+struct FilterThreshold {
+    uint16_t neighbors;
+    uint16_t pointNumThreshold;
+    float    tanAngleThreshold;
+};
+
+const FilterThreshold filterThresholds[] = {
+    { 0, 0, 0.f }, { 0, 2, 0.0044f }, { 0, 2, 0.0087f }, { 1, 2, 0.0087f }, { 0, 2, 0.0175f }, { 1, 2, 0.0175f },
+};
+
+// The filter as it was before the lookup tables, SIMD and segments
+void referenceFilter(OBLiDARSpherePoint *pointData, uint32_t pointCount, uint32_t totalPointNumber, uint32_t filterLevel) {
+    constexpr float MY_PI     = 3.14159265358979323846f;
+    constexpr float DEG_2_RAD = MY_PI / 180.0f;
+    constexpr float EPS       = 0.00001f;
+
+    const float            angleRange = 315.f - 45.f;
+    const FilterThreshold &threshold  = filterThresholds[filterLevel];
+
+    const float angleResolution = angleRange / totalPointNumber * DEG_2_RAD;
+    const float angleResSin     = std::sin(angleResolution);
+    const float angleResCos     = std::cos(angleResolution);
+
+    std::vector<float> cacheDistanceTrans(pointCount);
+    for(uint32_t i = 0; i < pointCount; i++) {
+        const auto &centerCosPhi = std::cos(pointData[i].phi * DEG_2_RAD);
+        cacheDistanceTrans[i]    = pointData[i].distance * centerCosPhi;
+    }
+
+    uint32_t halfKernelSize = 5 >> 1;
+    for(uint32_t i = halfKernelSize; i < (pointCount - halfKernelSize); i++) {
+        uint32_t sumLeftAbnormal  = 0;
+        uint32_t sumRightAbnormal = 0;
+
+        float pointDistanceCenterCos = cacheDistanceTrans[i] * angleResCos;
+        float pointDistanceCenterSin = cacheDistanceTrans[i] * angleResSin;
+
+        for(uint32_t j = i - halfKernelSize; j < (i + halfKernelSize); j++) {
+            if((j == i) || (std::abs(cacheDistanceTrans[i]) < EPS)) {
+                continue;
+            }
+
+            const float &diff     = cacheDistanceTrans[j] - pointDistanceCenterCos;
+            auto         tanAngle = pointDistanceCenterSin / diff;
+
+            if((tanAngle < threshold.tanAngleThreshold) && (tanAngle > -threshold.tanAngleThreshold)) {
+                if(j < i)
+                    sumLeftAbnormal++;
+                else
+                    sumRightAbnormal++;
+
+                if((sumLeftAbnormal >= threshold.pointNumThreshold) || (sumRightAbnormal >= threshold.pointNumThreshold)) {
+                    for(int num = (-threshold.neighbors); num <= threshold.neighbors; num++) {
+                        pointData[i + num].distance = 0.f;
+                    }
+                }
+            }
+        }
+    }
+}
+
+uint32_t nextRandom(uint32_t &state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+// Points of a room scan: smooth walls with some grazing surfaces and edge trailing points between them, angles in 0.01 degree units
+std::vector<OBLiDARSpherePoint> generatePoints(uint32_t pointCount) {
+    std::vector<OBLiDARSpherePoint> points(pointCount);
+    uint32_t                        random   = 12345;
+    float                           distance = 3000.f;
+    for(uint32_t i = 0; i < pointCount; i++) {
+        auto r = nextRandom(random) % 1000;
+        if(r < 5) {
+            distance = 500.f + static_cast<float>(nextRandom(random) % 20000);  // a new surface
+        }
+        else if(r < 300) {
+            distance += static_cast<float>(nextRandom(random) % 400);  // grazing surface
+        }
+        else {
+            distance += static_cast<float>(nextRandom(random) % 11) - 5.f;
+        }
+        auto &point        = points[i];
+        point.distance     = (r % 97 == 0) ? 0.f : static_cast<float>(static_cast<uint16_t>(distance / 2.f)) * 2.0f;
+        point.theta        = static_cast<int16_t>(i * 27000 / pointCount + 4500) * 0.01f;
+        point.phi          = static_cast<int16_t>(static_cast<int>(i % 16) * 300 - 2250) * 0.01f;
+        point.reflectivity = static_cast<uint8_t>(nextRandom(random));
+        point.tag          = 0;
+    }
+    return points;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) try {
+    int  rounds = argc > 1 ? std::stoi(argv[1]) : 100;
+    auto level  = argc > 2 ? static_cast<uint32_t>(std::stoul(argv[2])) : 5;
+    if(level < 1 || level > 5) {
+        std::cerr << "filter level must be in [1, 5]" << std::endl;
+        return 1;
+    }
+
+    // MS600 sized frames (18 blocks of 75 ~ 300 points) and ME450 frames at 20/15/10/5Hz (60 ~ 240 blocks of 125 points). The filter copies
+    // the frame to a buffer of the profile size, so every frame uses the fastest scan rate that holds its points.
+    const uint32_t        frameSizes[] = { 1350, 2700, 5400, 7500, 10000, 15000, 30000 };
+    const OBLiDARScanRate scanRates[]  = { OB_LIDAR_SCAN_20HZ, OB_LIDAR_SCAN_15HZ, OB_LIDAR_SCAN_10HZ, OB_LIDAR_SCAN_5HZ };
+
+    auto factory = FilterFactory::getInstance();
+    auto filter  = factory->createFilter("LiDARPointFilter");
+    filter->setConfigValue("FilterLevel", level);
+
+    std::cout << "filter level " << level << ", " << rounds << " rounds per frame size" << std::endl;
+    std::printf("%-8s %-8s %-16s %-16s %-10s\n", "points", "removed", "reference us", "filter us", "mismatch");
+
+    bool allMatched = true;
+    for(auto pointCount: frameSizes) {
+        std::shared_ptr<LiDARStreamProfile> profile;
+        for(auto scanRate: scanRates) {
+            profile = StreamProfileFactory::createLiDARStreamProfile(scanRate, OB_FORMAT_LIDAR_SPHERE_POINT);
+            if(profile->getInfo().maxDataBlockNum * profile->getInfo().pointsNum >= pointCount) {
+                break;
+            }
+        }
+        auto totalPointNumber = profile->getInfo().maxDataBlockNum * profile->getInfo().pointsNum;
+
+        auto points   = generatePoints(pointCount);
+        auto dataSize = pointCount * sizeof(OBLiDARSpherePoint);
+        auto frame    = FrameFactory::createFrame(OB_FRAME_LIDAR_POINTS, OB_FORMAT_LIDAR_SPHERE_POINT, dataSize);
+        frame->updateData(reinterpret_cast<const uint8_t *>(points.data()), dataSize);
+        frame->setStreamProfile(profile);
+
+        // both loops copy the input frame, as the filter does
+        std::shared_ptr<Frame> reference;
+        auto                   start = std::chrono::steady_clock::now();
+        for(int i = 0; i < rounds; i++) {
+            reference = FrameFactory::createFrameFromOtherFrame(frame, true);
+            referenceFilter(reinterpret_cast<OBLiDARSpherePoint *>(reference->getDataMutable()), pointCount, totalPointNumber, level);
+        }
+        auto referenceUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / rounds;
+
+        std::shared_ptr<Frame> output;
+        start = std::chrono::steady_clock::now();
+        for(int i = 0; i < rounds; i++) {
+            output = filter->process(frame);
+        }
+        auto filterUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / rounds;
+
+        auto     refPoints  = reinterpret_cast<const OBLiDARSpherePoint *>(reference->getData());
+        auto     outPoints  = reinterpret_cast<const OBLiDARSpherePoint *>(output->getData());
+        uint32_t mismatches = 0;
+        uint32_t removed    = 0;
+        for(uint32_t i = 0; i < pointCount; i++) {
+            mismatches += memcmp(&outPoints[i], &refPoints[i], sizeof(OBLiDARSpherePoint)) != 0 ? 1 : 0;
+            removed += (refPoints[i].distance == 0.f && points[i].distance != 0.f) ? 1 : 0;
+        }
+        allMatched = allMatched && mismatches == 0;
+        std::printf("%-8u %-8u %-16.1f %-16.1f %-10u\n", pointCount, removed, referenceUs, filterUs, mismatches);
+    }
+    return allMatched ? 0 : 1;
+}
+catch(const std::exception &e) {
+    std::cerr << "LiDAR point filter benchmark failed: " << e.what() << std::endl;
+    return 1;
+}
@@ -0,0 +1,150 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+// Compares the MJPEG decoder of the FormatConverter with the previous implementation (a turbojpeg handle created and destroyed for every
+// frame) over synthetic color frames of the typical MJPEG resolutions. The decoded images must be identical.
+
+#include "publicfilters/MjpegDecoder.hpp"
+#include <turbojpeg.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int DECODE_FLAGS = TJFLAG_FASTDCT | TJFLAG_FASTUPSAMPLE;
+
+uint32_t nextRandom(uint32_t &state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+// A scene with smooth gradients, edges and sensor noise, so the compressed size is close to a real camera frame
+std::vector<uint8_t> generateImage(int width, int height) {
+    std::vector<uint8_t> image(static_cast<size_t>(width) * height * 3);
+    uint32_t             random = 12345;
+    for(int y = 0; y < height; y++) {
+        for(int x = 0; x < width; x++) {
+            auto pixel = &image[(static_cast<size_t>(y) * width + x) * 3];
+            auto noise = static_cast<int>(nextRandom(random) % 16);
+            auto block = ((x / 97) + (y / 61)) % 3 == 0 ? 80 : 0;
+            pixel[0]   = static_cast<uint8_t>((x * 255 / width + block + noise) & 0xFF);
+            pixel[1]   = static_cast<uint8_t>((y * 255 / height + noise) & 0xFF);
+            pixel[2]   = static_cast<uint8_t>(((x + y) * 255 / (width + height) + block / 2 + noise) & 0xFF);
+        }
+    }
+    return image;
+}
+
+void setRestartRows(const char *rows) {
+#ifdef _WIN32
+    _putenv_s("TJ_RESTART", rows);
+#else
+    setenv("TJ_RESTART", rows, 1);
+#endif
+}
+
+std::vector<uint8_t> compress(const std::vector<uint8_t> &image, int width, int height, int subsamp, const char *restartRows) {
+    setRestartRows(restartRows);  // read by turbojpeg when the compressor is set up
+    auto           handle = tjInitCompress();
+    unsigned char *jpeg   = nullptr;
+    unsigned long  size   = 0;
+    if(tjCompress2(handle, image.data(), width, 0, height, TJPF_RGB, &jpeg, &size, subsamp, 85, 0) != 0) {
+        std::string error = tjGetErrorStr2(handle);
+        tjDestroy(handle);
+        throw std::runtime_error("compress failed: " + error);
+    }
+    std::vector<uint8_t> result(jpeg, jpeg + size);
+    tjFree(jpeg);
+    tjDestroy(handle);
+    setRestartRows("");
+    return result;
+}
+
+// The decode the FormatConverter used to run for every frame
+bool referenceDecode(const std::vector<uint8_t> &jpeg, uint8_t *target, int width, int height) {
+    auto handle = tjInitDecompress();
+    auto ret    = tjDecompress2(handle, jpeg.data(), static_cast<unsigned long>(jpeg.size()), target, width, 0, height, TJPF_RGB, DECODE_FLAGS);
+    tjDestroy(handle);
+    return ret == 0;
+}
+
+template <typename Func> double averageUs(int rounds, Func func) {
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < rounds; i++) {
+        func();
+    }
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) try {
+    int  rounds = argc > 1 ? std::stoi(argv[1]) : 30;
+    auto slices = argc > 2 ? static_cast<uint32_t>(std::stoul(argv[2])) : 4;
+
+    struct Resolution {
+        int width;
+        int height;
+    };
+    const Resolution resolutions[] = { { 1280, 720 }, { 1920, 1080 }, { 3840, 2160 } };
+
+    struct Encoding {
+        const char *name;
+        int         subsamp;
+        const char *restartRows;  // TJ_RESTART, empty for no restart markers
+    };
+    const Encoding encodings[] = { { "422", TJSAMP_422, "" }, { "422 rst", TJSAMP_422, "1" }, { "420 rst", TJSAMP_420, "1" }, { "420 rst4", TJSAMP_420, "4" } };
+
+    libobsensor::MjpegDecoder wholeDecoder;
+    wholeDecoder.setMaxSlices(1);
+    libobsensor::MjpegDecoder slicedDecoder;
+    slicedDecoder.setMaxSlices(slices);
+
+    std::cout << rounds << " rounds per frame, " << slices << " slices" << std::endl;
+    std::printf("%-11s %-10s %-10s %-14s %-14s %-14s %-10s\n", "resolution", "encoding", "jpeg KB", "reference us", "handle us", "sliced us", "mismatch");
+
+    bool allMatched = true;
+    for(auto &resolution: resolutions) {
+        auto width  = resolution.width;
+        auto height = resolution.height;
+        auto image  = generateImage(width, height);
+        auto size   = static_cast<size_t>(width) * height * 3;
+
+        for(auto &encoding: encodings) {
+            auto jpeg   = compress(image, width, height, encoding.subsamp, encoding.restartRows);
+            auto srcLen = static_cast<uint32_t>(jpeg.size());
+
+            std::vector<uint8_t> reference(size), whole(size), sliced(size);
+            bool                 decoded = true;
+
+            auto referenceUs = averageUs(rounds, [&]() { decoded = referenceDecode(jpeg, reference.data(), width, height) && decoded; });
+            auto wholeUs     = averageUs(rounds, [&]() {
+                decoded = wholeDecoder.decode(jpeg.data(), srcLen, whole.data(), width, 0, height, TJPF_RGB, DECODE_FLAGS) && decoded;
+            });
+            auto slicedUs    = averageUs(rounds, [&]() {
+                decoded = slicedDecoder.decode(jpeg.data(), srcLen, sliced.data(), width, 0, height, TJPF_RGB, DECODE_FLAGS) && decoded;
+            });
+
+            size_t mismatches = 0;
+            for(size_t i = 0; i < size; i++) {
+                mismatches += (whole[i] != reference[i] || sliced[i] != reference[i]) ? 1 : 0;
+            }
+            allMatched = allMatched && decoded && mismatches == 0;
+
+            auto resolutionName = std::to_string(width) + "x" + std::to_string(height);
+            std::printf("%-11s %-10s %-10zu %-14.1f %-14.1f %-14.1f %-10zu%s\n", resolutionName.c_str(), encoding.name, jpeg.size() / 1024, referenceUs,
+                        wholeUs, slicedUs, mismatches, decoded ? "" : " (decode failed)");
+        }
+    }
+    return allMatched ? 0 : 1;
+}
+catch(const std::exception &e) {
+    std::cerr << "MJPEG decode benchmark failed: " << e.what() << std::endl;
+    return 1;
+}
@@ -0,0 +1,133 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+// Measures the throughput of the offline processor (frames per second) over a recording, with different worker counts.
+// If no recording file is given, a synthetic depth + color recording is generated with the recorder's writer first.
+
+#include "offline/OfflineProcessor.hpp"
+#include "ros/RosbagWriter.hpp"
+#include "FilterFactory.hpp"
+#include "frame/FrameFactory.hpp"
+#include "stream/StreamProfileFactory.hpp"
+#include "utils/MediaUtils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace {
+
+const uint32_t width           = 640;
+const uint32_t height          = 480;
+const uint32_t fps             = 30;
+const uint32_t versionProperty = 0;
+
+void generateRecording(const std::string &filePath, uint32_t seconds) {
+    using namespace libobsensor;
+
+    OBCameraIntrinsic  intrinsic  = { 460.0f, 460.0f, 320.0f, 240.0f, static_cast<int16_t>(width), static_cast<int16_t>(height) };
+    OBCameraDistortion distortion = {};
+    OBExtrinsic        extrinsic  = { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0, 0, 0 } };
+
+    auto depthProfile = StreamProfileFactory::createVideoStreamProfile(OB_STREAM_DEPTH, OB_FORMAT_Y16, width, height, fps);
+    auto colorProfile = StreamProfileFactory::createVideoStreamProfile(OB_STREAM_COLOR, OB_FORMAT_RGB, width, height, fps);
+    depthProfile->bindIntrinsic(intrinsic);
+    depthProfile->bindDistortion(distortion);
+    colorProfile->bindIntrinsic(intrinsic);
+    colorProfile->bindDistortion(distortion);
+    depthProfile->bindExtrinsicTo(colorProfile, extrinsic);
+
+    auto writer = std::make_shared<RosWriter>(filePath, true);
+
+    const uint32_t frameCount = seconds * fps;
+    for(uint32_t i = 0; i < frameCount; i++) {
+        uint64_t timestamp = 1000000 + static_cast<uint64_t>(i) * 1000000 / fps;
+
+        auto depthFrame = FrameFactory::createVideoFrame(OB_FRAME_DEPTH, OB_FORMAT_Y16, width, height, 0);
+        auto depthData  = reinterpret_cast<uint16_t *>(depthFrame->getDataMutable());
+        for(uint32_t p = 0; p < width * height; p++) {
+            depthData[p] = static_cast<uint16_t>(500 + (p + i) % 3000);
+        }
+        auto colorFrame = FrameFactory::createVideoFrame(OB_FRAME_COLOR, OB_FORMAT_RGB, width, height, 0);
+        auto colorData  = colorFrame->getDataMutable();
+        for(uint32_t p = 0; p < width * height * 3; p++) {
+            colorData[p] = static_cast<uint8_t>(p + i);
+        }
+
+        for(auto &frame: { depthFrame, colorFrame }) {
+            frame->setStreamProfile(frame->getType() == OB_FRAME_DEPTH ? depthProfile : colorProfile);
+            frame->setNumber(i);
+            frame->setTimeStampUsec(timestamp);
+            frame->setSystemTimeStampUsec(timestamp);
+            frame->setGlobalTimeStampUsec(timestamp);
+        }
+        writer->writeFrame(OB_SENSOR_DEPTH, depthFrame);
+        writer->writeFrame(OB_SENSOR_COLOR, colorFrame);
+    }
+
+    double version = utils::getBagFileVersion();
+    writer->writeProperty(versionProperty, reinterpret_cast<const uint8_t *>(&version), sizeof(version));
+
+    auto deviceInfo       = std::make_shared<DeviceInfo>();
+    deviceInfo->name_     = "Synthetic Device";
+    deviceInfo->deviceSn_ = "BENCHMARK";
+    writer->writeDeviceInfo(deviceInfo);
+    writer->writeStreamProfiles();
+    writer->stop(false);
+}
+
+void runBenchmark(const std::string &filePath, uint32_t workerCount) {
+    using namespace libobsensor;
+
+    auto processor = std::make_shared<OfflineProcessor>(filePath);
+    processor->setWorkerCount(workerCount);
+
+    auto factory = FilterFactory::getInstance();
+    auto align   = factory->createFilter("Align");
+    align->setConfigValueSync("AlignType", OB_STREAM_COLOR);
+    processor->addFilter(align);
+    processor->addFilter(factory->createFilter("PointCloudFilter"));
+
+    std::atomic<uint64_t> frameCount(0);
+    auto                  start = std::chrono::steady_clock::now();
+    processor->process([&frameCount](std::shared_ptr<const Frame> frame) {
+        if(frame) {
+            frameCount++;
+        }
+    });
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("%-8u %-10llu %-10.3f %-10.2f\n", workerCount, static_cast<unsigned long long>(frameCount.load()), elapsed,
+                elapsed > 0 ? frameCount / elapsed : 0.0);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) try {
+    std::string filePath   = argc > 1 ? argv[1] : "";
+    uint32_t    seconds    = argc > 2 ? static_cast<uint32_t>(std::stoul(argv[2])) : 10;
+    uint32_t    maxWorkers = argc > 3 ? static_cast<uint32_t>(std::stoul(argv[3])) : std::thread::hardware_concurrency();
+    maxWorkers             = std::max<uint32_t>(1, maxWorkers);
+
+    if(filePath.empty()) {
+        filePath = "offline_process_benchmark.bag";
+        std::cout << "Generating a " << seconds << "s synthetic recording: " << filePath << std::endl;
+        generateRecording(filePath, seconds);
+    }
+
+    std::cout << "Processing " << filePath << " with Align(to color) + PointCloudFilter" << std::endl;
+    std::printf("%-8s %-10s %-10s %-10s\n", "workers", "frames", "seconds", "frames/s");
+
+    for(uint32_t workers = 1; workers <= maxWorkers; workers *= 2) {
+        runBenchmark(filePath, workers);
+    }
+    return 0;
+}
+catch(const std::exception &e) {
+    std::cerr << "Offline process benchmark failed: " << e.what() << std::endl;
+    return 1;
+}
@@ -0,0 +1,335 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+// Replays a recording through a pipeline as fast as it can go and measures the SDK overhead of every frame: the latency from the arrival of
+// the frame to each stage of the frame path (percentiles), the throughput, the dropped frames and the peak thread count.
+// If no recording file is given, a synthetic depth + color recording is generated with the recorder's writer first.
+
+#include "Pipeline.hpp"
+#include "Config.hpp"
+#include "playback/PlaybackDevice.hpp"
+#include "ros/RosbagWriter.hpp"
+#include "FilterFactory.hpp"
+#include "frame/FrameFactory.hpp"
+#include "frame/FrameLatencyTracer.hpp"
+#include "stream/StreamProfileFactory.hpp"
+#include "utils/MediaUtils.hpp"
+#include "utils/PublicTypeHelper.hpp"
+#include "CsvFile.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const uint32_t width           = 640;
+const uint32_t height          = 480;
+const uint32_t fps             = 30;
+const uint32_t versionProperty = 0;
+
+const double percentiles[] = { 0.5, 0.99, 0.999 };
+
+// the stages of the frame path reported, the filter stages of the frame processors are in the sensor to pipeline input time
+const OBFrameTraceStage reportedStages[] = { OB_FRAME_TRACE_STAGE_SENSOR_OUTPUT, OB_FRAME_TRACE_STAGE_PIPELINE_INPUT, OB_FRAME_TRACE_STAGE_AGGREGATION,
+                                             OB_FRAME_TRACE_STAGE_DELIVERY, OB_FRAME_TRACE_STAGE_CALLBACK_RETURN };
+
+void generateRecording(const std::string &filePath, uint32_t seconds) {
+    using namespace libobsensor;
+
+    OBCameraIntrinsic  intrinsic  = { 460.0f, 460.0f, 320.0f, 240.0f, static_cast<int16_t>(width), static_cast<int16_t>(height) };
+    OBCameraDistortion distortion = {};
+    OBExtrinsic        extrinsic  = { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0, 0, 0 } };
+
+    auto depthProfile = StreamProfileFactory::createVideoStreamProfile(OB_STREAM_DEPTH, OB_FORMAT_Y16, width, height, fps);
+    auto colorProfile = StreamProfileFactory::createVideoStreamProfile(OB_STREAM_COLOR, OB_FORMAT_RGB, width, height, fps);
+    depthProfile->bindIntrinsic(intrinsic);
+    depthProfile->bindDistortion(distortion);
+    colorProfile->bindIntrinsic(intrinsic);
+    colorProfile->bindDistortion(distortion);
+    depthProfile->bindExtrinsicTo(colorProfile, extrinsic);
+
+    auto writer = std::make_shared<RosWriter>(filePath, true);
+
+    const uint32_t frameCount = seconds * fps;
+    for(uint32_t i = 0; i < frameCount; i++) {
+        uint64_t timestamp = 1000000 + static_cast<uint64_t>(i) * 1000000 / fps;
+
+        auto depthFrame = FrameFactory::createVideoFrame(OB_FRAME_DEPTH, OB_FORMAT_Y16, width, height, 0);
+        auto depthData  = reinterpret_cast<uint16_t *>(depthFrame->getDataMutable());
+        for(uint32_t p = 0; p < width * height; p++) {
+            depthData[p] = static_cast<uint16_t>(500 + (p + i) % 3000);
+        }
+        auto colorFrame = FrameFactory::createVideoFrame(OB_FRAME_COLOR, OB_FORMAT_RGB, width, height, 0);
+        auto colorData  = colorFrame->getDataMutable();
+        for(uint32_t p = 0; p < width * height * 3; p++) {
+            colorData[p] = static_cast<uint8_t>(p + i);
+        }
+
+        for(auto &frame: { depthFrame, colorFrame }) {
+            frame->setStreamProfile(frame->getType() == OB_FRAME_DEPTH ? depthProfile : colorProfile);
+            frame->setNumber(i);
+            frame->setTimeStampUsec(timestamp);
+            frame->setSystemTimeStampUsec(timestamp);
+            frame->setGlobalTimeStampUsec(timestamp);
+        }
+        writer->writeFrame(OB_SENSOR_DEPTH, depthFrame);
+        writer->writeFrame(OB_SENSOR_COLOR, colorFrame);
+    }
+
+    double version = utils::getBagFileVersion();
+    writer->writeProperty(versionProperty, reinterpret_cast<const uint8_t *>(&version), sizeof(version));
+    // the depth sensor of the playback device needs to know if the recorded frames are depth or disparity
+    bool hwD2D = true;
+    writer->writeProperty(OB_PROP_DISPARITY_TO_DEPTH_BOOL, reinterpret_cast<const uint8_t *>(&hwD2D), sizeof(hwD2D));
+
+    auto deviceInfo       = std::make_shared<DeviceInfo>();
+    deviceInfo->name_     = "Synthetic Device";
+    deviceInfo->deviceSn_ = "BENCHMARK";
+    writer->writeDeviceInfo(deviceInfo);
+    writer->writeStreamProfiles();
+    writer->stop(false);
+}
+
+// the number of threads of the process, -1 where it is not known
+int getThreadCount() {
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string   line;
+    while(std::getline(status, line)) {
+        if(line.compare(0, 8, "Threads:") == 0) {
+            return std::stoi(line.substr(8));
+        }
+    }
+#endif
+    return -1;
+}
+
+// samples the thread count of the process every 50ms while it exists, to find the peak
+class ThreadCountSampler {
+public:
+    ThreadCountSampler() : sampling_(true), peak_(getThreadCount()) {
+        thread_ = std::thread([this]() {
+            while(sampling_) {
+                peak_ = std::max(peak_.load(), getThreadCount());
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+        });
+    }
+
+    ~ThreadCountSampler() {
+        sampling_ = false;
+        thread_.join();
+    }
+
+    int getPeak() const {
+        return peak_;
+    }
+
+private:
+    std::atomic<bool> sampling_;
+    std::atomic<int>  peak_;
+    std::thread       thread_;
+};
+
+std::vector<std::string> splitFilterNames(const std::string &filters) {
+    std::vector<std::string> names;
+    std::stringstream        ss(filters);
+    std::string              name;
+    while(std::getline(ss, name, ',')) {
+        if(!name.empty()) {
+            names.push_back(name);
+        }
+    }
+    return names;
+}
+
+struct BenchmarkResult {
+    uint64_t framesets       = 0;
+    uint64_t frames          = 0;
+    uint64_t droppedFrames   = 0;
+    double   seconds         = 0;
+    int      peakThreadCount = -1;
+};
+
+BenchmarkResult runBenchmark(const std::string &filePath, const std::string &filters) {
+    using namespace libobsensor;
+
+    auto device = std::make_shared<PlaybackDevice>(filePath);
+    device->activateDeviceAccessor();
+    device->fetchProperties();
+    device->setMaxThroughputMode(true);
+
+    std::vector<std::shared_ptr<IFilter>> filterList;
+    for(auto &name: splitFilterNames(filters)) {
+        auto filter = FilterFactory::getInstance()->createFilter(name);
+        if(name == "Align") {
+            filter->setConfigValueSync("AlignType", OB_STREAM_COLOR);
+        }
+        filterList.push_back(filter);
+    }
+
+    auto config = std::make_shared<Config>();
+    for(auto sensorType: device->getSensorTypeList()) {
+        config->enableStream(utils::mapSensorTypeToStreamType(sensorType));
+    }
+
+    BenchmarkResult       result;
+    std::atomic<uint64_t> framesets(0);
+    std::atomic<uint64_t> frames(0);
+    std::atomic<uint64_t> lastOutputUs(0);
+    auto                  start   = std::chrono::steady_clock::now();
+    auto                  elapsed = [&start]() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    };
+
+    ThreadCountSampler threadCountSampler;
+    FrameLatencyTracer::reset();
+    auto pipeline = std::make_shared<Pipeline>(device);
+    start         = std::chrono::steady_clock::now();
+    pipeline->start(config, [&](std::shared_ptr<const Frame> frame) {
+        std::shared_ptr<const Frame> output = frame;
+        for(auto &filter: filterList) {
+            output = filter->process(output);
+        }
+        framesets++;
+        frames += frame->is<FrameSet>() ? frame->as<FrameSet>()->getCount() : 1;
+        lastOutputUs = elapsed();
+    });
+
+    // the playback stops at the end of the recording, the frames already read are still delivered after that
+    while(device->getCurrentPlaybackStatus() != OB_PLAYBACK_STOPPED) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    uint64_t lastFrames = 0;
+    do {
+        lastFrames = frames;
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    } while(frames != lastFrames);
+    pipeline->stop();
+
+    auto sensorOutput      = FrameLatencyTracer::getHistogram(OB_FRAME_TRACE_STAGE_SENSOR_OUTPUT).getCount();
+    result.framesets       = framesets;
+    result.frames          = frames;
+    result.droppedFrames   = sensorOutput > result.frames ? sensorOutput - result.frames : 0;
+    result.seconds         = static_cast<double>(lastOutputUs) / 1000000.0;
+    result.peakThreadCount = threadCountSampler.getPeak();
+    return result;
+}
+
+void printResult(const std::string &configName, const BenchmarkResult &result) {
+    using namespace libobsensor;
+
+    std::printf("%s: %llu framesets, %llu frames in %.3fs, %.2f frames/s, %llu dropped frames, %d threads at peak\n", configName.c_str(),
+                static_cast<unsigned long long>(result.framesets), static_cast<unsigned long long>(result.frames), result.seconds,
+                result.seconds > 0 ? result.frames / result.seconds : 0.0, static_cast<unsigned long long>(result.droppedFrames),
+                result.peakThreadCount);
+    std::printf("  %-20s %-10s %-10s %-10s %-10s %s\n", "stage", "frames", "p50 us", "p99 us", "p99.9 us", "max us");
+    for(auto stage: reportedStages) {
+        auto &histogram = FrameLatencyTracer::getHistogram(stage);
+        std::printf("  %-20s %-10llu %-10llu %-10llu %-10llu %llu\n", FrameLatencyTracer::getStageName(stage),
+                    static_cast<unsigned long long>(histogram.getCount()), static_cast<unsigned long long>(histogram.getPercentile(percentiles[0])),
+                    static_cast<unsigned long long>(histogram.getPercentile(percentiles[1])),
+                    static_cast<unsigned long long>(histogram.getPercentile(percentiles[2])), static_cast<unsigned long long>(histogram.getMax()));
+    }
+}
+
+std::string getCsvTitle() {
+    using namespace libobsensor;
+
+    std::string title = "Config, Framesets, Frames, Throughput(fps), Dropped Frames, Peak Threads";
+    for(auto stage: reportedStages) {
+        std::string stageName = FrameLatencyTracer::getStageName(stage);
+        title += ", " + stageName + " P50(us), " + stageName + " P99(us), " + stageName + " P99.9(us)";
+    }
+    return title;
+}
+
+std::vector<double> getCsvValues(const BenchmarkResult &result) {
+    using namespace libobsensor;
+
+    std::vector<double> values = { static_cast<double>(result.framesets), static_cast<double>(result.frames),
+                                   result.seconds > 0 ? result.frames / result.seconds : 0.0, static_cast<double>(result.droppedFrames),
+                                   static_cast<double>(result.peakThreadCount) };
+    for(auto stage: reportedStages) {
+        auto &histogram = FrameLatencyTracer::getHistogram(stage);
+        for(auto percentile: percentiles) {
+            values.push_back(static_cast<double>(histogram.getPercentile(percentile)));
+        }
+    }
+    return values;
+}
+
+void printUsage() {
+    std::cout << "Usage: ob_playback_pipeline_benchmark [bag_file] [--seconds N] [--filters NAME[,NAME...]] [--csv FILE] [--trace FILE]" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) try {
+    std::string              filePath;
+    std::string              csvPath = "playback_pipeline_summary.csv";
+    std::string              tracePath;
+    uint32_t                 seconds = 10;
+    std::vector<std::string> configs = { "", "Align", "Align,PointCloudFilter" };
+
+    for(int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if(arg == "--seconds" && i + 1 < argc) {
+            seconds = static_cast<uint32_t>(std::stoul(argv[++i]));
+        }
+        else if(arg == "--filters" && i + 1 < argc) {
+            configs = { argv[++i] };
+        }
+        else if(arg == "--csv" && i + 1 < argc) {
+            csvPath = argv[++i];
+        }
+        else if(arg == "--trace" && i + 1 < argc) {
+            tracePath = argv[++i];
+        }
+        else if(arg.compare(0, 2, "--") != 0 && filePath.empty()) {
+            filePath = arg;
+        }
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    if(filePath.empty()) {
+        filePath = "playback_pipeline_benchmark.bag";
+        std::cout << "Generating a " << seconds << "s synthetic recording: " << filePath << std::endl;
+        generateRecording(filePath, seconds);
+    }
+
+    CSVFile summary;
+    summary.open(csvPath);
+    summary.writeTitle(getCsvTitle());
+
+    libobsensor::FrameLatencyTracer::enable(true);
+    if(!tracePath.empty()) {
+        libobsensor::FrameLatencyTracer::startExport(tracePath);  // the frame trace of all the runs, which adds its own cost to the latencies
+    }
+    for(auto &filters: configs) {
+        std::string configName = filters.empty() ? "No filter" : filters;
+        auto        result     = runBenchmark(filePath, filters);
+        printResult(configName, result);
+        summary.writeConfigValues("\"" + configName + "\"", getCsvValues(result));
+    }
+    libobsensor::FrameLatencyTracer::stopExport();
+    libobsensor::FrameLatencyTracer::enableFrameTrace(false);
+    libobsensor::FrameLatencyTracer::enable(false);
+    summary.close();
+    return 0;
+}
+catch(const std::exception &e) {
+    std::cerr << "Playback pipeline benchmark failed: " << e.what() << std::endl;
+    return 1;
+}
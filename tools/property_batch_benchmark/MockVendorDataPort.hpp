@@ -0,0 +1,95 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ISourcePort.hpp"
+#include "protocol/Protocol.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace libobsensor {
+
+/**
+ * A vendor data port answering get/set property requests like the firmware does, after a simulated round trip time.
+ *
+ * When pipelined, a batch costs one round trip for all its requests, as with a transport that keeps several requests in flight. Otherwise the batch
+ * falls back to the default implementation, one round trip per request.
+ */
+class MockVendorDataPort : public IVendorDataPort {
+public:
+    MockVendorDataPort(std::chrono::microseconds roundTripTime, bool pipelined) : roundTripTime_(roundTripTime), pipelined_(pipelined) {}
+    ~MockVendorDataPort() noexcept override = default;
+
+    std::shared_ptr<const SourcePortInfo> getSourcePortInfo() const override {
+        return nullptr;
+    }
+
+    uint32_t sendAndReceive(const uint8_t *sendData, uint32_t sendLen, uint8_t *recvData, uint32_t exceptedRecvLen) override {
+        std::this_thread::sleep_for(roundTripTime_);
+        return handleRequest(sendData, sendLen, recvData, exceptedRecvLen);
+    }
+
+    void sendAndReceiveBatch(std::vector<VendorTransfer> &transfers) override {
+        if(!pipelined_) {
+            IVendorDataPort::sendAndReceiveBatch(transfers);
+            return;
+        }
+
+        std::this_thread::sleep_for(roundTripTime_);
+        for(auto &transfer: transfers) {
+            transfer.recvLen = handleRequest(transfer.sendData, transfer.sendLen, transfer.recvData, transfer.exceptedRecvLen);
+        }
+    }
+
+    uint64_t getRequestCount() const {
+        return requestCount_;
+    }
+
+private:
+    uint32_t handleRequest(const uint8_t *sendData, uint32_t sendLen, uint8_t *recvData, uint32_t exceptedRecvLen) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        requestCount_++;
+
+        auto reqHeader = reinterpret_cast<const protocol::ReqHeader *>(sendData);
+        if(sendLen < sizeof(protocol::ReqHeader) || exceptedRecvLen < sizeof(protocol::GetPropertyResp)) {
+            return 0;
+        }
+
+        auto resp              = reinterpret_cast<protocol::GetPropertyResp *>(recvData);
+        resp->header.magic     = HP_RESPONSE_MAGIC;
+        resp->header.opcode    = reqHeader->opcode;
+        resp->header.requestId = reqHeader->requestId;
+        resp->header.errorCode = protocol::HP_RESP_OK;
+
+        if(reqHeader->opcode == protocol::OPCODE_SET_PROPERTY) {
+            auto req                     = reinterpret_cast<const protocol::SetPropertyReq *>(sendData);
+            values_[req->propertyId]     = req->value;
+            resp->header.sizeInHalfWords = sizeof(resp->header.errorCode) / 2;
+            return sizeof(protocol::SetPropertyResp);
+        }
+        if(reqHeader->opcode == protocol::OPCODE_GET_PROPERTY) {
+            auto req                     = reinterpret_cast<const protocol::GetPropertyReq *>(sendData);
+            resp->data                   = { values_[req->propertyId], 1000, 0, 100, 1 };
+            resp->header.sizeInHalfWords = (sizeof(resp->header.errorCode) + sizeof(protocol::PropertyData)) / 2;
+            return sizeof(protocol::GetPropertyResp);
+        }
+
+        resp->header.errorCode       = protocol::HP_RESP_ERROR_UNSUPPORTED_REQUEST;
+        resp->header.sizeInHalfWords = sizeof(resp->header.errorCode) / 2;
+        return sizeof(protocol::RespHeader);
+    }
+
+private:
+    std::chrono::microseconds   roundTripTime_;
+    bool                        pipelined_;
+    std::mutex                  mutex_;
+    std::map<uint32_t, int32_t> values_;
+    uint64_t                    requestCount_ = 0;
+};
+
+}  // namespace libobsensor
@@ -0,0 +1,143 @@
+// Copyright (c) Orbbec Inc. All Rights Reserved.
+// Licensed under the MIT License.
+
+// Compares reading and writing a set of properties one by one with the batch operations of the property server, over a mock vendor data port with a
+// simulated round trip time. The property set is the one the recorder reads when a recording starts.
+
+#include "MockVendorDataPort.hpp"
+#include "component/property/PropertyServer.hpp"
+#include "component/property/VendorPropertyAccessor.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace libobsensor;
+
+const std::vector<uint32_t> propertyIds = {
+    OB_PROP_LASER_CONTROL_INT,
+    OB_PROP_LASER_POWER_LEVEL_CONTROL_INT,
+    OB_PROP_DEPTH_AUTO_EXPOSURE_BOOL,
+    OB_PROP_DEPTH_EXPOSURE_INT,
+    OB_PROP_DEPTH_GAIN_INT,
+    OB_PROP_COLOR_AUTO_EXPOSURE_BOOL,
+    OB_PROP_COLOR_AUTO_WHITE_BALANCE_BOOL,
+    OB_PROP_COLOR_POWER_LINE_FREQUENCY_INT,
+    OB_PROP_COLOR_AE_MAX_EXPOSURE_INT,
+    OB_PROP_COLOR_AUTO_EXPOSURE_PRIORITY_INT,
+    OB_PROP_COLOR_EXPOSURE_INT,
+    OB_PROP_COLOR_GAIN_INT,
+    OB_PROP_COLOR_WHITE_BALANCE_INT,
+    OB_PROP_COLOR_BRIGHTNESS_INT,
+    OB_PROP_COLOR_SHARPNESS_INT,
+    OB_PROP_COLOR_SATURATION_INT,
+    OB_PROP_COLOR_CONTRAST_INT,
+    OB_PROP_COLOR_GAMMA_INT,
+    OB_PROP_COLOR_HUE_INT,
+    OB_PROP_COLOR_BACKLIGHT_COMPENSATION_INT,
+    OB_PROP_IR_AUTO_EXPOSURE_BOOL,
+    OB_PROP_IR_AE_MAX_EXPOSURE_INT,
+    OB_PROP_IR_BRIGHTNESS_INT,
+    OB_PROP_IR_EXPOSURE_INT,
+    OB_PROP_IR_GAIN_INT,
+    OB_PROP_DEPTH_FLIP_BOOL,
+    OB_PROP_DEPTH_MIRROR_BOOL,
+    OB_PROP_DEPTH_ROTATE_INT,
+    OB_PROP_COLOR_FLIP_BOOL,
+    OB_PROP_COLOR_MIRROR_BOOL,
+    OB_PROP_COLOR_ROTATE_INT,
+    OB_PROP_IR_FLIP_BOOL,
+    OB_PROP_IR_MIRROR_BOOL,
+    OB_PROP_IR_ROTATE_INT,
+};
+
+struct Result {
+    double   milliseconds;
+    uint64_t requests;
+};
+
+std::shared_ptr<PropertyServer> createServer(std::shared_ptr<MockVendorDataPort> port) {
+    auto server   = std::make_shared<PropertyServer>(nullptr);
+    auto accessor = std::make_shared<VendorPropertyAccessor>(nullptr, port);
+    for(auto id: propertyIds) {
+        server->registerProperty(id, "rw", "rw", accessor);
+    }
+    return server;
+}
+
+template <typename Func> Result measure(std::chrono::microseconds roundTripTime, bool pipelined, Func func) {
+    auto port   = std::make_shared<MockVendorDataPort>(roundTripTime, pipelined);
+    auto server = createServer(port);
+
+    auto start = std::chrono::steady_clock::now();
+    func(server);
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return { elapsed, port->getRequestCount() };
+}
+
+void readOneByOne(std::shared_ptr<PropertyServer> server) {
+    for(auto id: propertyIds) {
+        OBPropertyValue value;
+        OBPropertyRange range;
+        server->getPropertyValue(id, &value, PROP_ACCESS_INTERNAL);
+        server->getPropertyRange(id, &range, PROP_ACCESS_INTERNAL);
+    }
+}
+
+void readBatch(std::shared_ptr<PropertyServer> server) {
+    std::vector<PropertyValueItem> values;
+    std::vector<PropertyRangeItem> ranges;
+    for(auto id: propertyIds) {
+        values.push_back({ id, {}, false });
+        ranges.push_back({ id, {}, false });
+    }
+    server->getPropertyValues(values, PROP_ACCESS_INTERNAL);
+    server->getPropertyRanges(ranges, PROP_ACCESS_INTERNAL);
+}
+
+void writeOneByOne(std::shared_ptr<PropertyServer> server) {
+    for(auto id: propertyIds) {
+        OBPropertyValue value;
+        value.intValue = 1;
+        server->setPropertyValue(id, value, PROP_ACCESS_INTERNAL);
+    }
+}
+
+void writeBatch(std::shared_ptr<PropertyServer> server) {
+    std::vector<PropertyValueItem> values;
+    for(auto id: propertyIds) {
+        OBPropertyValue value;
+        value.intValue = 1;
+        values.push_back({ id, value, false });
+    }
+    server->setPropertyValues(values, PROP_ACCESS_INTERNAL);
+}
+
+void printResult(const std::string &name, const Result &result) {
+    std::printf("%-34s %-10.2f %-10llu\n", name.c_str(), result.milliseconds, static_cast<unsigned long long>(result.requests));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) try {
+    auto roundTripTime = std::chrono::microseconds(argc > 1 ? std::stoul(argv[1]) : 1000);
+
+    std::cout << propertyIds.size() << " properties, simulated round trip time: " << roundTripTime.count() << "us" << std::endl;
+    std::printf("%-34s %-10s %-10s\n", "case", "ms", "requests");
+
+    printResult("read value+range, one by one", measure(roundTripTime, false, readOneByOne));
+    printResult("read value+range, batch", measure(roundTripTime, false, readBatch));
+    printResult("read value+range, batch pipelined", measure(roundTripTime, true, readBatch));
+    printResult("write value, one by one", measure(roundTripTime, false, writeOneByOne));
+    printResult("write value, batch", measure(roundTripTime, false, writeBatch));
+    printResult("write value, batch pipelined", measure(roundTripTime, true, writeBatch));
+    return 0;
+}
+catch(const std::exception &e) {
+    std::cerr << "Property batch benchmark failed: " << e.what() << std::endl;
+    return 1;
+}